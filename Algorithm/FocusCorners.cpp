@@ -27,23 +27,16 @@ using namespace std;
 
 bool VieVS::FocusCorners::flag = false;
 int VieVS::FocusCorners::nscans = 1;
-int thread_local VieVS::FocusCorners::iscan = 0;
-bool thread_local VieVS::FocusCorners::startFocusCorner = false;
-std::vector<double> thread_local VieVS::FocusCorners::lastCornerAzimuth = std::vector<double>();
-std::vector<std::pair<int, double>> thread_local VieVS::FocusCorners::backupWeight =
-    std::vector<std::pair<int, double>>();
-unsigned int thread_local VieVS::FocusCorners::nextStart = numeric_limits<unsigned int>::max();
-unsigned int thread_local VieVS::FocusCorners::interval = 900;
-std::vector<int> thread_local VieVS::FocusCorners::staid2groupid = std::vector<int>();
 
 
-void VieVS::FocusCorners::initialize( const Network &network, ofstream &of ) {
+void VieVS::FocusCorners::initialize( const Network &network, SchedulingContext &context, ofstream &of ) {
     unsigned long nsta = network.getNSta();
-    lastCornerAzimuth = std::vector<double>( nsta, std::numeric_limits<double>::quiet_NaN() );
-    staid2groupid = std::vector<int>( nsta, 0 );
-    FocusCorners::startFocusCorner = true;
-    FocusCorners::nextStart = 0;
-    FocusCorners::iscan = 0;
+    context.focusCornerLastAzimuth = std::vector<double>( nsta, std::numeric_limits<double>::quiet_NaN() );
+    context.focusCornerStaid2groupid = std::vector<int>( nsta, 0 );
+    context.focusCornerStart = true;
+    context.focusCornerNextStart = 0;
+    context.focusCornerScan = 0;
+    vector<int> &staid2groupid = context.focusCornerStaid2groupid;
 
     auto getDxy = []( const Station &sta1, const Station &sta2 ) {
         double dx = sta2.getPosition()->getX() - sta1.getPosition()->getX();
@@ -93,9 +86,11 @@ void VieVS::FocusCorners::initialize( const Network &network, ofstream &of ) {
     }
 }
 
-void VieVS::FocusCorners::reweight( const Subcon &subcon, SourceList &sourceList, std::ofstream &of, double fraction,
-                                    int iteration ) {
+void VieVS::FocusCorners::reweight( const Subcon &subcon, SourceList &sourceList, SchedulingContext &context,
+                                    std::ofstream &of, double fraction, int iteration ) {
     const auto &scans = subcon.getSingleSourceScans();
+    const vector<int> &staid2groupid = context.focusCornerStaid2groupid;
+    const vector<double> &lastCornerAzimuth = context.focusCornerLastAzimuth;
     vector<double> sumEl = vector<double>( scans.size() );
 
     for ( int iscan = 0; iscan < scans.size(); ++iscan ) {
@@ -167,7 +162,7 @@ void VieVS::FocusCorners::reweight( const Subcon &subcon, SourceList &sourceList
                       "| readjust source selection at corner (fraction %5.3f)                                    "
                       "                                                     |\n" ) %
                       newFraction;
-            reweight( subcon, sourceList, of, newFraction, ++iteration );
+            reweight( subcon, sourceList, context, of, newFraction, ++iteration );
             return;
         }
     } else if ( bestElements.size() < 3 ) {
@@ -177,14 +172,14 @@ void VieVS::FocusCorners::reweight( const Subcon &subcon, SourceList &sourceList
                       "| readjust source selection at corner (fraction %5.3f)                                    "
                       "                                                     |\n" ) %
                       newFraction;
-            reweight( subcon, sourceList, of, newFraction, ++iteration );
+            reweight( subcon, sourceList, context, of, newFraction, ++iteration );
             return;
         }
     }
 
     for ( int idx : bestElements ) {
         unsigned long srcid = scans[idx].getSourceId();
-        backupWeight.emplace_back( srcid, sourceList.getSource( srcid )->getPARA().weight );
+        context.focusCornerBackupWeight.emplace_back( srcid, sourceList.getSource( srcid )->getPARA().weight );
         double newWeight = 1000 / ( sumEl[idx] / minimum );
         of << boost::format(
                   "|     increase weight of source %-8s to %7.2f                                             "
@@ -195,22 +190,22 @@ void VieVS::FocusCorners::reweight( const Subcon &subcon, SourceList &sourceList
     of << boost::format( "|%|143T-||\n" );
 }
 
-void FocusCorners::reset( const std::vector<Scan> &bestScans, SourceList &sourceList ) {
-    for ( const auto &any : backupWeight ) {
+void FocusCorners::reset( const std::vector<Scan> &bestScans, SourceList &sourceList, SchedulingContext &context ) {
+    for ( const auto &any : context.focusCornerBackupWeight ) {
         sourceList.refSource( any.first )->referencePARA().weight = any.second;
     }
-    backupWeight.clear();
-    FocusCorners::iscan = 0;
-    FocusCorners::nextStart += FocusCorners::interval;
+    context.focusCornerBackupWeight.clear();
+    context.focusCornerScan = 0;
+    context.focusCornerNextStart += context.focusCornerInterval;
 
     for ( const auto &scan : bestScans ) {
         for ( int i = 0; i < scan.getNSta(); ++i ) {
             const PointingVector &pv = scan.getPointingVector( i );
             unsigned long staid = pv.getStaid();
-            lastCornerAzimuth[staid] = pv.getAz();
+            context.focusCornerLastAzimuth[staid] = pv.getAz();
         }
     }
-    FocusCorners::startFocusCorner = false;
+    context.focusCornerStart = false;
 }
 
 
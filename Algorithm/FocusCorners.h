@@ -27,6 +27,7 @@
 #ifndef FOCUSCORNERS_H
 #define FOCUSCORNERS_H
 
+#include "../Misc/SchedulingContext.h"
 #include "../Scan/Subcon.h"
 
 namespace VieVS {
@@ -47,9 +48,10 @@ class FocusCorners {
      * define group and set variables
      *
      * @param network station network
+     * @param context scheduling context
      * @param of log file stream
      */
-    static void initialize( const Network &network, std::ofstream &of );
+    static void initialize( const Network &network, SchedulingContext &context, std::ofstream &of );
 
     /**
      * @brief reweight sources
@@ -57,12 +59,13 @@ class FocusCorners {
      *
      * @param subcon list of all scans
      * @param sourceList list of all sources
+     * @param context scheduling context
      * @param of log file stream
      * @param fraction fraction between best and worst mean elevation (used during iteration)
      * @param iteration iteration number
      */
-    static void reweight( const Subcon &subcon, SourceList &sourceList, std::ofstream &of, double fraction = 2.0,
-                          int iteration = 0 );
+    static void reweight( const Subcon &subcon, SourceList &sourceList, SchedulingContext &context, std::ofstream &of,
+                          double fraction = 2.0, int iteration = 0 );
 
     /**
      * @brief rest all weights and set new time for next algorithm start
@@ -70,20 +73,14 @@ class FocusCorners {
      *
      * @param bestScans list of all best scans (to see which corner was observed)
      * @param sourceList list of all sources
+     * @param context scheduling context
      */
-    static void reset( const std::vector<Scan> &bestScans, SourceList &sourceList );
+    static void reset( const std::vector<Scan> &bestScans, SourceList &sourceList, SchedulingContext &context );
 
-    static bool flag;                            ///< use focus corner algorithm
-    static thread_local int iscan;               ///< indedx of focus corner scans
-    static int nscans;                           ///< number of focus corner scans
-    static thread_local bool startFocusCorner;   ///< focus observation at corner
-    static thread_local unsigned int nextStart;  ///< next time when algorithm starts
-    static thread_local unsigned int interval;   ///< time intervall between algorithm
+    static bool flag;   ///< use focus corner algorithm
+    static int nscans;  ///< number of focus corner scans
 
    private:
-    static thread_local std::vector<double> lastCornerAzimuth;  ///< last observed azimuth (which corner was observed)
-    static thread_local std::vector<std::pair<int, double>> backupWeight;  ///< backup weights
-    static thread_local std::vector<int> staid2groupid;                    ///< station id to corner group id
 
     /**
      * @brief find n lowest values
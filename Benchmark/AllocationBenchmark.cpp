@@ -0,0 +1,180 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <random>
+
+#include "Benchmark.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+namespace {
+std::atomic<unsigned long> nAllocations{ 0 };  ///< number of heap allocations
+}  // namespace
+
+
+/**
+ * @brief replaced global allocation function which counts heap allocations
+ * @author Matthias Schartner
+ *
+ * @param size requested size in bytes
+ * @return allocated memory
+ */
+void *operator new( std::size_t size ) {
+    ++nAllocations;
+    void *p = std::malloc( size == 0 ? 1 : size );
+    if ( p == nullptr ) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+
+/**
+ * @brief replaced global deallocation function
+ * @author Matthias Schartner
+ *
+ * @param p memory
+ */
+void operator delete( void *p ) noexcept { std::free( p ); }
+
+
+/**
+ * @brief replaced global sized deallocation function
+ * @author Matthias Schartner
+ *
+ * @param p memory
+ */
+void operator delete( void *p, std::size_t ) noexcept { std::free( p ); }
+
+
+namespace {
+
+/**
+ * @brief source direction with the previous interface of AbstractSource::getSourceInCrs
+ * @author Matthias Schartner
+ *
+ * @param source source
+ * @param time time since session start
+ * @param pos station position
+ * @return right ascension, declination and unit vector in celestial reference frame
+ */
+pair<pair<double, double>, vector<double>> sourceInCrsVector( const AbstractSource &source, unsigned int time,
+                                                               const shared_ptr<const Position> &pos ) {
+    SourceDirection dir;
+    source.getSourceInCrs( time, pos, dir );
+    return { { dir.ra, dir.de }, vector<double>( dir.crs.begin(), dir.crs.end() ) };
+}
+
+}  // namespace
+
+
+void VieVS::addAllocationBenchmark( Benchmark &benchmark ) {
+    benchmark.add( "sourceDirection", "heap allocations of source direction and scan selection", []( Benchmark &b ) {
+        const Session &session = b.session();
+        const SourceList &sourceList = session.getSourceList();
+        Station station = session.getNetwork().getStation( 0 );
+        const shared_ptr<const Position> &pos = station.getPosition();
+        const auto &sources = sourceList.getSources();
+        const unsigned long nsrc = sources.size();
+
+        // epochs between the precalculated grid epochs
+        const unsigned long nepochs = 200;
+        mt19937 gen( 42 );
+        uniform_int_distribution<unsigned int> randomTime( 0, TimeSystem::duration / 2 );
+        vector<unsigned int> epochs( nepochs );
+        for ( auto &any : epochs ) {
+            any = 2 * randomTime( gen ) + 1;
+        }
+        const unsigned long n = nsrc * nepochs;
+
+        double sum = 0;
+        unsigned long allocVector = 0;
+        b.measure( "direction returned in vector", n, [&]() {
+            unsigned long before = nAllocations;
+            for ( unsigned int time : epochs ) {
+                for ( const auto &source : sources ) {
+                    sum += sourceInCrsVector( *source, time, pos ).second[2];
+                }
+            }
+            allocVector = nAllocations - before;
+        } );
+
+        unsigned long allocStruct = 0;
+        b.measure( "direction in SourceDirection", n, [&]() {
+            unsigned long before = nAllocations;
+            SourceDirection dir;
+            for ( unsigned int time : epochs ) {
+                for ( const auto &source : sources ) {
+                    source->getSourceInCrs( time, pos, dir );
+                    sum += dir.crs[2];
+                }
+            }
+            allocStruct = nAllocations - before;
+        } );
+
+        // a fresh copy per repetition so that every epoch is calculated and inserted into the precalculated values
+        unsigned long allocRigorous = 0;
+        b.measure( "Station::calcAzEl_rigorous", n, [&]() {
+            Station thisStation = station;
+            unsigned long before = nAllocations;
+            for ( unsigned int time : epochs ) {
+                for ( const auto &source : sources ) {
+                    PointingVector p( thisStation.getId(), source->getId() );
+                    p.setTime( time );
+                    thisStation.calcAzEl_rigorous( source, p );
+                    sum += p.getEl();
+                }
+            }
+            allocRigorous = nAllocations - before;
+        } );
+
+        // one scan selection step (candidate creation, score and selection of best scan) at several epochs
+        const unsigned long nselections = 10;
+        Network network = session.getNetwork();
+        const SchedulingContext &context = session.getContext();
+        unsigned long allocSelection = 0;
+        unsigned long nselected = 0;
+        b.measure( "scan selection step", nselections, [&]() {
+            unsigned long before = nAllocations;
+            for ( unsigned long i = 0; i < nselections; ++i ) {
+                auto time = static_cast<unsigned int>( i * ( TimeSystem::duration / nselections ) );
+                Subcon subcon = session.createSubcon( time );
+                subcon.generateScore( network, sourceList, context );
+                vector<Scan> bestScans = subcon.selectBest( network, sourceList, session.getMode(), context );
+                nselected += bestScans.size();
+            }
+            allocSelection = nAllocations - before;
+        } );
+
+        b.report( "checksum", sum, "-" );
+        b.report( "allocations per call (vector)", static_cast<double>( allocVector ) / n, "-" );
+        b.report( "allocations per call (SourceDirection)", static_cast<double>( allocStruct ) / n, "-" );
+        b.report( "allocations per call (calcAzEl_rigorous)", static_cast<double>( allocRigorous ) / n, "-" );
+        b.report( "allocations per scan selection", static_cast<double>( allocSelection ) / nselections, "-" );
+        b.check( "scans selected", nselected > 0 );
+        b.checkMax( "allocations of source direction", static_cast<double>( allocStruct ), 0 );
+        // only growth of the additional precalculated epochs remains
+        b.checkMax( "allocations per call of calcAzEl_rigorous", static_cast<double>( allocRigorous ) / n, 0.1 );
+    } );
+}
@@ -0,0 +1,82 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <random>
+
+#include "../Misc/LookupTable.h"
+#include "Benchmark.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+void VieVS::addAngularDistanceBenchmark( Benchmark &benchmark ) {
+    benchmark.add( "angularDistance", "accuracy and speed of angular distance lookup", []( Benchmark &b ) {
+        // random pairs of azimuth and elevation above the horizon
+        const unsigned long n = 1000000 * b.getScale();
+        mt19937 gen( 42 );
+        uniform_real_distribution<double> randomAz( 0, twopi );
+        uniform_real_distribution<double> randomEl( 0, halfpi );
+        vector<double> az1( n );
+        vector<double> el1( n );
+        vector<double> az2( n );
+        vector<double> el2( n );
+        for ( unsigned long i = 0; i < n; ++i ) {
+            az1[i] = randomAz( gen );
+            el1[i] = randomEl( gen );
+            az2[i] = randomAz( gen );
+            el2[i] = randomEl( gen );
+        }
+
+        vector<double> exact( n );
+        b.measure( "exact formula", n, [&]() {
+            for ( unsigned long i = 0; i < n; ++i ) {
+                double tmp = sin( el1[i] ) * sin( el2[i] ) + cos( el1[i] ) * cos( el2[i] ) * cos( az2[i] - az1[i] );
+                exact[i] = acos( max( -1.0, min( 1.0, tmp ) ) );
+            }
+        } );
+
+        for ( unsigned int stepsPerDegree : { 1u, 2u, 4u } ) {
+            string resolution = ( boost::format( "%.2f deg" ) % ( 1.0 / stepsPerDegree ) ).str();
+            LookupTable::initialize( stepsPerDegree );
+
+            vector<float> lookup( n );
+            b.measure( "lookup " + resolution, n, [&]() {
+                for ( unsigned long i = 0; i < n; ++i ) {
+                    lookup[i] = LookupTable::angularDistance( az1[i], el1[i], az2[i], el2[i] );
+                }
+            } );
+
+            double maxError = 0;
+            double sumError = 0;
+            for ( unsigned long i = 0; i < n; ++i ) {
+                double error = abs( lookup[i] - exact[i] ) * rad2deg;
+                maxError = max( maxError, error );
+                sumError += error;
+            }
+            b.report( "mean error " + resolution, sumError / n, "deg" );
+            // rounding of start elevation (half a step), elevation difference (half a step) and azimuth difference
+            // (half a step, scaled by the cosine of the elevation) to the grid
+            b.checkMax( "max error " + resolution, maxError, 1.6 / stepsPerDegree );
+        }
+
+        // default resolution as used by the scheduler
+        LookupTable::initialize();
+    } );
+}
@@ -0,0 +1,241 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <random>
+
+#include "../Station/AzElPrecalc.h"
+#include "Benchmark.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+namespace {
+
+/**
+ * @brief interpolation by linear search in list of pointing vectors (previous implementation of
+ * Station::calcAzEl_simple)
+ * @author Matthias Schartner
+ *
+ * @param precalc precalculated pointing vectors
+ * @param p pointing vector (time is used as input, azimuth, elevation, hour angle and declination are set)
+ */
+void interpolateLinearSearch( const vector<PointingVector> &precalc, PointingVector &p ) {
+    unsigned int time = p.getTime();
+
+    auto it_n = precalc.begin();
+    for ( ; it_n < precalc.end(); ++it_n ) {
+        if ( it_n->getTime() >= time ) {
+            break;
+        }
+    }
+    if ( it_n->getTime() == time ) {
+        p.setAz( it_n->getAz() );
+        p.setEl( it_n->getEl() );
+        p.setHa( it_n->getHa() );
+        p.setDc( it_n->getDc() );
+        return;
+    }
+
+    auto it_p = std::prev( it_n );
+    int dt = it_n->getTime() - it_p->getTime();
+    double factor = static_cast<double>( time - it_p->getTime() ) / static_cast<double>( dt );
+
+    double az1 = it_p->getAz();
+    double az2 = it_n->getAz();
+    double az;
+    if ( abs( az1 - az2 ) > halfpi ) {
+        if ( az1 < az2 ) {
+            az1 += twopi;
+        } else {
+            az2 += twopi;
+        }
+        az = it_p->getAz() + factor * ( it_n->getAz() - it_p->getAz() );
+        while ( az > twopi ) {
+            az -= twopi;
+        }
+    } else {
+        az = it_p->getAz() + factor * ( it_n->getAz() - it_p->getAz() );
+    }
+
+    double el = it_p->getEl() + factor * ( it_n->getEl() - it_p->getEl() );
+
+    double ha1 = it_p->getHa();
+    double ha2 = it_n->getHa();
+    double ha;
+    if ( abs( ha1 - ha2 ) > halfpi ) {
+        if ( ha1 < ha2 ) {
+            ha1 += twopi;
+        } else {
+            ha2 += twopi;
+        }
+        ha = it_p->getHa() + factor * ( it_n->getHa() - it_p->getHa() );
+        while ( ha > twopi ) {
+            ha -= twopi;
+        }
+    } else {
+        ha = it_p->getHa() + factor * ( it_n->getHa() - it_p->getHa() );
+    }
+
+    p.setAz( az );
+    p.setEl( el );
+    p.setHa( ha );
+    p.setDc( it_n->getDc() );
+}
+
+
+/**
+ * @brief exact match by linear search in list of pointing vectors (previous implementation of
+ * Station::calcAzEl_rigorous)
+ * @author Matthias Schartner
+ *
+ * @param precalc precalculated pointing vectors
+ * @param p pointing vector (time is used as input, azimuth, elevation, hour angle and declination are set)
+ * @return true if a value for this epoch is stored
+ */
+bool lookupLinearSearch( const vector<PointingVector> &precalc, PointingVector &p ) {
+    unsigned int time = p.getTime();
+    auto it = precalc.begin();
+    for ( ; it < precalc.end(); ++it ) {
+        if ( it->getTime() >= time ) {
+            break;
+        }
+    }
+    if ( it != precalc.end() && it->getTime() == time ) {
+        p.setAz( it->getAz() );
+        p.setEl( it->getEl() );
+        p.setHa( it->getHa() );
+        p.setDc( it->getDc() );
+        return true;
+    }
+    return false;
+}
+
+
+/**
+ * @brief synthetic pointing vector of one source
+ * @author Matthias Schartner
+ *
+ * @param srcid source id
+ * @param time time since session start
+ * @return pointing vector
+ */
+PointingVector synthetic( unsigned long srcid, unsigned int time ) {
+    PointingVector p( 0, srcid );
+    double phase = 0.1 * srcid + time * 7.2921e-5;
+    p.setTime( time );
+    p.setAz( fmod( phase + twopi, twopi ) );
+    p.setEl( 0.7 + 0.6 * sin( phase ) );
+    p.setHa( fmod( phase + pi, twopi ) );
+    p.setDc( -1.0 + 0.004 * srcid );
+    return p;
+}
+
+}  // namespace
+
+
+void VieVS::addAzElPrecalcBenchmark( Benchmark &benchmark ) {
+    benchmark.add( "azelPrecalc", "precalculated azimuth/elevation: time index vs linear search", []( Benchmark &b ) {
+        const unsigned int duration = 86400;
+        const unsigned int step = 600;
+        const unsigned long nsrc = 300 * b.getScale();
+        const unsigned long nextra = 200;
+        const unsigned long nquery = 1000000;
+
+        // grid epochs as filled in Initializer::precalcAzElStations, additional epochs as from scan selection
+        mt19937 gen( 42 );
+        uniform_int_distribution<unsigned int> randomTime( 0, duration );
+        vector<vector<PointingVector>> linear( nsrc );
+        vector<AzElPrecalc> indexed( nsrc );
+        for ( unsigned long isrc = 0; isrc < nsrc; ++isrc ) {
+            indexed[isrc].setGrid( step, duration + 1 );
+            for ( unsigned int t = 0; t <= duration; t += step ) {
+                linear[isrc].push_back( synthetic( isrc, t ) );
+                indexed[isrc].insert( linear[isrc].back() );
+            }
+            for ( unsigned long i = 0; i < nextra; ++i ) {
+                PointingVector p = synthetic( isrc, randomTime( gen ) );
+                if ( !indexed[isrc].lookup( p ) ) {
+                    linear[isrc].push_back( p );
+                    indexed[isrc].insert( p );
+                }
+            }
+        }
+
+        vector<PointingVector> queries;
+        queries.reserve( nquery );
+        uniform_int_distribution<unsigned long> randomSource( 0, nsrc - 1 );
+        for ( unsigned long i = 0; i < nquery; ++i ) {
+            PointingVector p( 0, randomSource( gen ) );
+            p.setTime( randomTime( gen ) );
+            queries.push_back( p );
+        }
+
+        vector<PointingVector> resultLinear = queries;
+        vector<PointingVector> resultIndexed = queries;
+        b.measure( "interpolate (linear search)", nquery, [&]() {
+            for ( auto &p : resultLinear ) {
+                interpolateLinearSearch( linear[p.getSrcid()], p );
+            }
+        } );
+        b.measure( "interpolate (time index)", nquery, [&]() {
+            for ( auto &p : resultIndexed ) {
+                indexed[p.getSrcid()].interpolate( p );
+            }
+        } );
+
+        double maxDiff = 0;
+        for ( unsigned long i = 0; i < nquery; ++i ) {
+            const auto &p1 = resultLinear[i];
+            const auto &p2 = resultIndexed[i];
+            maxDiff = max( { maxDiff, abs( p1.getAz() - p2.getAz() ), abs( p1.getEl() - p2.getEl() ),
+                             abs( p1.getHa() - p2.getHa() ), abs( p1.getDc() - p2.getDc() ) } );
+        }
+        b.checkMax( "interpolate: max difference [rad]", maxDiff, 0 );
+
+        unsigned long nLinear = 0;
+        unsigned long nIndexed = 0;
+        b.measure( "exact lookup (linear search)", nquery, [&]() {
+            nLinear = 0;
+            for ( auto &p : resultLinear ) {
+                nLinear += lookupLinearSearch( linear[p.getSrcid()], p );
+            }
+        } );
+        b.measure( "exact lookup (time index)", nquery, [&]() {
+            nIndexed = 0;
+            for ( auto &p : resultIndexed ) {
+                nIndexed += indexed[p.getSrcid()].lookup( p );
+            }
+        } );
+        b.report( "exact lookup hits (linear search)", nLinear, "-" );
+        b.report( "exact lookup hits (time index)", nIndexed, "-" );
+        b.check( "exact lookup finds all previous hits", nIndexed >= nLinear );
+
+        // moved-from objects are left with an empty grid and stay usable
+        AzElPrecalc moved( std::move( indexed[0] ) );
+        AzElPrecalc assigned;
+        assigned = std::move( indexed[1] );
+        AzElPrecalc copy( indexed[0] );
+        copy = indexed[1];
+        PointingVector p( 0, 0 );
+        p.setTime( 0 );
+        b.check( "moved-from objects empty", indexed[0].size() == 0 && indexed[1].size() == 0 && copy.size() == 0 &&
+                                                 !indexed[0].lookup( p ) && moved.size() > 0 && assigned.size() > 0 );
+    } );
+}
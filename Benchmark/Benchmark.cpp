@@ -0,0 +1,117 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Benchmark.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+Benchmark::Benchmark( int argc, char *argv[] ) {
+    for ( int i = 1; i < argc; ++i ) {
+        string arg = argv[i];
+        if ( arg == "--list" ) {
+            list_ = true;
+        } else if ( arg == "--repeat" && i + 1 < argc ) {
+            repeat_ = max( 1, stoi( argv[++i] ) );
+        } else if ( arg == "--scale" && i + 1 < argc ) {
+            scale_ = max( 1, stoi( argv[++i] ) );
+        } else if ( arg == "--prefix" && i + 1 < argc ) {
+            prefix_ = argv[++i];
+        } else {
+            select_.push_back( arg );
+        }
+    }
+}
+
+
+void Benchmark::add( const string &name, const string &description, function<void( Benchmark & )> run ) {
+    scenarios_.push_back( Scenario{ name, description, move( run ) } );
+}
+
+
+int Benchmark::run() {
+    for ( const auto &any : select_ ) {
+        if ( find_if( scenarios_.begin(), scenarios_.end(),
+                      [&any]( const Scenario &s ) { return s.name == any; } ) == scenarios_.end() ) {
+            cout << "unknown scenario " << any << "\n";
+            ++nFailed_;
+        }
+    }
+
+    for ( const auto &any : scenarios_ ) {
+        if ( !select_.empty() && find( select_.begin(), select_.end(), any.name ) == select_.end() ) {
+            continue;
+        }
+        if ( list_ ) {
+            cout << boost::format( "%-25s %s\n" ) % any.name % any.description;
+            continue;
+        }
+        cout << any.name << ": " << any.description << "\n";
+        auto start = chrono::steady_clock::now();
+        try {
+            any.run( *this );
+        } catch ( const exception &e ) {
+            check( string( "exception: " ) + e.what(), false );
+        }
+        auto end = chrono::steady_clock::now();
+        cout << boost::format( "    %-40s %12.3f [s]\n\n" ) % "total" % chrono::duration<double>( end - start ).count();
+    }
+
+    if ( !list_ ) {
+        cout << nFailed_ << " failed checks\n";
+    }
+    return nFailed_;
+}
+
+
+Session &Benchmark::session() {
+    if ( session_ == nullptr ) {
+        auto start = chrono::steady_clock::now();
+        session_ = unique_ptr<Session>( new Session( prefix_, scale_ ) );
+        auto end = chrono::steady_clock::now();
+        cout << boost::format( "    %-40s %12.3f [s]\n" ) % "create session" %
+                    chrono::duration<double>( end - start ).count();
+    }
+    return *session_;
+}
+
+
+void Benchmark::report( const string &label, double value, const string &unit ) {
+    cout << boost::format( "    %-40s %12.6g [%s]\n" ) % label % value % unit;
+}
+
+
+bool Benchmark::check( const string &label, bool ok ) {
+    cout << boost::format( "    %-40s %12s\n" ) % label % ( ok ? "ok" : "FAILED" );
+    if ( !ok ) {
+        ++nFailed_;
+    }
+    return ok;
+}
+
+
+bool Benchmark::checkMax( const string &label, double value, double tolerance ) {
+    bool ok = value <= tolerance;
+    cout << boost::format( "    %-40s %12.6g (max %g) %s\n" ) % label % value % tolerance % ( ok ? "ok" : "FAILED" );
+    if ( !ok ) {
+        ++nFailed_;
+    }
+    return ok;
+}
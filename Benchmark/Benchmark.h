@@ -0,0 +1,319 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file Benchmark.h
+ * @brief class Benchmark
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/format.hpp>
+
+#include "Session.h"
+
+
+namespace VieVS {
+
+/**
+ * @class Benchmark
+ * @brief collection of benchmark scenarios of performance critical parts of the scheduler
+ *
+ * Each scenario times an optimized code path, usually against a reference implementation of the previous approach,
+ * and checks that both produce the same results. The benchmark executable is only built if the CMake option
+ * VIESCHEDPP_BENCHMARK is set.
+ *
+ * Usage: VieSchedpp_benchmark [--list] [--repeat n] [--scale n] [--prefix path] [scenario ...]
+ *
+ * Scenarios which require a scheduling session use a synthetic session (see Session). Its catalogs are written to
+ * files starting with the given prefix (default "VieSchedpp_benchmark_").
+ *
+ * Without scenario names all scenarios are executed. The return value is the number of failed checks.
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+class Benchmark {
+   public:
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     *
+     * @param argc number of arguments
+     * @param argv argument list
+     */
+    Benchmark( int argc, char *argv[] );
+
+
+    /**
+     * @brief register a scenario
+     * @author Matthias Schartner
+     *
+     * @param name scenario name (used on command line)
+     * @param description short description
+     * @param run function executing the scenario
+     */
+    void add( const std::string &name, const std::string &description, std::function<void( Benchmark & )> run );
+
+
+    /**
+     * @brief execute all selected scenarios
+     * @author Matthias Schartner
+     *
+     * @return number of failed checks
+     */
+    int run();
+
+
+    /**
+     * @brief measure execution time
+     * @author Matthias Schartner
+     *
+     * The function is executed "repeat" times (see command line) and the fastest run is reported.
+     *
+     * @param label label in output
+     * @param n number of operations per call of function (used to report time per operation)
+     * @param f function to be timed
+     * @return fastest execution time in seconds
+     */
+    template <typename Function>
+    double measure( const std::string &label, unsigned long n, Function f ) {
+        double best = std::numeric_limits<double>::max();
+        for ( unsigned int i = 0; i < repeat_; ++i ) {
+            auto start = std::chrono::steady_clock::now();
+            f();
+            auto end = std::chrono::steady_clock::now();
+            best = std::min( best, std::chrono::duration<double>( end - start ).count() );
+        }
+        std::cout << boost::format( "    %-40s %12.3f [ms] %12.3f [ns/op]\n" ) % label % ( best * 1e3 ) %
+                         ( best * 1e9 / std::max( n, 1ul ) );
+        return best;
+    }
+
+
+    /**
+     * @brief report a value
+     * @author Matthias Schartner
+     *
+     * @param label label in output
+     * @param value value
+     * @param unit unit of value
+     */
+    void report( const std::string &label, double value, const std::string &unit );
+
+
+    /**
+     * @brief check a condition
+     * @author Matthias Schartner
+     *
+     * @param label label in output
+     * @param ok condition
+     * @return condition
+     */
+    bool check( const std::string &label, bool ok );
+
+
+    /**
+     * @brief check that a value does not exceed a tolerance
+     * @author Matthias Schartner
+     *
+     * @param label label in output
+     * @param value value
+     * @param tolerance maximum allowed value
+     * @return true if value does not exceed tolerance
+     */
+    bool checkMax( const std::string &label, double value, double tolerance );
+
+
+    /**
+     * @brief problem size factor
+     * @author Matthias Schartner
+     *
+     * @return problem size factor (default 1)
+     */
+    unsigned int getScale() const noexcept { return scale_; }
+
+
+    /**
+     * @brief prefix of generated files
+     * @author Matthias Schartner
+     *
+     * @return prefix of generated files
+     */
+    const std::string &getPrefix() const noexcept { return prefix_; }
+
+
+    /**
+     * @brief synthetic scheduling session
+     * @author Matthias Schartner
+     *
+     * The session is created on first use and shared by all scenarios.
+     *
+     * @return session
+     */
+    Session &session();
+
+
+   private:
+    /**
+     * @brief scenario
+     * @author Matthias Schartner
+     */
+    struct Scenario {
+        std::string name;                         ///< scenario name
+        std::string description;                  ///< short description
+        std::function<void( Benchmark & )> run;  ///< function executing the scenario
+    };
+
+    std::vector<Scenario> scenarios_;               ///< all registered scenarios
+    std::vector<std::string> select_;               ///< selected scenarios (empty for all)
+    bool list_ = false;                             ///< only list scenarios
+    unsigned int repeat_ = 3;                       ///< number of repetitions per measurement
+    unsigned int scale_ = 1;                        ///< problem size factor
+    std::string prefix_ = "VieSchedpp_benchmark_";  ///< prefix of generated files
+    std::unique_ptr<Session> session_;              ///< synthetic scheduling session
+    int nFailed_ = 0;                               ///< number of failed checks
+};
+
+
+/**
+ * @brief register azimuth/elevation lookup scenario
+ * @author Matthias Schartner
+ *
+ * @param benchmark benchmark
+ */
+void addAzElPrecalcBenchmark( Benchmark &benchmark );
+
+
+/**
+ * @brief register score kernel scenario
+ * @author Matthias Schartner
+ *
+ * @param benchmark benchmark
+ */
+void addScoreKernelBenchmark( Benchmark &benchmark );
+
+
+/**
+ * @brief register heap allocation scenario
+ * @author Matthias Schartner
+ *
+ * The benchmark executable replaces the global operator new to count heap allocations.
+ *
+ * @param benchmark benchmark
+ */
+void addAllocationBenchmark( Benchmark &benchmark );
+
+
+/**
+ * @brief register sidereal time scenario
+ * @author Matthias Schartner
+ *
+ * @param benchmark benchmark
+ */
+void addSiderealTimeBenchmark( Benchmark &benchmark );
+
+
+/**
+ * @brief register angular distance lookup scenario
+ * @author Matthias Schartner
+ *
+ * @param benchmark benchmark
+ */
+void addAngularDistanceBenchmark( Benchmark &benchmark );
+
+
+/**
+ * @brief register satellite ephemeris scenario
+ * @author Matthias Schartner
+ *
+ * @param benchmark benchmark
+ */
+void addSatelliteEphemerisBenchmark( Benchmark &benchmark );
+
+
+/**
+ * @brief register satellite visibility window scenario
+ * @author Matthias Schartner
+ *
+ * @param benchmark benchmark
+ */
+void addSatelliteWindowsBenchmark( Benchmark &benchmark );
+
+
+/**
+ * @brief register flux density model scenario
+ * @author Matthias Schartner
+ *
+ * @param benchmark benchmark
+ */
+void addFluxBenchmark( Benchmark &benchmark );
+
+
+/**
+ * @brief register compiled station tables scenario
+ * @author Matthias Schartner
+ *
+ * @param benchmark benchmark
+ */
+void addStationTablesBenchmark( Benchmark &benchmark );
+
+
+/**
+ * @brief register sked catalog reader scenario
+ * @author Matthias Schartner
+ *
+ * @param benchmark benchmark
+ */
+void addCatalogReaderBenchmark( Benchmark &benchmark );
+
+
+/**
+ * @brief register binary catalog bundle scenario
+ * @author Matthias Schartner
+ *
+ * @param benchmark benchmark
+ */
+void addCatalogBundleBenchmark( Benchmark &benchmark );
+
+
+/**
+ * @brief register eager vs lazy vs incremental scan selection scenario
+ * @author Matthias Schartner
+ *
+ * @param benchmark benchmark
+ */
+void addScanSelectionBenchmark( Benchmark &benchmark );
+
+}  // namespace VieVS
+
+#endif  // BENCHMARK_H
@@ -0,0 +1,169 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <utime.h>
+
+#include "../Input/SkdCatalogReader.h"
+#include "Benchmark.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+namespace {
+
+/**
+ * @brief check if two readers hold the same source and station catalogs
+ * @author Matthias Schartner
+ *
+ * @param a first reader
+ * @param b second reader
+ * @return true if catalogs, station keys and catalog versions are identical
+ */
+bool sameCatalogs( const SkdCatalogReader &a, const SkdCatalogReader &b ) {
+    bool same = a.getSourceCatalog().toMap() == b.getSourceCatalog().toMap() &&
+                a.getFluxCatalog().toMap() == b.getFluxCatalog().toMap() &&
+                a.getAntennaCatalog() == b.getAntennaCatalog() && a.getPositionCatalog() == b.getPositionCatalog() &&
+                a.getEquipCatalog() == b.getEquipCatalog() && a.getMaskCatalog() == b.getMaskCatalog();
+    for ( const auto &any : a.getAntennaCatalog() ) {
+        same &= a.positionKey( any.first ) == b.positionKey( any.first ) &&
+                a.equipKey( any.first ) == b.equipKey( any.first ) && a.maskKey( any.first ) == b.maskKey( any.first );
+    }
+    for ( const auto &any : { "source", "flux", "antenna", "position", "equip", "mask" } ) {
+        same &= a.getVersion( any ) == b.getVersion( any );
+    }
+    return same;
+}
+
+}  // namespace
+
+
+void VieVS::addCatalogBundleBenchmark( Benchmark &benchmark ) {
+    benchmark.add( "catalogBundle", "binary catalog bundle vs text catalogs", []( Benchmark &b ) {
+        // catalogs of full size (the sked source catalog contains some 10000 sources), every second station is used
+        const unsigned long nsta = 400;
+        const unsigned long nsrc = 20000 * b.getScale();
+        const string prefix = b.getPrefix() + "catalogBundle_";
+        map<string, string> catalogs = Session::writeCatalogs( prefix, nsta, nsrc );
+        const string bundle = prefix + "catalogs.bin";
+        // modes catalog does not exist when the bundle is written
+        const string modesFile = prefix + "modes.cat";
+        remove( modesFile.c_str() );
+        vector<string> staNames;
+        for ( unsigned long i = 0; i < nsta; i += 2 ) {
+            staNames.push_back( ( boost::format( "STA%04d" ) % i ).str() );
+        }
+
+        auto pathes = [&]( bool useBundle, bool verify ) {
+            boost::property_tree::ptree tree;
+            for ( const auto &any : { "antenna", "equip", "flux", "freq", "hdpos", "loif", "mask", "modes", "position",
+                                      "rec", "rx", "source", "tracks" } ) {
+                tree.put( any, catalogs.count( any ) ? catalogs[any] : "" );
+            }
+            tree.put( "modes", modesFile );
+            if ( useBundle ) {
+                tree.put( "bundle", bundle );
+                tree.put( "bundle.<xmlattr>.verify", verify );
+            }
+            return tree;
+        };
+        auto load = [&]( SkdCatalogReader &reader, bool useBundle, bool verify ) {
+            reader.setStationNames( staNames );
+            reader.setCatalogFilePathes( pathes( useBundle, verify ) );
+            reader.initializeStationCatalogs();
+            reader.initializeSourceCatalogs();
+        };
+
+        SkdCatalogReader writer;
+        writer.setCatalogFilePathes( pathes( true, false ) );
+        b.check( "bundle written", writer.writeBundle( bundle ) );
+        b.report( "bundle size", ifstream( bundle, ios::binary | ios::ate ).tellg() / 1e6, "MB" );
+
+        SkdCatalogReader text;
+        b.measure( "text catalogs", nsrc, [&]() {
+            text = SkdCatalogReader();
+            load( text, false, false );
+        } );
+        SkdCatalogReader cheap;
+        b.measure( "bundle (size and modification time)", nsrc, [&]() {
+            cheap = SkdCatalogReader();
+            load( cheap, true, false );
+        } );
+        SkdCatalogReader verified;
+        b.measure( "bundle (full verification)", nsrc, [&]() {
+            verified = SkdCatalogReader();
+            load( verified, true, true );
+        } );
+        b.check( "bundle used", cheap.isBundleLoaded() && verified.isBundleLoaded() );
+        b.check( "identical catalogs from bundle", sameCatalogs( text, cheap ) && sameCatalogs( text, verified ) );
+
+        // changed source name of same length with restored modification time, only found by full verification
+        const string &sourceFile = catalogs["source"];
+        struct stat status {};
+        stat( sourceFile.c_str(), &status );
+        {
+            fstream fid( sourceFile, ios::in | ios::out );
+            string line;
+            getline( fid, line );
+            fid.seekp( static_cast<long>( line.size() ) + 2 );
+            fid.put( 'X' );
+        }
+        struct utimbuf times {};
+        times.actime = status.st_atime;
+        times.modtime = status.st_mtime;
+        utime( sourceFile.c_str(), &times );
+        SkdCatalogReader unchanged;
+        load( unchanged, true, false );
+        SkdCatalogReader changed;
+        load( changed, true, true );
+        b.check( "same size and modification time accepted", unchanged.isBundleLoaded() );
+        b.check( "changed content found when verified",
+                 !changed.isBundleLoaded() && changed.getSourceCatalog().count( "X0000000" ) == 1 );
+
+        // changed size
+        ofstream( sourceFile, ios::app ) << "* appended comment\n";
+        SkdCatalogReader resized;
+        load( resized, true, false );
+        b.check( "changed size found", !resized.isBundleLoaded() );
+
+        // catalog created after the bundle was written
+        SkdCatalogReader rewriter;
+        rewriter.setCatalogFilePathes( pathes( true, false ) );
+        rewriter.writeBundle( bundle );
+        SkdCatalogReader before;
+        load( before, true, false );
+        ofstream( modesFile ) << "* VERSION benchmark\n";
+        SkdCatalogReader created;
+        load( created, true, false );
+        remove( modesFile.c_str() );
+        b.check( "created catalog found", before.isBundleLoaded() && !created.isBundleLoaded() );
+
+        // catalog deleted after the bundle was written
+        ofstream( modesFile ) << "* VERSION benchmark\n";
+        SkdCatalogReader modesWriter;
+        modesWriter.setCatalogFilePathes( pathes( true, false ) );
+        modesWriter.writeBundle( bundle );
+        remove( modesFile.c_str() );
+        SkdCatalogReader deleted;
+        load( deleted, true, false );
+        b.check( "deleted catalog found", !deleted.isBundleLoaded() );
+    } );
+}
@@ -0,0 +1,641 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fstream>
+
+#include "../Input/SkdCatalogReader.h"
+#include "Benchmark.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+namespace {
+
+/**
+ * @brief line based catalog reader of the previous implementation
+ * @author Matthias Schartner
+ *
+ * Copy of the previous SkdCatalogReader::readCatalog which reads each catalog with std::getline and splits every
+ * line into a vector of strings.
+ */
+class PreviousCatalogReader {
+   public:
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     *
+     * @param staNames names of required stations
+     */
+    explicit PreviousCatalogReader( vector<string> staNames ) : staNames_{ move( staNames ) } {}
+
+
+    /**
+     * @brief read a catalog
+     * @author Matthias Schartner
+     *
+     * Antenna catalog must be read before position, equip and mask catalog.
+     *
+     * @param type catalog type
+     * @param filepath catalog or .skd file
+     * @return catalog entries per key
+     */
+    map<string, vector<string>> readCatalog( SkdCatalogReader::CATALOG type, const string &filepath );
+
+
+    /**
+     * @brief catalog versions
+     * @author Matthias Schartner
+     *
+     * @return catalog version per catalog name
+     */
+    const map<string, string> &getVersions() const noexcept { return catalogsVersion_; }
+
+
+    /**
+     * @brief antenna key to position, equip and mask key
+     * @author Matthias Schartner
+     *
+     * @param staName antenna key
+     * @return position, equip and mask key
+     */
+    tuple<string, string, string> keys( const string &staName ) const {
+        return make_tuple( antennaKey2positionKey_.at( staName ), antennaKey2equipKey_.at( staName ),
+                           antennaKey2maskKey_.at( staName ) );
+    }
+
+
+   private:
+    vector<string> staNames_;                     ///< names of required stations
+    map<string, string> antennaKey2positionKey_;  ///< antenna key to position key
+    map<string, string> antennaKey2equipKey_;     ///< antenna key to equip key
+    map<string, string> antennaKey2maskKey_;      ///< antenna key 2 mask key
+    map<string, string> catalogsVersion_;         ///< skd catalog versions
+};
+
+
+map<string, vector<string>> PreviousCatalogReader::readCatalog( SkdCatalogReader::CATALOG type,
+                                                               const string &filepath ) {
+    using CATALOG = SkdCatalogReader::CATALOG;
+    map<string, vector<string>> all;
+    int indexOfKey = 0;
+
+    // index of key per catalog
+    switch ( type ) {
+        case CATALOG::antenna: {
+            indexOfKey = 1;
+            break;
+        }
+        case CATALOG::position: {
+            indexOfKey = 0;
+            break;
+        }
+        case CATALOG::equip: {
+            indexOfKey = 1;
+            break;
+        }
+        case CATALOG::mask: {
+            indexOfKey = 2;
+            break;
+        }
+        case CATALOG::source: {
+            indexOfKey = 0;
+            break;
+        }
+        case CATALOG::flux: {
+            indexOfKey = 0;
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+
+    bool fromSkdFile = false;
+    string skdFlag;
+    if ( filepath.length() > 4 && filepath.substr( filepath.length() - 4 ) == ".skd" ) {
+        fromSkdFile = true;
+        switch ( type ) {
+            case CATALOG::antenna:
+            case CATALOG::position:
+            case CATALOG::equip:
+            case CATALOG::mask: {
+                skdFlag = "$STATIONS";
+                break;
+            }
+            case CATALOG::source: {
+                skdFlag = "$SOURCES";
+                break;
+            }
+            case CATALOG::flux: {
+                skdFlag = "$FLUX";
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+
+    // read in CATALOG. antenna, position and equip use the same routine
+    switch ( type ) {
+        case CATALOG::antenna:
+        case CATALOG::position:
+        case CATALOG::equip:
+        case CATALOG::source: {
+            // open file
+            ifstream fid( filepath );
+            if ( !fid.is_open() ) {
+#ifdef VIESCHEDPP_LOG
+                BOOST_LOG_TRIVIAL( fatal ) << "unable to open " << filepath << " file";
+#else
+                cout << "[fatal] unable to open " << filepath << " file";
+#endif
+                terminate();
+            } else {
+                string line;
+                // if read from skd file read until you reach flag
+                if ( fromSkdFile ) {
+                    while ( getline( fid, line ) ) {
+                        if ( boost::trim_copy( line ) == skdFlag ) {
+                            break;
+                        }
+                    }
+                }
+                bool versionFound = false;
+                std::map<string, string> eqId2staName;
+                // loop through file
+                while ( getline( fid, line ) ) {
+                    if ( !versionFound && line.length() > 0 ) {
+                        vector<string> splitVector;
+                        boost::split( splitVector, line, boost::is_space(), boost::token_compress_on );
+                        if ( splitVector.size() >= 3 ) {
+                            if ( boost::to_lower_copy( splitVector.at( 1 ) ) == "version" ) {
+                                if ( type == CATALOG::antenna ) {
+                                    catalogsVersion_["antenna"] = splitVector.at( 2 );
+                                    versionFound = true;
+                                }
+                                if ( type == CATALOG::position ) {
+                                    catalogsVersion_["position"] = splitVector.at( 2 );
+                                    versionFound = true;
+                                }
+                                if ( type == CATALOG::equip ) {
+                                    catalogsVersion_["equip"] = splitVector.at( 2 );
+                                    versionFound = true;
+                                }
+                                if ( type == CATALOG::source ) {
+                                    catalogsVersion_["source"] = splitVector.at( 2 );
+                                    versionFound = true;
+                                }
+                            }
+                        }
+                    }
+
+                    line = boost::algorithm::trim_copy( line );
+                    if ( line.length() > 0 && line.at( 0 ) != '*' ) {
+                        // trim leading and trailing blanks
+                        if ( line.at( 0 ) == '$' ) {
+                            break;
+                        }
+
+                        std::size_t pos = line.find( "*" );
+                        if ( pos != string::npos ) {
+                            line = line.substr( 0, pos );
+                            line = boost::algorithm::trim_copy( line );
+                        }
+
+                        vector<string> splitVector;
+                        boost::split( splitVector, line, boost::is_space(), boost::token_compress_on );
+
+                        if ( fromSkdFile && type == CATALOG::antenna && line.at( 0 ) != 'A' ) {
+                            continue;
+                        }
+                        if ( fromSkdFile && type == CATALOG::position && line.at( 0 ) != 'P' ) {
+                            continue;
+                        }
+                        if ( fromSkdFile && type == CATALOG::equip && line.at( 0 ) != 'T' ) {
+                            if ( line.at( 0 ) == 'A' ) {
+                                eqId2staName[boost::algorithm::to_upper_copy( splitVector[15] )] = splitVector[2];
+                            }
+                            continue;
+                        }
+                        if ( fromSkdFile && type != CATALOG::source ) {
+                            splitVector.erase( splitVector.begin() );
+                        }
+                        if ( fromSkdFile && type == CATALOG::equip ) {
+                            splitVector.insert(
+                                splitVector.begin(),
+                                eqId2staName[boost::algorithm::to_upper_copy( splitVector[indexOfKey - 1] )] );
+                        }
+
+                        if ( type == CATALOG::equip && ( splitVector.size() < 6 || splitVector[5] == "C" ) ) {
+                            continue;
+                        }
+
+                        // get key and convert it to upper case for case insensitivity
+                        string key = splitVector[indexOfKey];
+                        // add station name to key if you look at equip.cat because id alone is not unique in catalogs
+                        if ( type == CATALOG::equip ) {
+                            key = boost::algorithm::to_upper_copy(
+                                key.append( "|" ).append( splitVector[indexOfKey - 1] ) );
+                        }
+
+                        // save all station keys in case of antenna catalog
+                        if ( type == CATALOG::antenna ) {
+                            // look if this station is really required
+                            if ( find( staNames_.begin(), staNames_.end(), key ) == staNames_.end() ) {
+                                continue;
+                            }
+                            antennaKey2positionKey_[key] = splitVector.at( 13 );
+                            string id_EQ = boost::algorithm::to_upper_copy( splitVector.at( 14 ) + "|" + key );
+                            antennaKey2equipKey_[key] = id_EQ;
+                            if ( splitVector.size() == 16 ) {
+                                antennaKey2maskKey_[key] = splitVector.at( 15 );
+                            } else {
+                                antennaKey2maskKey_[key] = "--";
+                            }
+                        } else if ( type == CATALOG::position ) {
+                            if ( !util::valueExists( antennaKey2positionKey_, key ) ) {
+                                continue;
+                            }
+                        } else if ( type == CATALOG::equip ) {
+                            if ( !util::valueExists( antennaKey2equipKey_, key ) ) {
+                                continue;
+                            }
+                        } else if ( type == CATALOG::mask ) {
+                            if ( !util::valueExists( antennaKey2maskKey_, key ) ) {
+                                continue;
+                            }
+                        }
+
+                        // look if a key already exists, if not add it.
+                        if ( all.find( key ) == all.end() ) {
+                            all.insert( pair<string, vector<string>>( key, splitVector ) );
+                        } else {
+#ifdef VIESCHEDPP_LOG
+                            BOOST_LOG_TRIVIAL( warning )
+                                << "duplicated element of '" << key << "' in " << filepath << " -> ignored";
+#else
+                            cout << "[warning] duplicated element of '" << key << "' in " << filepath << " -> ignored";
+#endif
+                        }
+                    }
+                }
+            }
+            // close file
+            fid.close();
+            break;
+        }
+
+        case CATALOG::mask: {
+            // open file
+            ifstream fid( filepath );
+            if ( !fid.is_open() ) {
+#ifdef VIESCHEDPP_LOG
+                BOOST_LOG_TRIVIAL( fatal ) << "unable to open " << filepath;
+#else
+                cout << "[fatal] unable to open " << filepath;
+#endif
+                terminate();
+            } else {
+                string line;
+                // if read from skd file read until you reach flag
+                if ( fromSkdFile ) {
+                    while ( getline( fid, line ) ) {
+                        if ( boost::trim_copy( line ) == skdFlag ) {
+                            break;
+                        }
+                    }
+                }
+                vector<string> splitVector_total;
+
+                bool versionFound = false;
+                // loop through CATALOG
+                while ( getline( fid, line ) ) {
+                    if ( !versionFound && line.length() > 0 ) {
+                        vector<string> splitVector;
+                        boost::split( splitVector, line, boost::is_space(), boost::token_compress_on );
+                        if ( splitVector.size() >= 3 ) {
+                            if ( boost::to_lower_copy( splitVector.at( 1 ) ) == "version" ) {
+                                catalogsVersion_["mask"] = splitVector.at( 2 );
+                                versionFound = true;
+                            }
+                        }
+                    }
+
+                    line = boost::algorithm::trim_copy( line );
+                    if ( line.length() > 0 && line.at( 0 ) != '*' ) {
+                        // trim leading and trailing blanks
+                        if ( line.at( 0 ) == '$' ) {
+                            break;
+                        }
+                        if ( fromSkdFile && line.at( 0 ) != 'H' ) {
+                            continue;
+                        }
+
+                        // if first element is not an '-' this line belongs to new station mask
+                        if ( line.at( 0 ) != '-' && !splitVector_total.empty() ) {
+                            if ( fromSkdFile ) {
+                                splitVector_total.insert( splitVector_total.begin() + 1, " " );
+                            }
+
+                            // get key and convert it to upper case for case insensitivity
+                            string key = splitVector_total[indexOfKey];
+
+                            // previous mask is finished, add it to map
+                            all.insert( pair<string, vector<string>>( key, splitVector_total ) );
+                            splitVector_total.clear();
+                        }
+
+                        // split vector
+                        vector<string> splitVector;
+                        boost::split( splitVector, line, boost::is_space(), boost::token_compress_on );
+
+                        // if it is a new mask add all elements to vector, if not start at the 2nd element (ignore '-')
+                        if ( splitVector_total.empty() ) {
+                            splitVector_total.insert( splitVector_total.end(), splitVector.begin(), splitVector.end() );
+                        } else {
+                            splitVector_total.insert( splitVector_total.end(), splitVector.begin() + 1,
+                                                      splitVector.end() );
+                        }
+                    }
+                }
+
+                if ( fromSkdFile && !splitVector_total.empty() ) {
+                    splitVector_total.insert( splitVector_total.begin() + 1, " " );
+                } else {
+                    return all;
+                }
+                string key = splitVector_total[indexOfKey];
+
+                all.insert( pair<string, vector<string>>( key, splitVector_total ) );
+            }
+            break;
+        }
+
+        case CATALOG::flux: {
+            // open file
+            ifstream fid( filepath );
+            if ( !fid.is_open() ) {
+#ifdef VIESCHEDPP_LOG
+                BOOST_LOG_TRIVIAL( fatal ) << "unable to open " << filepath;
+#else
+                cout << "[fatal] unable to open " << filepath;
+#endif
+                terminate();
+            } else {
+                string line;
+                vector<string> lines;
+                // if read from skd file read until you reach flag
+                if ( fromSkdFile ) {
+                    while ( getline( fid, line ) ) {
+                        if ( boost::trim_copy( line ) == skdFlag ) {
+                            break;
+                        }
+                    }
+                }
+                vector<string> splitVector_total;
+                string sourceName;
+
+                bool versionFound = false;
+                // get first entry
+                while ( getline( fid, line ) ) {
+                    line = boost::algorithm::trim_copy( line );
+                    if ( !versionFound && line.length() > 0 ) {
+                        vector<string> splitVector;
+                        boost::split( splitVector, line, boost::is_space(), boost::token_compress_on );
+                        if ( splitVector.size() >= 3 ) {
+                            if ( boost::to_lower_copy( splitVector.at( 1 ) ) == "version" ) {
+                                catalogsVersion_["flux"] = splitVector.at( 2 );
+                                versionFound = true;
+                            }
+                        }
+                    }
+
+                    if ( line.length() > 0 && line.at( 0 ) != '*' ) {
+                        boost::split( splitVector_total, line, boost::is_space(), boost::token_compress_on );
+                        sourceName = splitVector_total[indexOfKey];
+                        lines.push_back( line );
+                        break;
+                    }
+                }
+
+                // loop through CATALOG
+                while ( getline( fid, line ) ) {
+                    // trim leading and trailing blanks
+                    line = boost::algorithm::trim_copy( line );
+                    if ( line.length() > 0 && line.at( 0 ) != '*' ) {
+                        if ( line.at( 0 ) == '$' ) {
+                            break;
+                        }
+
+                        vector<string> splitVector;
+                        boost::split( splitVector, line, boost::is_space(), boost::token_compress_on );
+                        string newStation = splitVector[indexOfKey];
+
+                        if ( newStation == sourceName ) {
+                            lines.push_back( line );
+                            splitVector_total.insert( splitVector_total.end(), splitVector.begin(), splitVector.end() );
+                        } else {
+                            all.insert( pair<string, vector<string>>( sourceName, lines ) );
+                            lines.clear();
+                            lines.push_back( line );
+                            sourceName = newStation;
+                            splitVector_total = splitVector;
+                        }
+                    }
+                }
+                all.insert( pair<string, vector<string>>( sourceName, lines ) );
+            }
+            break;
+        }
+
+        default: {
+            break;
+        }
+    }
+
+    return all;
+}
+
+
+/**
+ * @brief non-comment lines of a catalog split at blanks
+ * @author Matthias Schartner
+ *
+ * @param file catalog file
+ * @return fields of all lines
+ */
+vector<vector<string>> catalogLines( const string &file ) {
+    vector<vector<string>> all;
+    ifstream fid( file );
+    string line;
+    while ( getline( fid, line ) ) {
+        boost::trim( line );
+        if ( line.empty() || line[0] == '*' ) {
+            continue;
+        }
+        vector<string> splitVector;
+        boost::split( splitVector, line, boost::is_space(), boost::token_compress_on );
+        all.push_back( splitVector );
+    }
+    return all;
+}
+
+
+/**
+ * @brief write the content of text catalogs as .skd file
+ * @author Matthias Schartner
+ *
+ * Station entries are identified by a two letter code in the $STATIONS block, as in .skd files written by sked.
+ *
+ * @param catalogs catalog file per catalog name (see Session::writeCatalogs)
+ * @param file .skd file
+ */
+void writeSkd( const map<string, string> &catalogs, const string &file ) {
+    ofstream skd( file );
+    auto write = [&skd]( const vector<string> &fields, unsigned long start ) {
+        for ( unsigned long i = start; i < fields.size(); ++i ) {
+            skd << " " << fields[i];
+        }
+        skd << "\n";
+    };
+
+    skd << "$EXPER benchmark\n$SOURCES\n";
+    for ( const auto &fields : catalogLines( catalogs.at( "source" ) ) ) {
+        write( fields, 0 );
+    }
+
+    skd << "$STATIONS\n";
+    vector<vector<string>> position = catalogLines( catalogs.at( "position" ) );
+    map<string, string> positionKey2code;
+    for ( const auto &fields : position ) {
+        positionKey2code[fields[0]] = fields[1];
+    }
+    map<string, string> staName2code;
+    for ( auto fields : catalogLines( catalogs.at( "antenna" ) ) ) {
+        const string code = positionKey2code[fields[13]];
+        staName2code[fields[1]] = code;
+        fields[13] = code;
+        fields[14] = code;
+        skd << "A " << code;
+        write( fields, 1 );
+    }
+    for ( const auto &fields : position ) {
+        skd << "P " << fields[1];
+        write( fields, 2 );
+    }
+    for ( const auto &fields : catalogLines( catalogs.at( "equip" ) ) ) {
+        skd << "T " << staName2code[fields[0]];
+        write( fields, 2 );
+    }
+    for ( const auto &fields : catalogLines( catalogs.at( "mask" ) ) ) {
+        skd << "H " << fields[0];
+        write( fields, 3 );
+    }
+
+    skd << "$FLUX\n";
+    for ( const auto &fields : catalogLines( catalogs.at( "flux" ) ) ) {
+        write( fields, 0 );
+    }
+    skd << "$HEAD\n";
+}
+
+}  // namespace
+
+
+void VieVS::addCatalogReaderBenchmark( Benchmark &benchmark ) {
+    benchmark.add( "catalogReader", "memory mapped catalog reader vs previous line based reader", []( Benchmark &b ) {
+        using CATALOG = SkdCatalogReader::CATALOG;
+
+        // catalogs of full size (the sked source catalog contains some 10000 sources), every second station is used
+        const unsigned long nsta = 400;
+        const unsigned long nsrc = 20000 * b.getScale();
+        map<string, string> catalogs = Session::writeCatalogs( b.getPrefix() + "catalogReader_", nsta, nsrc );
+        const string skdFile = b.getPrefix() + "catalogReader.skd";
+        writeSkd( catalogs, skdFile );
+        vector<string> staNames;
+        for ( unsigned long i = 0; i < nsta; i += 2 ) {
+            staNames.push_back( ( boost::format( "STA%04d" ) % i ).str() );
+        }
+
+        // same order as in initializeSourceCatalogs and initializeStationCatalogs
+        const vector<pair<CATALOG, string>> types = { { CATALOG::source, "source" },
+                                                      { CATALOG::flux, "flux" },
+                                                      { CATALOG::antenna, "antenna" },
+                                                      { CATALOG::position, "position" },
+                                                      { CATALOG::equip, "equip" },
+                                                      { CATALOG::mask, "mask" } };
+
+        for ( bool fromSkdFile : { false, true } ) {
+            string format = fromSkdFile ? ".skd" : ".cat";
+
+            map<string, map<string, vector<string>>> previous;
+            unique_ptr<PreviousCatalogReader> previousReader;
+            b.measure( "previous reader " + format, nsrc, [&]() {
+                previousReader.reset( new PreviousCatalogReader( staNames ) );
+                for ( const auto &any : types ) {
+                    previous[any.second] =
+                        previousReader->readCatalog( any.first, fromSkdFile ? skdFile : catalogs[any.second] );
+                }
+            } );
+
+            SkdCatalogReader reader;
+            reader.setStationNames( staNames );
+            if ( fromSkdFile ) {
+                reader.setCatalogFilePathes( skdFile );
+            } else {
+                reader.setCatalogFilePathes( catalogs["antenna"], catalogs["equip"], catalogs["flux"], "", "", "",
+                                             catalogs["mask"], "", catalogs["position"], "", "", catalogs["source"],
+                                             "" );
+            }
+            b.measure( "SkdCatalogReader " + format, nsrc, [&]() {
+                reader.initializeSourceCatalogs();
+                reader.initializeStationCatalogs();
+            } );
+
+            b.report( "sources " + format, reader.getSourceCatalog().size(), "-" );
+            b.report( "stations " + format, reader.getAntennaCatalog().size(), "-" );
+            b.check( "position and equip of all stations " + format,
+                     reader.getPositionCatalog().size() == staNames.size() &&
+                         reader.getEquipCatalog().size() == staNames.size() );
+            b.check( "identical source catalog " + format, reader.getSourceCatalog().toMap() == previous["source"] );
+            b.check( "identical flux catalog " + format, reader.getFluxCatalog().toMap() == previous["flux"] );
+            b.check( "identical antenna catalog " + format, reader.getAntennaCatalog() == previous["antenna"] );
+            b.check( "identical position catalog " + format, reader.getPositionCatalog() == previous["position"] );
+            b.check( "identical equip catalog " + format, reader.getEquipCatalog() == previous["equip"] );
+            b.check( "identical mask catalog " + format, reader.getMaskCatalog() == previous["mask"] );
+
+            bool sameKeys = true;
+            for ( const auto &any : reader.getAntennaCatalog() ) {
+                sameKeys &= make_tuple( reader.positionKey( any.first ), reader.equipKey( any.first ),
+                                        reader.maskKey( any.first ) ) == previousReader->keys( any.first );
+            }
+            b.check( "identical station keys " + format, sameKeys );
+
+            bool sameVersions = true;
+            for ( const auto &any : types ) {
+                const auto &versions = previousReader->getVersions();
+                auto it = versions.find( any.second );
+                sameVersions &= reader.getVersion( any.second ) == ( it == versions.end() ? "Unknown" : it->second );
+            }
+            b.check( "identical catalog versions " + format, sameVersions );
+        }
+    } );
+}
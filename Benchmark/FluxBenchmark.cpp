@@ -0,0 +1,170 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <random>
+
+#include "../Source/Flux/Flux_B.h"
+#include "../Source/Flux/Flux_M.h"
+#include "Benchmark.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+namespace {
+
+/**
+ * @brief model flux component parameters
+ * @author Matthias Schartner
+ */
+struct Components {
+    vector<double> flux;           ///< flux density in jansky
+    vector<double> majorAxis;      ///< major axis in radians
+    vector<double> axialRatio;     ///< axial ratio
+    vector<double> positionAngle;  ///< position angle in radians
+};
+
+
+/**
+ * @brief observed flux density of model M as calculated by the previous implementation
+ * @author Matthias Schartner
+ *
+ * @param c model components
+ * @param wavelength wavelength in meters
+ * @param u projected baseline length u
+ * @param v projected baseline length v
+ * @return observed flux density in jansky
+ */
+double referenceFluxM( const Components &c, double wavelength, double u, double v ) {
+    const double flcon1 = ( pi * pi ) / ( 4.0 * 0.6931471 );
+    double observedFlux = 0;
+
+    double u_w = u / wavelength;
+    double v_w = v / wavelength;
+
+    for ( unsigned long i = 0; i < c.flux.size(); ++i ) {
+        double pa = c.positionAngle[i];
+        double ucospa = u_w * cos( pa );
+        double usinpa = u_w * sin( pa );
+        double vcospa = v_w * cos( pa );
+        double vsinpa = v_w * sin( pa );
+
+        double arg1 = ( vcospa + usinpa ) * ( vcospa + usinpa );
+        double arg2 = ( c.axialRatio[i] * ( ucospa - vsinpa ) ) * ( c.axialRatio[i] * ( ucospa - vsinpa ) );
+        double arg = -flcon1 * ( arg1 + arg2 ) * c.majorAxis[i] * c.majorAxis[i];
+        observedFlux += c.flux[i] * exp( arg );
+    }
+
+    return observedFlux;
+}
+
+
+/**
+ * @brief observed flux density of model B as calculated by the previous implementation
+ * @author Matthias Schartner
+ *
+ * @param knots baseline lengths in kilometers
+ * @param values flux densities in jansky
+ * @param u projected baseline length u
+ * @param v projected baseline length v
+ * @return observed flux density in jansky
+ */
+double referenceFluxB( const vector<double> &knots, const vector<double> &values, double u, double v ) {
+    double pbase = sqrt( u * u + v * v ) / 1000.0;
+    for ( unsigned long i = 1; i < knots.size(); ++i ) {
+        if ( knots[i] > pbase ) {
+            return values[i - 1];
+        }
+    }
+    return 0;
+}
+
+}  // namespace
+
+
+void VieVS::addFluxBenchmark( Benchmark &benchmark ) {
+    benchmark.add( "fluxModel", "flux density models: previous vs scalar vs batched evaluation", []( Benchmark &b ) {
+        const double wavelength = 0.0349;
+        const double flcon2 = pi / ( 3600.0 * 180.0 * 1000.0 );
+
+        // projected baselines up to 12000 km
+        const unsigned long n = 100000 * b.getScale();
+        mt19937 gen( 42 );
+        uniform_real_distribution<double> uniform( 0, 1 );
+        vector<double> u( n );
+        vector<double> v( n );
+        for ( unsigned long i = 0; i < n; ++i ) {
+            u[i] = ( 2 * uniform( gen ) - 1 ) * 12e6;
+            v[i] = ( 2 * uniform( gen ) - 1 ) * 12e6;
+        }
+
+        for ( unsigned long ncomp : { 1ul, 3ul, 6ul } ) {
+            string name = "M " + to_string( ncomp ) + " components";
+            Components c;
+            for ( unsigned long i = 0; i < ncomp; ++i ) {
+                c.flux.push_back( 0.2 + 2 * uniform( gen ) );
+                c.majorAxis.push_back( ( 0.05 + 2 * uniform( gen ) ) * flcon2 );
+                c.axialRatio.push_back( 0.2 + 0.8 * uniform( gen ) );
+                c.positionAngle.push_back( 180 * uniform( gen ) * deg2rad );
+            }
+            Flux_M model( wavelength, c.flux, c.majorAxis, c.axialRatio, c.positionAngle );
+
+            vector<double> reference( n );
+            vector<double> scalar( n );
+            vector<double> batched( n );
+            b.measure( name + " previous", n, [&]() {
+                for ( unsigned long i = 0; i < n; ++i ) {
+                    reference[i] = referenceFluxM( c, wavelength, u[i], v[i] );
+                }
+            } );
+            b.measure( name + " scalar", n, [&]() {
+                for ( unsigned long i = 0; i < n; ++i ) {
+                    scalar[i] = model.observedFlux( u[i], v[i] );
+                }
+            } );
+            b.measure( name + " batched", n, [&]() { model.observedFlux( n, u.data(), v.data(), batched.data() ); } );
+
+            double maxDiff = 0;
+            double maxDiffBatched = 0;
+            for ( unsigned long i = 0; i < n; ++i ) {
+                maxDiff = max( maxDiff, abs( scalar[i] - reference[i] ) );
+                maxDiffBatched = max( maxDiffBatched, abs( batched[i] - scalar[i] ) );
+            }
+            b.checkMax( name + " scalar vs previous [Jy]", maxDiff, 1e-12 );
+            b.checkMax( name + " batched vs scalar [Jy]", maxDiffBatched, 1e-12 );
+        }
+
+        vector<double> knots = { 0, 1000, 3000, 7000, 13000 };
+        vector<double> values = { 2.1, 1.4, 0.9, 0.5, 0.3 };
+        Flux_B model( wavelength, knots, values );
+        vector<double> reference( n );
+        vector<double> scalar( n );
+        b.measure( "B previous", n, [&]() {
+            for ( unsigned long i = 0; i < n; ++i ) {
+                reference[i] = referenceFluxB( knots, values, u[i], v[i] );
+            }
+        } );
+        b.measure( "B scalar", n, [&]() {
+            for ( unsigned long i = 0; i < n; ++i ) {
+                scalar[i] = model.observedFlux( u[i], v[i] );
+            }
+        } );
+        b.check( "B identical to previous", scalar == reference );
+    } );
+}
@@ -0,0 +1,138 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Benchmark.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+namespace {
+
+/**
+ * @brief topocentric satellite position
+ * @author Matthias Schartner
+ *
+ * @param satellite satellite
+ * @param time time since session start
+ * @param pos station position
+ * @return position in meters
+ */
+array<double, 3> topocentric( const Satellite &satellite, unsigned int time, const shared_ptr<const Position> &pos ) {
+    double ra, de, r, dt;
+    tie( ra, de, r, dt ) = satellite.calcRaDeDistTime( time, pos );
+    return { r * cos( de ) * cos( ra ), r * cos( de ) * sin( ra ), r * sin( de ) };
+}
+
+}  // namespace
+
+
+void VieVS::addSatelliteEphemerisBenchmark( Benchmark &benchmark ) {
+    benchmark.add( "satelliteEphemeris", "tabulated satellite orbits vs direct propagation", []( Benchmark &b ) {
+        const Session &session = b.session();
+        shared_ptr<const Position> pos = session.getNetwork().getStation( 0 ).getPosition();
+        const unsigned int end = TimeSystem::duration + 1800;
+        const unsigned int minStep = 15;
+
+        struct Orbit {
+            string name;
+            double inclination, node, eccentricity, perigee, anomaly, meanMotion;
+        };
+        vector<Orbit> orbits = { { "LEO", 53.0, 120.0, 0.0001, 90.0, 0.0, 15.06 },
+                                 { "MEO", 55.0, 40.0, 0.005, 30.0, 10.0, 2.0056 },
+                                 { "GEO", 0.05, 80.0, 0.0002, 270.0, 100.0, 1.0027 },
+                                 { "HEO", 63.4, 200.0, 0.72, 270.0, 0.0, 2.006 } };
+
+        for ( const auto &orbit : orbits ) {
+            shared_ptr<Satellite> direct =
+                Session::createSatellite( orbit.name, orbit.inclination, orbit.node, orbit.eccentricity, orbit.perigee,
+                                          orbit.anomaly, orbit.meanMotion );
+            Satellite tabulated = *direct;
+            b.measure( "tabulate " + orbit.name, 1, [&]() { tabulated.precalcEphemeris( end, 60, 1e-3, minStep ); } );
+
+            double sum = 0;
+            b.measure( "direct " + orbit.name, end, [&]() {
+                for ( unsigned int t = 0; t < end; ++t ) {
+                    sum += get<0>( direct->calcRaDeDistTime( t, pos ) );
+                }
+            } );
+            b.measure( "interpolated " + orbit.name, end, [&]() {
+                for ( unsigned int t = 0; t < end; ++t ) {
+                    sum += get<0>( tabulated.calcRaDeDistTime( t, pos ) );
+                }
+            } );
+
+            // error of every second compared to the error recorded at the middle of each interval
+            double maxError = 0;
+            for ( unsigned int t = 0; t < end; ++t ) {
+                array<double, 3> x1 = topocentric( *direct, t, pos );
+                array<double, 3> x2 = topocentric( tabulated, t, pos );
+                maxError = max( maxError, sqrt( ( x1[0] - x2[0] ) * ( x1[0] - x2[0] ) +
+                                                ( x1[1] - x2[1] ) * ( x1[1] - x2[1] ) +
+                                                ( x1[2] - x2[2] ) * ( x1[2] - x2[2] ) ) );
+            }
+            unsigned int step = tabulated.getEphemerisStep();
+            double recorded = tabulated.getEphemerisError() * 1e3;
+            b.report( "checksum " + orbit.name, sum, "-" );
+            b.report( "grid spacing " + orbit.name, step, "s" );
+            b.report( "memory " + orbit.name, ( end / step + 2 ) * 56 / 1024.0, "kB" );
+            b.report( "recorded error " + orbit.name, recorded, "m" );
+            b.report( "error 1 s scan " + orbit.name, maxError, "m" );
+            b.check( "grid spacing " + orbit.name + " at least minimum", step >= minStep );
+            b.check( "recorded error " + orbit.name + " covers 1 s scan", maxError <= 1.5 * recorded + 1e-3 );
+        }
+
+        // refinement down to the minimum grid spacing reuses the coarse epochs and records the error actually reached
+        shared_ptr<Satellite> leo = Session::createSatellite( "LEO", 53.0, 120.0, 0.0001, 90.0, 0.0, 15.06 );
+        Satellite refined = *leo;
+        Satellite fine = *leo;
+        b.measure( "tabulate LEO refined to 1 mm", 1,
+                   [&]() { refined.precalcEphemeris( end, 60, 1e-6, minStep ); } );
+        b.measure( "tabulate LEO at minimum spacing", 1, [&]() { fine.precalcEphemeris( end, minStep, 1e3 ); } );
+        bool same = true;
+        for ( unsigned int t = 0; t < end; ++t ) {
+            same = same && refined.calcRaDeDistTime( t, pos ) == fine.calcRaDeDistTime( t, pos );
+        }
+        b.report( "recorded error refined", refined.getEphemerisError() * 1e3, "m" );
+        b.check( "refinement stops at minimum spacing", refined.getEphemerisStep() == minStep );
+        b.check( "error above target is recorded", refined.getEphemerisError() > 1e-6 );
+        b.check( "refined table equals table at minimum spacing", same );
+
+        // independent satellites are tabulated in parallel
+        vector<shared_ptr<Satellite>> satellites;
+        for ( unsigned long i = 0; i < 64 * b.getScale(); ++i ) {
+            satellites.push_back( Session::createSatellite( "SAT" + to_string( i ), 53.0, 5.625 * i, 0.0001, 90.0,
+                                                            2.8125 * i, 15.06 ) );
+        }
+        auto n = static_cast<long>( satellites.size() );
+        b.measure( "tabulate satellites serial", n, [&]() {
+            for ( long i = 0; i < n; ++i ) {
+                satellites[i]->precalcEphemeris( end );
+            }
+        } );
+        b.measure( "tabulate satellites parallel", n, [&]() {
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic )
+#endif
+            for ( long i = 0; i < n; ++i ) {
+                satellites[i]->precalcEphemeris( end );
+            }
+        } );
+    } );
+}
@@ -0,0 +1,150 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../Misc/AvoidSatellites.h"
+#include "Benchmark.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+namespace {
+
+/**
+ * @brief visibility windows with the previous step bound (without rotation of the local horizon)
+ * @author Matthias Schartner
+ *
+ * @param sta station
+ * @param sat satellite
+ * @return visibility windows
+ */
+vector<AvoidSatellites::Window> windowsWithoutRotation( Station &sta, const shared_ptr<Satellite> &sat ) {
+    const double maxVelocity = 11.2e3 + 0.47e3;
+    vector<AvoidSatellites::Window> windows;
+    PointingVector pv( sta.getId(), sat->getId() );
+
+    bool visible = false;
+    unsigned int startTime = 0;
+    unsigned int previous = 0;
+    unsigned int t = 0;
+    while ( true ) {
+        pv.setTime( t );
+        sta.calcAzEl_rigorous( sat, pv );
+        double delta = pv.getEl() - AvoidSatellites::minElevation;
+
+        bool nowVisible = delta >= 0;
+        if ( !visible && nowVisible ) {
+            startTime = previous;
+            visible = true;
+        }
+        if ( visible && !nowVisible ) {
+            windows.emplace_back( startTime, t );
+            visible = false;
+        }
+        if ( t >= TimeSystem::duration ) {
+            break;
+        }
+
+        double distance = get<2>( sat->calcRaDeDistTime( t, sta.getPosition() ) );
+        double step = distance * ( 1 - exp( -abs( delta ) ) ) / maxVelocity;
+        step = min( step, static_cast<double>( TimeSystem::duration - t ) );
+
+        previous = t;
+        t += max( 1u, static_cast<unsigned int>( step ) );
+        t = min( t, TimeSystem::duration );
+    }
+
+    if ( visible ) {
+        windows.emplace_back( startTime, TimeSystem::duration );
+    }
+    return windows;
+}
+
+
+/**
+ * @brief number of seconds above minimum elevation which are not covered by a visibility window (dense 1 s scan)
+ * @author Matthias Schartner
+ *
+ * @param sta station
+ * @param sat satellite
+ * @param begin first window
+ * @param end end of windows
+ * @return number of missed seconds
+ */
+unsigned long missedSeconds( Station &sta, const shared_ptr<Satellite> &sat, const AvoidSatellites::Window *begin,
+                             const AvoidSatellites::Window *end ) {
+    unsigned long missed = 0;
+    PointingVector pv( sta.getId(), sat->getId() );
+    for ( unsigned int t = 0; t <= TimeSystem::duration; ++t ) {
+        pv.setTime( t );
+        sta.calcAzEl_rigorous( sat, pv );
+        if ( pv.getEl() < AvoidSatellites::minElevation ) {
+            continue;
+        }
+        bool covered = any_of( begin, end, [t]( const AvoidSatellites::Window &w ) {
+            return w.first <= t && t <= w.second;
+        } );
+        if ( !covered ) {
+            ++missed;
+        }
+    }
+    return missed;
+}
+
+}  // namespace
+
+
+void VieVS::addSatelliteWindowsBenchmark( Benchmark &benchmark ) {
+    benchmark.add( "satelliteWindows", "satellite visibility windows vs dense 1 s elevation scan", []( Benchmark &b ) {
+        Network network = b.session().getNetwork();
+
+        AvoidSatellites::satellitesToAvoid = {
+            Session::createSatellite( "GEO", 0.05, 80.0, 0.0002, 270.0, 100.0, 1.0027 ),
+            Session::createSatellite( "IGSO", 8.0, 200.0, 0.0002, 270.0, 300.0, 1.0027 ),
+            Session::createSatellite( "LEO", 53.0, 120.0, 0.0001, 90.0, 0.0, 15.06 ),
+            Session::createSatellite( "SSO", 97.6, 30.0, 0.0010, 60.0, 180.0, 14.57 ) };
+        const auto &satellites = AvoidSatellites::satellitesToAvoid;
+        for ( const auto &any : satellites ) {
+            any->precalcEphemeris( TimeSystem::duration + 1800 );
+        }
+        AvoidSatellites::outputPercentage = 0;
+
+        b.measure( "AvoidSatellites::initialize", network.getNSta() * satellites.size(),
+                   [&]() { AvoidSatellites::initialize( network ); } );
+        b.report( "visibility windows", AvoidSatellites::nVisibleWindows(), "-" );
+
+        for ( unsigned long isat = 0; isat < satellites.size(); ++isat ) {
+            const auto &sat = satellites[isat];
+            unsigned long missed = 0;
+            unsigned long missedWithoutRotation = 0;
+            for ( auto &sta : network.refStations() ) {
+                auto windows = AvoidSatellites::visibleWindows( sta.getId(), isat );
+                missed += missedSeconds( sta, sat, windows.first, windows.second );
+
+                vector<AvoidSatellites::Window> previous = windowsWithoutRotation( sta, sat );
+                missedWithoutRotation += missedSeconds( sta, sat, previous.data(), previous.data() + previous.size() );
+            }
+            b.report( "missed seconds without Earth rotation " + sat->getName(), missedWithoutRotation, "s" );
+            b.checkMax( "missed seconds " + sat->getName(), missed, 0 );
+        }
+
+        AvoidSatellites::satellitesToAvoid.clear();
+        AvoidSatellites::initialize( network );
+    } );
+}
@@ -0,0 +1,88 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Benchmark.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+namespace {
+
+/**
+ * @brief number of scans which differ in source, stations or observing times
+ * @author Matthias Schartner
+ *
+ * @param scans1 first schedule
+ * @param scans2 second schedule
+ * @return number of differing scans (including missing scans)
+ */
+unsigned long differingScans( const vector<Scan> &scans1, const vector<Scan> &scans2 ) {
+    unsigned long n = max( scans1.size(), scans2.size() ) - min( scans1.size(), scans2.size() );
+    for ( unsigned long i = 0; i < min( scans1.size(), scans2.size() ); ++i ) {
+        const Scan &scan1 = scans1[i];
+        const Scan &scan2 = scans2[i];
+        bool same = scan1.getSourceId() == scan2.getSourceId() && scan1.getNSta() == scan2.getNSta();
+        for ( int j = 0; same && j < static_cast<int>( scan1.getNSta() ); ++j ) {
+            same = scan1.getStationId( j ) == scan2.getStationId( j ) &&
+                   scan1.getTimes().getObservingTime( j, Timestamp::start ) ==
+                       scan2.getTimes().getObservingTime( j, Timestamp::start ) &&
+                   scan1.getTimes().getObservingTime( j, Timestamp::end ) ==
+                       scan2.getTimes().getObservingTime( j, Timestamp::end );
+        }
+        if ( !same ) {
+            ++n;
+        }
+    }
+    return n;
+}
+
+}  // namespace
+
+
+void VieVS::addScanSelectionBenchmark( Benchmark &benchmark ) {
+    benchmark.add( "scanSelection", "eager vs lazy vs incremental scan selection: identical schedules", []( Benchmark &b ) {
+        boost::property_tree::ptree xml = b.session().getXml();
+        xml.put( "VieSchedpp.output.iteration_log", false );
+
+        xml.put( "VieSchedpp.general.lazyScanSelection", false );
+        unique_ptr<Scheduler> eager = Session::createScheduler( xml );
+        b.measure( "eager schedule", 1, [&]() { eager->start(); } );
+
+        xml.put( "VieSchedpp.general.lazyScanSelection", true );
+        unique_ptr<Scheduler> lazy = Session::createScheduler( xml );
+        b.measure( "lazy schedule", 1, [&]() { lazy->start(); } );
+
+        xml.put( "VieSchedpp.general.lazyScanSelection", false );
+        xml.put( "VieSchedpp.general.incrementalScanSelection", true );
+        unique_ptr<Scheduler> incremental = Session::createScheduler( xml );
+        b.measure( "incremental schedule", 1, [&]() { incremental->start(); } );
+
+        b.report( "scans", eager->getScans().size(), "-" );
+        if ( !b.check( "scans found", !eager->getScans().empty() ) ) {
+            return;
+        }
+        unsigned long nDiff = differingScans( eager->getScans(), lazy->getScans() );
+        b.report( "differing scans lazy", nDiff, "-" );
+        b.check( "identical schedule lazy", nDiff == 0 );
+        nDiff = differingScans( eager->getScans(), incremental->getScans() );
+        b.report( "differing scans incremental", nDiff, "-" );
+        b.check( "identical schedule incremental", nDiff == 0 );
+    } );
+}
@@ -0,0 +1,117 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <random>
+
+#include "../Scan/ScoreKernel.h"
+#include "Benchmark.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+void VieVS::addScoreKernelBenchmark( Benchmark &benchmark ) {
+    benchmark.add( "scoreKernel", "score of all candidate scans: ScoreKernel vs Scan::calcScore", []( Benchmark &b ) {
+        const Session &session = b.session();
+        const Network &network = session.getNetwork();
+        const SourceList &sourceList = session.getSourceList();
+        const SchedulingContext &context = session.getContext();
+
+        Subcon subcon = session.createSubcon( 0 );
+        const vector<Scan> &candidates = subcon.getSingleSourceScans();
+        unsigned long nscans = candidates.size();
+        b.report( "candidate scans", nscans, "-" );
+        if ( !b.check( "candidate scans found", nscans > 0 ) ) {
+            return;
+        }
+
+        // average and idle time scores as prepared in Subcon::precalcScore (random values to cover all terms)
+        mt19937 gen( 42 );
+        uniform_real_distribution<double> uniform( 0, 1 );
+        vector<double> astas( network.getNSta() );
+        vector<double> asrcs( sourceList.getNSrc() );
+        vector<double> abls( network.getNBls() );
+        vector<double> idle( network.getNSta() );
+        for ( auto *v : { &astas, &asrcs, &abls, &idle } ) {
+            for ( auto &any : *v ) {
+                any = uniform( gen );
+            }
+        }
+        unsigned int minTime = numeric_limits<unsigned int>::max();
+        unsigned int maxTime = 0;
+        for ( const auto &any : candidates ) {
+            minTime = min( minTime, any.getTimes().getScanDuration() );
+            maxTime = max( maxTime, any.getTimes().getScanDuration() );
+        }
+
+        const unsigned long nrep = 20 * b.getScale();
+        vector<Scan> scansScalar = candidates;
+        vector<Scan> scansKernel = candidates;
+        b.measure( "Scan::calcScore per scan", nrep * nscans, [&]() {
+            for ( unsigned long irep = 0; irep < nrep; ++irep ) {
+                vector<unordered_map<unsigned long, double>> staids2skyCoverageScores( sourceList.getNSrc() );
+                for ( auto &thisScan : scansScalar ) {
+                    unsigned long srcid = thisScan.getSourceId();
+                    thisScan.calcScore( astas, asrcs, abls, minTime, maxTime, network, sourceList.getSource( srcid ),
+                                        staids2skyCoverageScores[srcid], idle, context );
+                }
+            }
+        } );
+
+        vector<double> firstPartScores;
+        b.measure( "ScoreKernel additive terms only", nrep * nscans, [&]() {
+            for ( unsigned long irep = 0; irep < nrep; ++irep ) {
+                ScoreKernel kernel( network, astas, asrcs, abls, idle, minTime, maxTime, context.weightFactors );
+                kernel.reserve( nscans );
+                for ( const auto &thisScan : scansKernel ) {
+                    kernel.add( thisScan, sourceList.getSource( thisScan.getSourceId() ) );
+                }
+                firstPartScores = kernel.evaluate();
+            }
+        } );
+
+        b.measure( "ScoreKernel + Scan::calcScore", nrep * nscans, [&]() {
+            for ( unsigned long irep = 0; irep < nrep; ++irep ) {
+                ScoreKernel kernel( network, astas, asrcs, abls, idle, minTime, maxTime, context.weightFactors );
+                kernel.reserve( nscans );
+                for ( const auto &thisScan : scansKernel ) {
+                    kernel.add( thisScan, sourceList.getSource( thisScan.getSourceId() ) );
+                }
+                firstPartScores = kernel.evaluate();
+
+                vector<unordered_map<unsigned long, double>> staids2skyCoverageScores( sourceList.getNSrc() );
+                unsigned long iscan = 0;
+                for ( auto &thisScan : scansKernel ) {
+                    unsigned long srcid = thisScan.getSourceId();
+                    thisScan.calcScore( firstPartScores[iscan++], network, sourceList.getSource( srcid ),
+                                        staids2skyCoverageScores[srcid], context );
+                }
+            }
+        } );
+
+        unsigned long nDiff = 0;
+        for ( unsigned long i = 0; i < nscans; ++i ) {
+            if ( scansScalar[i].getScore() != scansKernel[i].getScore() ) {
+                ++nDiff;
+            }
+        }
+        b.report( "scans with different score", nDiff, "-" );
+        b.check( "scores bit-identical", nDiff == 0 );
+    } );
+}
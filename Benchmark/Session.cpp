@@ -0,0 +1,263 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Session.h"
+
+#include <fstream>
+#include <random>
+
+#include <boost/format.hpp>
+#ifdef VIESCHEDPP_LOG
+#include <boost/log/core.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/log/trivial.hpp>
+#endif
+
+#include "../Input/SkdCatalogReader.h"
+#include "../Misc/LookupTable.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+Session::Session( const string &prefix, unsigned int scale ) {
+#ifdef VIESCHEDPP_LOG
+    boost::log::core::get()->set_filter( boost::log::trivial::severity >= boost::log::trivial::error );
+#endif
+    const unsigned long nsta = 16;
+    const unsigned long nsrc = 300 * scale;
+    map<string, string> catalogs = writeCatalogs( prefix, 40, nsrc );
+
+    xml_.put( "VieSchedpp.general.experimentName", "benchmark" );
+    xml_.put( "VieSchedpp.general.startTime", "2026.01.15 00:00:00" );
+    xml_.put( "VieSchedpp.general.endTime", "2026.01.16 00:00:00" );
+    xml_.put( "VieSchedpp.general.subnetting", false );
+    for ( unsigned long i = 0; i < nsta; ++i ) {
+        xml_.add( "VieSchedpp.general.stations.station", ( boost::format( "STA%04d" ) % i ).str() );
+    }
+    for ( const auto &any : { "antenna", "equip", "flux", "freq", "hdpos", "loif", "mask", "modes", "position", "rec",
+                              "rx", "source", "tracks" } ) {
+        xml_.put( string( "VieSchedpp.catalogs." ) + any, catalogs.count( any ) ? catalogs[any] : "" );
+    }
+
+    boost::property_tree::ptree simple;
+    simple.put( "sampleRate", 32 );
+    simple.put( "bits", 2 );
+    for ( const auto &band : vector<tuple<string, double, unsigned int>>{ { "X", 0.0349, 10 }, { "S", 0.1303, 6 } } ) {
+        boost::property_tree::ptree bandTree;
+        bandTree.put( "<xmlattr>.name", get<0>( band ) );
+        bandTree.put( "wavelength", get<1>( band ) );
+        bandTree.put( "channels", get<2>( band ) );
+        simple.add_child( "bands.band", bandTree );
+
+        boost::property_tree::ptree policy;
+        policy.put( "<xmlattr>.name", get<0>( band ) );
+        policy.put( "minSNR", get<0>( band ) == "X" ? 20 : 15 );
+        policy.put( "station.tag", "required" );
+        policy.put( "source.tag", "required" );
+        xml_.add_child( "VieSchedpp.mode.bandPolicies.bandPolicy", policy );
+    }
+    xml_.add_child( "VieSchedpp.mode.simple", simple );
+
+    xml_.put_child( "VieSchedpp.station.parameters", boost::property_tree::ptree() );
+    xml_.put_child( "VieSchedpp.station.cableWrapBuffers", boost::property_tree::ptree() );
+    xml_.put_child( "VieSchedpp.source.parameters", boost::property_tree::ptree() );
+    xml_.put_child( "VieSchedpp.baseline.parameters", boost::property_tree::ptree() );
+    xml_.put( "VieSchedpp.skyCoverage.influenceDistance", 30 );
+    xml_.put( "VieSchedpp.skyCoverage.influenceInterval", 3600 );
+
+    xml_.put( "VieSchedpp.weightFactor.skyCoverage", 1 );
+    xml_.put( "VieSchedpp.weightFactor.numberOfObservations", 1 );
+    xml_.put( "VieSchedpp.weightFactor.duration", 1 );
+    xml_.put( "VieSchedpp.weightFactor.averageSources", 1 );
+    xml_.put( "VieSchedpp.weightFactor.averageStations", 1 );
+    xml_.put( "VieSchedpp.weightFactor.averageBaselines", 1 );
+    xml_.put( "VieSchedpp.weightFactor.idleTime", 1 );
+    xml_.put( "VieSchedpp.weightFactor.idleTimeInterval", 300 );
+    xml_.put( "VieSchedpp.weightFactor.weightDeclination", 1 );
+    xml_.put( "VieSchedpp.weightFactor.declinationStartWeight", -20 );
+    xml_.put( "VieSchedpp.weightFactor.declinationFullWeight", -50 );
+    xml_.put( "VieSchedpp.weightFactor.weightLowElevation", 1 );
+    xml_.put( "VieSchedpp.weightFactor.lowElevationStartWeight", 30 );
+    xml_.put( "VieSchedpp.weightFactor.lowElevationFullWeight", 20 );
+
+    unique_ptr<Scheduler> scheduler = createScheduler( xml_ );
+    network_ = scheduler->getNetwork();
+    sourceList_ = scheduler->getSourceList();
+    obsModes_ = scheduler->getObservingMode();
+    context_.weightFactors = scheduler->getWeightFactors();
+    mode_ = obsModes_->getMode( 0 );
+}
+
+
+unique_ptr<Scheduler> Session::createScheduler( const boost::property_tree::ptree &xml ) {
+    // same steps as in VieSchedpp::run
+    LookupTable::initialize();
+    SkdCatalogReader reader;
+    reader.setStationNames( util::getStationNames( xml ) );
+    reader.setCatalogFilePathes( xml.get_child( "VieSchedpp.catalogs" ) );
+    reader.initializeStationCatalogs();
+    reader.initializeSourceCatalogs();
+
+    ofstream of;
+    Initializer init( xml );
+    init.initializeGeneral( of );
+    Initializer::initializeAstronomicalParameteres();
+    init.initializeFocusCornersAlgorithm();
+    init.initializeObservingMode( reader, of );
+    init.createSources( reader, of );
+    init.createStations( reader, of );
+    init.connectObservingMode( of );
+    init.initializeStations();
+    init.precalcAzElStations();
+    init.initializeBaselines();
+    init.initializeSites();
+    init.initializeSources( Initializer::MemberType::source );
+    init.initializeWeightFactors();
+    init.initializeSkyCoverages();
+
+    return unique_ptr<Scheduler>( new Scheduler( init, "", "benchmark" ) );
+}
+
+
+map<string, string> Session::writeCatalogs( const string &prefix, unsigned long nsta, unsigned long nsrc ) {
+    map<string, string> catalogs;
+    for ( const auto &any : { "antenna", "position", "equip", "mask", "source", "flux" } ) {
+        catalogs[any] = prefix + any + ".cat";
+    }
+    mt19937 gen( 42 );
+    uniform_real_distribution<double> uniform( 0, 1 );
+
+    ofstream antenna( catalogs["antenna"] );
+    ofstream position( catalogs["position"] );
+    ofstream equip( catalogs["equip"] );
+    ofstream mask( catalogs["mask"] );
+    antenna << "* VERSION benchmark\n";
+    position << "* VERSION benchmark\n";
+    equip << "* VERSION benchmark\n";
+    mask << "* VERSION benchmark\n";
+    for ( unsigned long i = 0; i < nsta; ++i ) {
+        string name = ( boost::format( "STA%04d" ) % i ).str();
+        string tlc = { static_cast<char>( 'A' + i / 26 % 26 ), static_cast<char>( 'A' + i % 26 ) };
+
+        // stations distributed over the globe (more on the northern hemisphere)
+        double lat = asin( -0.8 + 1.7 * uniform( gen ) );
+        double lon = twopi * uniform( gen );
+        double r = 6371000.0;
+        position << boost::format( "P%04d %s %.3f %.3f %.3f 00000000 0.0 0.0 0.0 %s\n" ) % i % tlc %
+                        ( r * cos( lat ) * cos( lon ) ) % ( r * cos( lat ) * sin( lon ) ) % ( r * sin( lat ) ) % name;
+
+        double rate = 60 + 300 * uniform( gen );
+        antenna << boost::format( "A %s AZEL 0.0 %.1f 10 -270.0 270.0 %.1f 10 5.0 88.0 %.1f P%04d EQ%04d" ) % name %
+                       rate % ( rate / 2 ) % ( 12 + 20 * uniform( gen ) ) % i % i;
+        if ( i % 3 == 0 ) {
+            antenna << boost::format( " MK%04d" ) % i;
+            mask << boost::format( "%s %s MK%04d 0 %.1f 90 %.1f 180 %.1f 270 %.1f 360%s\n" ) % tlc %
+                        ( i % 2 == 0 ? "STEP" : "LINE" ) % i % ( 5 + 10 * uniform( gen ) ) %
+                        ( 5 + 10 * uniform( gen ) ) % ( 5 + 10 * uniform( gen ) ) % ( 5 + 10 * uniform( gen ) ) %
+                        ( i % 2 == 0 ? "" : " 7.0" );
+        }
+        antenna << "\n";
+
+        equip << boost::format( "%s EQ%04d MK5 VLBA 256 X %.0f S %.0f" ) % name % i % ( 500 + 2000 * uniform( gen ) ) %
+                     ( 500 + 2000 * uniform( gen ) );
+        if ( i % 4 == 1 ) {
+            // elevation dependent SEFD
+            equip << boost::format( " X %.2f %.2f %.2f S %.2f %.2f %.2f" ) % ( 0.2 + 0.4 * uniform( gen ) ) % 0.9 %
+                         0.1 % ( 0.2 + 0.4 * uniform( gen ) ) % 0.9 % 0.1;
+        } else {
+            equip << " 0 0";
+        }
+        equip << "\n";
+    }
+
+    ofstream source( catalogs["source"] );
+    ofstream flux( catalogs["flux"] );
+    source << "* VERSION benchmark\n";
+    flux << "* VERSION benchmark\n";
+    for ( unsigned long i = 0; i < nsrc; ++i ) {
+        string name = ( boost::format( "J%07d" ) % i ).str();
+        double ra = 24 * uniform( gen );
+        double de = asin( -0.9 + 1.9 * uniform( gen ) ) * rad2deg;
+        double ade = abs( de );
+        source << boost::format( " %s $ %02d %02d %08.5f %s%02d %02d %07.4f 2000.0 0.0\n" ) % name %
+                      static_cast<int>( ra ) % static_cast<int>( fmod( ra * 60, 60 ) ) % fmod( ra * 3600, 60 ) %
+                      ( de < 0 ? "-" : "" ) % static_cast<int>( ade ) % static_cast<int>( fmod( ade * 60, 60 ) ) %
+                      fmod( ade * 3600, 60 );
+
+        // X band: one to three component model or baseline dependent flux, S band: baseline dependent flux
+        double f = 0.2 + 2 * uniform( gen );
+        if ( i % 2 == 0 ) {
+            for ( unsigned long j = 0; j <= i % 3; ++j ) {
+                flux << boost::format( "%s X M %.3f %.3f %.2f %.1f 0 0\n" ) % name % ( f / ( j + 1 ) ) %
+                            ( 0.05 + uniform( gen ) ) % ( 0.3 + 0.7 * uniform( gen ) ) % ( 180 * uniform( gen ) );
+            }
+        } else {
+            flux << boost::format( "%s X B 0.0 %.3f 7000.0 %.3f 13000.0\n" ) % name % f % ( 0.7 * f );
+        }
+        flux << boost::format( "%s S B 0.0 %.3f 7000.0 %.3f 13000.0\n" ) % name % ( 1.2 * f ) % ( f );
+    }
+    return catalogs;
+}
+
+
+shared_ptr<Satellite> Session::createSatellite( const string &name, double inclination, double node,
+                                                double eccentricity, double perigee, double anomaly,
+                                                double meanMotion ) {
+    auto checksum = []( const string &line ) {
+        int sum = 0;
+        for ( char c : line ) {
+            if ( isdigit( c ) ) {
+                sum += c - '0';
+            } else if ( c == '-' ) {
+                ++sum;
+            }
+        }
+        return line + to_string( sum % 10 );
+    };
+
+    static int norad = 90000;
+    ++norad;
+    boost::posix_time::ptime start = TimeSystem::startTime;
+    double doy = start.date().day_of_year() + start.time_of_day().total_seconds() / 86400.0;
+    string l1 = checksum( ( boost::format( "1 %05dU 26001A   %02d%012.8f  .00000000  00000-0  00000-0 0  999" ) %
+                            norad % ( start.date().year() % 100 ) % doy )
+                              .str() );
+    string l2 = checksum( ( boost::format( "2 %05d %8.4f %8.4f %07d %8.4f %8.4f %11.8f%05d" ) % norad % inclination %
+                            node % lround( eccentricity * 1e7 ) % perigee % anomaly % meanMotion % 1 )
+                              .str() );
+
+    unordered_map<string, unique_ptr<AbstractFlux>> flux;
+    return make_shared<Satellite>( name, l1, l2, flux );
+}
+
+
+Subcon Session::createSubcon( unsigned int time ) const {
+    Subcon subcon;
+    for ( const auto &thisSource : sourceList_.getSources() ) {
+        subcon.visibleScan( time, Scan::ScanType::standard, network_, thisSource );
+    }
+    subcon.calcStartTimes( network_, sourceList_ );
+    subcon.updateAzEl( network_, sourceList_ );
+    subcon.constructAllBaselines( network_, sourceList_ );
+    subcon.calcAllBaselineDurations( network_, sourceList_, mode_ );
+    subcon.calcAllScanDurations( network_, sourceList_ );
+    subcon.checkTotalObservingTime( network_, sourceList_ );
+    return subcon;
+}
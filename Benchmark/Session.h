@@ -0,0 +1,194 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file Session.h
+ * @brief class Session
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+
+#ifndef BENCHMARK_SESSION_H
+#define BENCHMARK_SESSION_H
+
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include "../Misc/SchedulingContext.h"
+#include "../ObservingMode/ObservingMode.h"
+#include "../Scan/Subcon.h"
+#include "../Scheduler.h"
+#include "../Source/Satellite.h"
+#include "../Source/SourceList.h"
+#include "../Station/Network.h"
+
+
+namespace VieVS {
+
+/**
+ * @class Session
+ * @brief synthetic scheduling session used in benchmark scenarios
+ *
+ * Writes synthetic sked catalogs (stations distributed over the globe, some with elevation dependent SEFD and
+ * horizon masks, sources with multi component flux models) and initializes a 24 hour session with the same steps as
+ * VieSchedpp::run.
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+class Session {
+   public:
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     *
+     * @param prefix prefix of generated catalog files
+     * @param scale problem size factor
+     */
+    Session( const std::string &prefix, unsigned int scale );
+
+
+    /**
+     * @brief write synthetic sked catalogs
+     * @author Matthias Schartner
+     *
+     * @param prefix prefix of generated files
+     * @param nsta number of stations
+     * @param nsrc number of sources
+     * @return catalog name (e.g. "antenna") and file path
+     */
+    static std::map<std::string, std::string> writeCatalogs( const std::string &prefix, unsigned long nsta,
+                                                             unsigned long nsrc );
+
+
+    /**
+     * @brief create satellite from mean orbital elements
+     * @author Matthias Schartner
+     *
+     * Writes TLE data (with checksums) with reference epoch at session start.
+     *
+     * @param name satellite name
+     * @param inclination inclination in degrees
+     * @param node right ascension of ascending node in degrees
+     * @param eccentricity eccentricity
+     * @param perigee argument of perigee in degrees
+     * @param anomaly mean anomaly in degrees
+     * @param meanMotion mean motion in revolutions per day
+     * @return satellite
+     */
+    static std::shared_ptr<Satellite> createSatellite( const std::string &name, double inclination, double node,
+                                                       double eccentricity, double perigee, double anomaly,
+                                                       double meanMotion );
+
+
+    /**
+     * @brief getter for network
+     * @author Matthias Schartner
+     *
+     * @return network
+     */
+    const Network &getNetwork() const noexcept { return network_; }
+
+
+    /**
+     * @brief reference to network
+     * @author Matthias Schartner
+     *
+     * @return network
+     */
+    Network &refNetwork() noexcept { return network_; }
+
+
+    /**
+     * @brief getter for source list
+     * @author Matthias Schartner
+     *
+     * @return source list
+     */
+    const SourceList &getSourceList() const noexcept { return sourceList_; }
+
+
+    /**
+     * @brief getter for observing mode of session
+     * @author Matthias Schartner
+     *
+     * @return observing mode
+     */
+    const std::shared_ptr<const Mode> &getMode() const noexcept { return mode_; }
+
+
+    /**
+     * @brief getter for scheduling context
+     * @author Matthias Schartner
+     *
+     * @return scheduling context
+     */
+    const SchedulingContext &getContext() const noexcept { return context_; }
+
+
+    /**
+     * @brief getter for session parameters
+     * @author Matthias Schartner
+     *
+     * @return session parameters
+     */
+    const boost::property_tree::ptree &getXml() const noexcept { return xml_; }
+
+
+    /**
+     * @brief initialize a scheduler
+     * @author Matthias Schartner
+     *
+     * Same steps as in VieSchedpp::run. Catalogs are read again, therefore changed parameters (e.g. in a copy of
+     * getXml()) are taken into account.
+     *
+     * @param xml session parameters
+     * @return scheduler (not yet started)
+     */
+    static std::unique_ptr<Scheduler> createScheduler( const boost::property_tree::ptree &xml );
+
+
+    /**
+     * @brief create all visible single source scans at a given time
+     * @author Matthias Schartner
+     *
+     * Same steps as in Scheduler::createSubcon with a single thread.
+     *
+     * @param time time since session start in seconds
+     * @return subcon with all candidate scans
+     */
+    Subcon createSubcon( unsigned int time ) const;
+
+
+   private:
+    boost::property_tree::ptree xml_;                 ///< session parameters
+    Network network_;                                 ///< station network
+    SourceList sourceList_;                           ///< source list
+    std::shared_ptr<const ObservingMode> obsModes_;  ///< observing modes
+    std::shared_ptr<const Mode> mode_;                ///< observing mode
+    SchedulingContext context_;                       ///< scheduling context
+};
+
+}  // namespace VieVS
+
+#endif  // BENCHMARK_SESSION_H
@@ -0,0 +1,108 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Benchmark.h"
+#include "../Misc/sofa.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+void VieVS::addSiderealTimeBenchmark( Benchmark &benchmark ) {
+    benchmark.add( "siderealTime", "tabulated sidereal time and Subcon::calcAllBaselineDurations", []( Benchmark &b ) {
+        const Session &session = b.session();
+        const Network &network = session.getNetwork();
+        const SourceList &sourceList = session.getSourceList();
+        const shared_ptr<const Mode> &mode = session.getMode();
+
+        // tables must match the direct calculation for every second
+        const unsigned int end = TimeSystem::duration + 3600;
+        double date1 = 2400000.5;
+        double maxDiff82 = 0;
+        double maxDiff = 0;
+        for ( unsigned int t = 0; t < end; ++t ) {
+            double mjd = TimeSystem::mjdStart + static_cast<double>( t ) / 86400.0;
+            maxDiff82 = max( maxDiff82, abs( TimeSystem::internalTime2gmst82( t ) - iauGmst82( date1, mjd ) ) );
+            maxDiff = max( maxDiff, abs( TimeSystem::internalTime2gmst( t ) - TimeSystem::mjd2gmst( mjd ) ) );
+        }
+        b.checkMax( "table vs iauGmst82", maxDiff82, 0 );
+        b.checkMax( "table vs mjd2gmst", maxDiff, 0 );
+
+        double sum = 0;
+        b.measure( "iauGmst82", end, [&]() {
+            for ( unsigned int t = 0; t < end; ++t ) {
+                sum += iauGmst82( date1, TimeSystem::mjdStart + static_cast<double>( t ) / 86400.0 );
+            }
+        } );
+        b.measure( "internalTime2gmst82", end, [&]() {
+            for ( unsigned int t = 0; t < end; ++t ) {
+                sum += TimeSystem::internalTime2gmst82( t );
+            }
+        } );
+        b.report( "checksum", sum, "-" );
+
+        // baseline durations of all candidate scans with and without tables
+        vector<Subcon> subcons;
+        unsigned long nobs = 0;
+        for ( unsigned int time = 0; time < TimeSystem::duration; time += 3 * 3600 ) {
+            subcons.push_back( session.createSubcon( time ) );
+            for ( const auto &scan : subcons.back().getSingleSourceScans() ) {
+                nobs += scan.getNObs();
+            }
+        }
+        b.report( "observations", nobs, "-" );
+        if ( !b.check( "observations found", nobs > 0 ) ) {
+            return;
+        }
+
+        const unsigned long nrep = 5 * b.getScale();
+        auto durations = [&]() {
+            vector<Subcon> copies = subcons;
+            for ( unsigned long irep = 0; irep < nrep; ++irep ) {
+                for ( auto &subcon : copies ) {
+                    subcon.calcAllBaselineDurations( network, sourceList, mode );
+                }
+            }
+            return copies;
+        };
+
+        vector<Subcon> direct;
+        TimeSystem::precalcSiderealTime( 0 );
+        b.measure( "calcAllBaselineDurations direct", nrep * nobs, [&]() { direct = durations(); } );
+        TimeSystem::precalcSiderealTime( end );
+        vector<Subcon> tabulated;
+        b.measure( "calcAllBaselineDurations tabulated", nrep * nobs, [&]() { tabulated = durations(); } );
+
+        bool same = direct.size() == tabulated.size();
+        for ( unsigned long i = 0; same && i < direct.size(); ++i ) {
+            const auto &scans1 = direct[i].getSingleSourceScans();
+            const auto &scans2 = tabulated[i].getSingleSourceScans();
+            same = scans1.size() == scans2.size();
+            for ( unsigned long j = 0; same && j < scans1.size(); ++j ) {
+                const auto &obs1 = scans1[j].getObservations();
+                const auto &obs2 = scans2[j].getObservations();
+                same = obs1.size() == obs2.size();
+                for ( unsigned long k = 0; same && k < obs1.size(); ++k ) {
+                    same = obs1[k].getObservingTime() == obs2[k].getObservingTime();
+                }
+            }
+        }
+        b.check( "same observation durations", same );
+    } );
+}
@@ -0,0 +1,208 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <random>
+
+#include "../ObservingMode/BandRegistry.h"
+#include "../Station/Equip/Equipment_elTable.h"
+#include "../Station/StationLookupTables.h"
+#include "Benchmark.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+void VieVS::addStationTablesBenchmark( Benchmark &benchmark ) {
+    benchmark.add( "stationTables", "compiled SEFD and horizon mask vs equipment and mask objects", []( Benchmark &b ) {
+        const Network &network = b.session().getNetwork();
+        const unsigned long nbands = BandRegistry::size();
+
+        // elevations every 0.001 degree
+        const unsigned long nel = 90001;
+        vector<double> elevations( nel );
+        for ( unsigned long i = 0; i < nel; ++i ) {
+            elevations[i] = i * 0.001 * deg2rad;
+        }
+
+        for ( bool dependent : { false, true } ) {
+            string type = dependent ? "elevation dependent" : "constant";
+            vector<const Station *> stations;
+            for ( const auto &sta : network.getStations() ) {
+                if ( sta.getEquip().isElevationDependent() == dependent ) {
+                    stations.push_back( &sta );
+                }
+            }
+            b.report( "stations " + type, stations.size(), "-" );
+            if ( stations.empty() ) {
+                continue;
+            }
+
+            unsigned long n = stations.size() * nbands * nel;
+            vector<double> exact( n );
+            vector<double> compiled( n );
+            b.measure( "equipment object " + type, n, [&]() {
+                unsigned long k = 0;
+                for ( const Station *sta : stations ) {
+                    for ( unsigned long bandId = 0; bandId < nbands; ++bandId ) {
+                        const string &band = BandRegistry::getName( bandId );
+                        for ( double el : elevations ) {
+                            exact[k++] = sta->getEquip().getSEFD( band, el );
+                        }
+                    }
+                }
+            } );
+            b.measure( "Station::getSEFD " + type, n, [&]() {
+                unsigned long k = 0;
+                for ( const Station *sta : stations ) {
+                    for ( unsigned long bandId = 0; bandId < nbands; ++bandId ) {
+                        for ( double el : elevations ) {
+                            compiled[k++] = sta->getSEFD( bandId, el );
+                        }
+                    }
+                }
+            } );
+            b.check( "identical SEFD " + type, exact == compiled );
+
+            // relative error of the previous interpolation of 0.01 degree samples above the minimum elevation
+            double maxError = 0;
+            unsigned long k = 0;
+            for ( const Station *sta : stations ) {
+                for ( unsigned long bandId = 0; bandId < nbands; ++bandId ) {
+                    const string &band = BandRegistry::getName( bandId );
+                    for ( unsigned long i = 0; i < nel; ++i, ++k ) {
+                        double el = elevations[i];
+                        if ( el < sta->getPARA().minElevation || exact[k] == 0 ) {
+                            continue;
+                        }
+                        double x = el / ( 0.01 * deg2rad );
+                        auto idx = static_cast<unsigned long>( x );
+                        double y1 = sta->getEquip().getSEFD( band, idx * 0.01 * deg2rad );
+                        double y2 = sta->getEquip().getSEFD( band, min( ( idx + 1 ) * 0.01 * deg2rad, halfpi ) );
+                        double interpolated = y1 + ( y2 - y1 ) * ( x - idx );
+                        maxError = max( maxError, abs( interpolated / exact[k] - 1 ) );
+                    }
+                }
+            }
+            b.report( "previous 0.01 deg interpolation rel. error " + type, maxError, "-" );
+        }
+
+        // elevation dependent SEFD tables (.stp files, not part of the synthetic network) with 2 to 40 unevenly spaced
+        // and partly repeated knots
+        {
+            const unsigned long ntab = 20;
+            mt19937 gen( 7 );
+            uniform_real_distribution<double> uniform( 0, 1 );
+            vector<Equipment_elTable> tables;
+            for ( unsigned long i = 0; i < ntab; ++i ) {
+                unordered_map<string, vector<double>> el;
+                unordered_map<string, vector<double>> SEFD;
+                for ( unsigned long bandId = 0; bandId < nbands; ++bandId ) {
+                    const string &band = BandRegistry::getName( bandId );
+                    unsigned long nknots = 2 + i * 2;
+                    vector<double> tel;
+                    vector<double> tSEFD;
+                    double e = uniform( gen ) * 10 * deg2rad;
+                    for ( unsigned long j = 0; j < nknots; ++j ) {
+                        tel.push_back( e );
+                        tSEFD.push_back( 500 + 5000 * uniform( gen ) );
+                        if ( uniform( gen ) > 0.1 ) {
+                            e += uniform( gen ) * 80 * deg2rad / nknots;
+                        }
+                    }
+                    el[band] = move( tel );
+                    SEFD[band] = move( tSEFD );
+                }
+                tables.emplace_back( el, SEFD );
+            }
+            vector<StationLookupTables> lookupTables;
+            for ( const auto &equip : tables ) {
+                lookupTables.emplace_back( equip, nullptr );
+            }
+
+            unsigned long n = ntab * nbands * nel;
+            vector<double> exact( n );
+            vector<double> compiled( n );
+            b.measure( "equipment object table", n, [&]() {
+                unsigned long k = 0;
+                for ( const auto &equip : tables ) {
+                    for ( unsigned long bandId = 0; bandId < nbands; ++bandId ) {
+                        const string &band = BandRegistry::getName( bandId );
+                        for ( double el : elevations ) {
+                            exact[k++] = equip.getSEFD( band, el );
+                        }
+                    }
+                }
+            } );
+            b.measure( "compiled table", n, [&]() {
+                unsigned long k = 0;
+                for ( const auto &tab : lookupTables ) {
+                    for ( unsigned long bandId = 0; bandId < nbands; ++bandId ) {
+                        for ( double el : elevations ) {
+                            compiled[k++] = tab.getSEFD( bandId, el );
+                        }
+                    }
+                }
+            } );
+            bool allCompiled = true;
+            for ( const auto &tab : lookupTables ) {
+                for ( unsigned long bandId = 0; bandId < nbands; ++bandId ) {
+                    allCompiled = allCompiled && tab.hasSEFD( bandId );
+                }
+            }
+            b.check( "all tables compiled", allCompiled );
+            b.check( "identical SEFD table", exact == compiled );
+        }
+
+        // random pointing directions
+        const unsigned long npv = 200000 * b.getScale();
+        mt19937 gen( 42 );
+        uniform_real_distribution<double> randomAz( -pi, 3 * pi );
+        uniform_real_distribution<double> randomEl( 0, halfpi );
+        vector<PointingVector> pvs;
+        pvs.reserve( npv );
+        for ( unsigned long i = 0; i < npv; ++i ) {
+            PointingVector p( 0, 0 );
+            p.setAz( randomAz( gen ) );
+            p.setEl( randomEl( gen ) );
+            pvs.push_back( p );
+        }
+        unsigned long n = npv * network.getNSta();
+        vector<char> reference( n );
+        vector<char> visible( n );
+        b.measure( "horizon mask object", n, [&]() {
+            unsigned long k = 0;
+            for ( const auto &sta : network.getStations() ) {
+                for ( const auto &p : pvs ) {
+                    reference[k++] = p.getEl() >= sta.getPARA().minElevation &&
+                                     ( !sta.hasHorizonMask() || sta.getMask().visible( p ) ) &&
+                                     sta.getCableWrap().anglesInside( p );
+                }
+            }
+        } );
+        b.measure( "Station::isVisible", n, [&]() {
+            unsigned long k = 0;
+            for ( const auto &sta : network.getStations() ) {
+                for ( const auto &p : pvs ) {
+                    visible[k++] = sta.isVisible( p );
+                }
+            }
+        } );
+        b.check( "identical visibility", reference == visible );
+    } );
+}
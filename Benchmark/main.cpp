@@ -0,0 +1,58 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Benchmark.h"
+
+
+/**
+ * @file Benchmark/main.cpp
+ * @brief main file of benchmark executable
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+
+
+/**
+ * @brief main function of benchmark executable
+ * @author Matthias Schartner
+ *
+ * see class Benchmark for command line arguments
+ *
+ * @param argc number of arguments
+ * @param argv argument list
+ * @return number of failed checks
+ */
+int main( int argc, char *argv[] ) {
+    VieVS::Benchmark benchmark( argc, argv );
+
+    VieVS::addAzElPrecalcBenchmark( benchmark );
+    VieVS::addScoreKernelBenchmark( benchmark );
+    VieVS::addAllocationBenchmark( benchmark );
+    VieVS::addSiderealTimeBenchmark( benchmark );
+    VieVS::addAngularDistanceBenchmark( benchmark );
+    VieVS::addSatelliteEphemerisBenchmark( benchmark );
+    VieVS::addSatelliteWindowsBenchmark( benchmark );
+    VieVS::addFluxBenchmark( benchmark );
+    VieVS::addStationTablesBenchmark( benchmark );
+    VieVS::addCatalogReaderBenchmark( benchmark );
+    VieVS::addCatalogBundleBenchmark( benchmark );
+    VieVS::addScanSelectionBenchmark( benchmark );
+
+    return benchmark.run();
+}
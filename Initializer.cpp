@@ -28,7 +28,7 @@
 
 using namespace std;
 using namespace VieVS;
-unsigned long Initializer::nextId = 0;
+std::atomic<unsigned long> Initializer::nextId{ 0 };
 
 
 Initializer::Initializer()
@@ -65,25 +65,37 @@ void Initializer::precalcSubnettingSrcIds() noexcept {
     if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "calculating subnetting source combinations";
 #endif
     const auto &sources = sourceList_.getQuasars();
-    unsigned long nquasars = sources.size();
     unsigned long nsrc = sourceList_.getNSrc();
-    vector<vector<unsigned long>> subnettingSrcIds( nsrc );
-    for ( int i = 0; i < nquasars; ++i ) {
-        for ( int j = i + 1; j < nquasars; ++j ) {
-            double tmp = sin( sources[i]->getDe() ) * sin( sources[j]->getDe() ) +
-                         cos( sources[i]->getDe() ) * cos( sources[j]->getDe() ) *
-                             cos( sources[i]->getRa() - sources[j]->getRa() );
-            double dist = acos( tmp );
-
-            if ( dist > parameters_.subnettingMinAngle ) {
-#ifdef VIESCHEDPP_LOG
-                if ( Flags::logTrace )
-                    BOOST_LOG_TRIVIAL( trace ) << "possible subnetting between source " << i << " and " << j;
-#endif
-                subnettingSrcIds.at( i ).push_back( j );
-            }
+
+    PrecalcCache::Key key;
+    key.add( string( "subnetting" ) ).add( parameters_.subnettingMinAngle ).add( nsrc );
+    for ( const auto &source : sources ) {
+        key.add( source->getName() ).add( source->getRa() ).add( source->getDe() );
+    }
+    auto subnettingSrcIds = make_shared<SubnettingPairs>();
+    bool cached = PrecalcCache::load( "subnetting", key, [&]( PrecalcCache::Reader &reader ) {
+        return subnettingSrcIds->load( reader );
+    } );
+
+    if ( !cached ) {
+        vector<double> ra;
+        vector<double> de;
+        for ( const auto &source : sources ) {
+            ra.push_back( source->getRa() );
+            de.push_back( source->getDe() );
+        }
+        subnettingSrcIds = make_shared<SubnettingPairs>( ra, de, nsrc, parameters_.subnettingMinAngle );
+
+        if ( PrecalcCache::enabled() ) {
+            PrecalcCache::Writer writer;
+            subnettingSrcIds->save( writer );
+            PrecalcCache::store( "subnetting", key, writer );
         }
     }
+#ifdef VIESCHEDPP_LOG
+    if ( Flags::logDebug )
+        BOOST_LOG_TRIVIAL( debug ) << subnettingSrcIds->size() << " possible subnetting source combinations";
+#endif
 
     preCalculated_.subnettingSrcIds = subnettingSrcIds;
 }
@@ -609,8 +621,8 @@ void Initializer::createStations( const SkdCatalogReader &reader, ofstream &of )
 
 
 void Initializer::createSources( const SkdCatalogReader &reader, std::ofstream &of ) noexcept {
-    const map<string, vector<string>> &sourceCatalog = reader.getSourceCatalog();
-    const map<string, vector<string>> &fluxCatalog = reader.getFluxCatalog();
+    const CatalogTable &sourceCatalog = reader.getSourceCatalog();
+    const CatalogTable &fluxCatalog = reader.getFluxCatalog();
 
     int counter = 0;
     unsigned long nsrc = sourceCatalog.size();
@@ -794,7 +806,7 @@ void Initializer::createSatellites( const SkdCatalogReader &reader, ofstream &of
     vector<string> src_ignored;
     vector<string> src_fluxInformationNotFound;
     vector<string> src_failed;
-    const map<string, vector<string>> &fluxCatalog = reader.getFluxCatalog();
+    const CatalogTable &fluxCatalog = reader.getFluxCatalog();
 
     const auto &sat_xml_list_o = xml_.get_child_optional( "VieSchedpp.general.satellites" );
     if ( sat_xml_list_o.is_initialized() ) {
@@ -914,6 +926,15 @@ void Initializer::createSatellites( const SkdCatalogReader &reader, ofstream &of
             util::outputObjectList( "created satellites", src_created, of );
             util::outputObjectList( "ignored satellites", src_ignored, of );
             util::outputObjectList( "failed to create satellites", src_failed, of );
+
+            // tabulate orbits once all TLE entries are added
+            const auto &satellites = sourceList_.refSatellites();
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic )
+#endif
+            for ( long i = 0; i < static_cast<long>( satellites.size() ); ++i ) {
+                satellites[i]->precalcEphemeris( TimeSystem::duration + 1800 );
+            }
         }
 
     } else {
@@ -1061,6 +1082,15 @@ void Initializer::createSatellitesToAvoid( ofstream &of ) noexcept {
 
             //            util::outputObjectList( "created satellites to be avoided", src_created, of );
             util::outputObjectList( "failed to create satellites to be avoided", src_failed, of );
+
+            // tabulate orbits once all TLE entries are added
+            const auto &satellites = AvoidSatellites::satellitesToAvoid;
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic )
+#endif
+            for ( long i = 0; i < static_cast<long>( satellites.size() ); ++i ) {
+                satellites[i]->precalcEphemeris( TimeSystem::duration + 1800 );
+            }
         }
 
         for ( const auto &any : deltaTimes ) {
@@ -1193,6 +1223,26 @@ void Initializer::initializeGeneral( ofstream &of ) noexcept {
             xml_.get( "VieSchedpp.general.doNotObserveSourcesWithinMinRepeat", true );
         parameters_.ignoreSuccessiveScansSameSrc =
             xml_.get( "VieSchedpp.general.ignore_successive_scans_same_source", true );
+        parameters_.incrementalScanSelection = xml_.get( "VieSchedpp.general.incrementalScanSelection", false );
+        parameters_.lazyScanSelection = xml_.get( "VieSchedpp.general.lazyScanSelection", false );
+
+        // optional cache of precalculated values (directory must exist)
+        PrecalcCache::directory = xml_.get( "VieSchedpp.general.precalcCache", "" );
+        PrecalcCache::bypass = PrecalcCache::bypass || xml_.get( "VieSchedpp.general.precalcCacheBypass", false );
+        if ( PrecalcCache::enabled() ) {
+            of << "precalculation cache: " << PrecalcCache::directory;
+            if ( PrecalcCache::bypass ) {
+                of << " (bypassed)";
+            }
+            of << "\n";
+        }
+
+        std::string scanSelectionThreads = xml_.get<std::string>( "VieSchedpp.multiCore.scanSelection.threads", "single" );
+        if ( scanSelectionThreads == "manual" ) {
+            parameters_.nThreadsScanSelection = max( 1, xml_.get( "VieSchedpp.multiCore.scanSelection.nThreads", 1 ) );
+        } else if ( scanSelectionThreads == "auto" ) {
+            parameters_.nThreadsScanSelection = max( 1u, std::thread::hardware_concurrency() );
+        }
 
     } catch ( const boost::property_tree::ptree_error &e ) {
         of << "ERROR: reading VieSchedpp.xml file!" << endl;
@@ -1364,30 +1414,121 @@ void Initializer::initializeStations() noexcept {
         cout << "cannot read <station> block in VieSchedpp.xml file";
 #endif
     }
+
+    // SEFD and horizon mask lookup tables
+    for ( auto &sta : network_.refStations() ) {
+        sta.compileLookupTables();
+    }
 }
 
 
 void Initializer::precalcAzElStations() noexcept {
-    for ( auto &sta : network_.refStations() ) {
-        for ( const auto &source : sourceList_.getQuasars() ) {
-            int step = 600;
-            PointingVector npv( sta.getId(), source->getId() );
-            for ( unsigned int t = 0; t < TimeSystem::duration + 1800; t += step ) {
-                npv.setTime( t );
-                sta.calcAzEl_rigorous( source, npv );
+    // earth orientation is calculated once per epoch and applied to all sources (see Station::calcAzEl_rigorous)
+    vector<shared_ptr<const AbstractSource>> quasars;
+    for ( const auto &source : sourceList_.getQuasars() ) {
+        quasars.push_back( source );
+    }
+    vector<shared_ptr<const AbstractSource>> satellites;
+    for ( const auto &source : sourceList_.getSatellites() ) {
+        satellites.push_back( source );
+    }
+
+    unsigned int end = TimeSystem::duration + 1800;
+    unsigned int stepQuasar = 600;
+    unsigned int stepSatellite = 60;
+
+    // values only depend on session start, station positions and source coordinates
+    PrecalcCache::Key key;
+    key.add( string( "azel" ) ).add( TimeSystem::mjdStart ).add( end ).add( stepQuasar ).add( stepSatellite );
+    key.add( AstronomicalParameters::earth_nut.getStep() );
+    for ( const auto &sta : network_.getStations() ) {
+        const auto &pos = sta.getPosition();
+        key.add( sta.getName() ).add( pos->getX() ).add( pos->getY() ).add( pos->getZ() );
+    }
+    for ( const auto &source : sourceList_.getQuasars() ) {
+        key.add( source->getId() ).add( source->getName() ).add( source->getRa() ).add( source->getDe() );
+    }
+    for ( const auto &source : sourceList_.getSatellites() ) {
+        key.add( source->getId() ).add( source->getName() ).add( source->getTleData() );
+    }
+
+    bool cached = PrecalcCache::load( "azel", key, [&]( PrecalcCache::Reader &reader ) {
+        for ( auto &sta : network_.refStations() ) {
+            for ( const auto &source : quasars ) {
+                if ( !sta.loadAzElPrecalc( source->getId(), reader ) ) {
+                    return false;
+                }
+            }
+            for ( const auto &source : satellites ) {
+                if ( !sta.loadAzElPrecalc( source->getId(), reader ) ) {
+                    return false;
+                }
             }
         }
-        for ( const auto &source : sourceList_.getSatellites() ) {
-//            ofstream o("/scratch/programming/tmp/"+sta.getName()+".csv");
-            int step = 60;
-            PointingVector npv( sta.getId(), source->getId() );
-            for ( unsigned int t = 0; t < TimeSystem::duration + 1800; t += step ) {
-                npv.setTime( t );
-                sta.calcAzEl_rigorous( source, npv );
-//                o << boost::format("%f,%f,%f\n")% (TimeSystem::mjdStart+t/86400) % (npv.getAz()*rad2deg) % (npv.getEl()*rad2deg);
+        return true;
+    } );
+    if ( !cached ) {
+        calcAzElStations( quasars, satellites, end, stepQuasar, stepSatellite );
+
+        if ( PrecalcCache::enabled() ) {
+            PrecalcCache::Writer writer;
+            for ( const auto &sta : network_.getStations() ) {
+                for ( const auto &source : quasars ) {
+                    sta.saveAzElPrecalc( source->getId(), writer );
+                }
+                for ( const auto &source : satellites ) {
+                    sta.saveAzElPrecalc( source->getId(), writer );
+                }
             }
+            PrecalcCache::store( "azel", key, writer );
+        }
+    }
+
+    // precalculated values are read only from now on and shared between all copies (e.g. multi scheduling)
+    for ( auto &sta : network_.refStations() ) {
+        sta.shareAzElPrecalc();
+    }
+}
+
+
+void Initializer::calcAzElStations( const vector<shared_ptr<const AbstractSource>> &quasars,
+                                    const vector<shared_ptr<const AbstractSource>> &satellites, unsigned int end,
+                                    unsigned int stepQuasar, unsigned int stepSatellite ) noexcept {
+    // preallocate grids, afterwards each (epoch, station) pair only writes to its own grid entries
+    for ( auto &sta : network_.refStations() ) {
+        for ( const auto &source : quasars ) {
+            sta.setAzElPrecalcGrid( source->getId(), stepQuasar, end );
+        }
+        for ( const auto &source : satellites ) {
+            sta.setAzElPrecalcGrid( source->getId(), stepSatellite, end );
         }
     }
+
+    long nsta = static_cast<long>( network_.getNSta() );
+    long nEpochsQuasar = quasars.empty() ? 0 : ( end + stepQuasar - 1 ) / stepQuasar;
+    long nEpochsSatellite = satellites.empty() ? 0 : ( end + stepSatellite - 1 ) / stepSatellite;
+    long nTasks = nsta * ( nEpochsQuasar + nEpochsSatellite );
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic )
+#endif
+    for ( long i = 0; i < nTasks; ++i ) {
+        long iEpoch = i / nsta;
+        Station &sta = network_.refStations()[i % nsta];
+
+        bool isSatellite = iEpoch >= nEpochsQuasar;
+        const auto &sources = isSatellite ? satellites : quasars;
+        auto t = static_cast<unsigned int>( isSatellite ? ( iEpoch - nEpochsQuasar ) * stepSatellite
+                                                        : iEpoch * stepQuasar );
+
+        vector<PointingVector> npvs;
+        npvs.reserve( sources.size() );
+        for ( const auto &source : sources ) {
+            npvs.emplace_back( sta.getId(), source->getId() );
+            npvs.back().setTime( t );
+        }
+        sta.calcAzEl_rigorous( sources, npvs );
+    }
 }
 
 
@@ -2241,7 +2382,7 @@ void Initializer::baselineSetup( vector<vector<Baseline::Event>> &events, const
 }
 
 
-void Initializer::initializeAstronomicalParameteres() noexcept {
+void Initializer::initializeAstronomicalParameteres( unsigned int ephemerisStep ) noexcept {
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "initialize astronomical parameters";
 #endif
@@ -2264,7 +2405,7 @@ void Initializer::initializeAstronomicalParameteres() noexcept {
     date2 = TimeSystem::mjdStart;
 
     unsigned int counter = 0;
-    unsigned int frequency = 3600;
+    unsigned int frequency = max( ephemerisStep, 1u );
     unsigned int refTime;
 
     do {
@@ -2329,6 +2470,10 @@ void Initializer::initializeAstronomicalParameteres() noexcept {
         AstronomicalParameters::sun_time.push_back( refTime );
         ++counter;
     } while ( refTime < TimeSystem::duration + 3600 );
+
+    AstronomicalParameters::indexTables();
+
+    TimeSystem::precalcSiderealTime( TimeSystem::duration + 3600 );
 }
 
 
@@ -2336,30 +2481,31 @@ void Initializer::initializeWeightFactors() noexcept {
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "initialize weight factors";
 #endif
-    WeightFactors::weightSkyCoverage = xml_.get<double>( "VieSchedpp.weightFactor.skyCoverage", 0 );
-    WeightFactors::weightNumberOfObservations = xml_.get<double>( "VieSchedpp.weightFactor.numberOfObservations", 0 );
-    WeightFactors::weightDuration = xml_.get<double>( "VieSchedpp.weightFactor.duration", 0 );
+    WeightFactors &weightFactors = parameters_.weightFactors;
+    weightFactors.weightSkyCoverage = xml_.get<double>( "VieSchedpp.weightFactor.skyCoverage", 0 );
+    weightFactors.weightNumberOfObservations = xml_.get<double>( "VieSchedpp.weightFactor.numberOfObservations", 0 );
+    weightFactors.weightDuration = xml_.get<double>( "VieSchedpp.weightFactor.duration", 0 );
 
-    WeightFactors::weightAverageSources = xml_.get<double>( "VieSchedpp.weightFactor.averageSources", 0 );
-    WeightFactors::weightAverageStations = xml_.get<double>( "VieSchedpp.weightFactor.averageStations", 0 );
-    WeightFactors::weightAverageBaselines = xml_.get<double>( "VieSchedpp.weightFactor.averageBaselines", 0 );
+    weightFactors.weightAverageSources = xml_.get<double>( "VieSchedpp.weightFactor.averageSources", 0 );
+    weightFactors.weightAverageStations = xml_.get<double>( "VieSchedpp.weightFactor.averageStations", 0 );
+    weightFactors.weightAverageBaselines = xml_.get<double>( "VieSchedpp.weightFactor.averageBaselines", 0 );
 
-    WeightFactors::weightIdleTime = xml_.get<double>( "VieSchedpp.weightFactor.idleTime", 0 );
-    WeightFactors::idleTimeInterval = xml_.get<unsigned int>( "VieSchedpp.weightFactor.idleTimeInterval", 0 );
+    weightFactors.weightIdleTime = xml_.get<double>( "VieSchedpp.weightFactor.idleTime", 0 );
+    weightFactors.idleTimeInterval = xml_.get<unsigned int>( "VieSchedpp.weightFactor.idleTimeInterval", 0 );
 
-    WeightFactors::weightClosures = xml_.get<double>( "VieSchedpp.weightFactor.closures", 0 );
-    WeightFactors::maxClosures = xml_.get<unsigned int>( "VieSchedpp.weightFactor.closures_max", 0 );
+    weightFactors.weightClosures = xml_.get<double>( "VieSchedpp.weightFactor.closures", 0 );
+    weightFactors.maxClosures = xml_.get<unsigned int>( "VieSchedpp.weightFactor.closures_max", 0 );
 
-    WeightFactors::weightDeclination = xml_.get<double>( "VieSchedpp.weightFactor.weightDeclination", 0 );
-    WeightFactors::declinationStartWeight =
+    weightFactors.weightDeclination = xml_.get<double>( "VieSchedpp.weightFactor.weightDeclination", 0 );
+    weightFactors.declinationStartWeight =
         xml_.get<double>( "VieSchedpp.weightFactor.declinationStartWeight", 0 ) * deg2rad;
-    WeightFactors::declinationFullWeight =
+    weightFactors.declinationFullWeight =
         xml_.get<double>( "VieSchedpp.weightFactor.declinationFullWeight", 0 ) * deg2rad;
 
-    WeightFactors::weightLowElevation = xml_.get<double>( "VieSchedpp.weightFactor.weightLowElevation", 0 );
-    WeightFactors::lowElevationStartWeight =
+    weightFactors.weightLowElevation = xml_.get<double>( "VieSchedpp.weightFactor.weightLowElevation", 0 );
+    weightFactors.lowElevationStartWeight =
         xml_.get<double>( "VieSchedpp.weightFactor.lowElevationStartWeight", 30 ) * deg2rad;
-    WeightFactors::lowElevationFullWeight =
+    weightFactors.lowElevationFullWeight =
         xml_.get<double>( "VieSchedpp.weightFactor.lowElevationFullWeight", 20 ) * deg2rad;
 }
 
@@ -2641,6 +2787,7 @@ void Initializer::initializeObservingMode( const SkdCatalogReader &skdCatalogs,
             }
         }
     }
+    ObservingMode::indexBands();
 
 #ifdef VIESCHEDPP_LOG
     BOOST_LOG_TRIVIAL( info ) << boost::format( "observing mode: %s" ) % obsModes_->getMode( 0 )->getName();
@@ -2659,6 +2806,7 @@ void Initializer::initializeObservingMode( unsigned long nsta, double samplerate
     ObservingMode::type = ObservingMode::Type::simple;
     obsModes_ = std::make_shared<ObservingMode>();
     obsModes_->simpleMode( nsta, samplerate, bits, band2channel, band2wavelength );
+    ObservingMode::indexBands();
 }
 
 
@@ -2780,58 +2928,58 @@ void Initializer::applyMultiSchedParameters(const VieVS::MultiScheduling::Parame
     }
     if ( parameters.focusCornerSwitchCadence.is_initialized() ) {
         FocusCorners::flag = true;
-        unsigned int interval = *parameters.focusCornerSwitchCadence;
-        FocusCorners::interval = interval;
+        parameters_.focusCornerInterval = *parameters.focusCornerSwitchCadence;
     }
 
     // WEIGHT FACTORS
+    WeightFactors &weightFactors = parameters_.weightFactors;
     if ( parameters.weightSkyCoverage.is_initialized() ) {
-        WeightFactors::weightSkyCoverage = *parameters.weightSkyCoverage;
+        weightFactors.weightSkyCoverage = *parameters.weightSkyCoverage;
     }
     if ( parameters.weightNumberOfObservations.is_initialized() ) {
-        WeightFactors::weightNumberOfObservations = *parameters.weightNumberOfObservations;
+        weightFactors.weightNumberOfObservations = *parameters.weightNumberOfObservations;
     }
     if ( parameters.weightDuration.is_initialized() ) {
-        WeightFactors::weightDuration = *parameters.weightDuration;
+        weightFactors.weightDuration = *parameters.weightDuration;
     }
     if ( parameters.weightAverageSources.is_initialized() ) {
-        WeightFactors::weightAverageSources = *parameters.weightAverageSources;
+        weightFactors.weightAverageSources = *parameters.weightAverageSources;
     }
     if ( parameters.weightAverageStations.is_initialized() ) {
-        WeightFactors::weightAverageStations = *parameters.weightAverageStations;
+        weightFactors.weightAverageStations = *parameters.weightAverageStations;
     }
     if ( parameters.weightAverageBaselines.is_initialized() ) {
-        WeightFactors::weightAverageBaselines = *parameters.weightAverageBaselines;
+        weightFactors.weightAverageBaselines = *parameters.weightAverageBaselines;
     }
     if ( parameters.weightIdleTime.is_initialized() ) {
-        WeightFactors::weightIdleTime = *parameters.weightIdleTime;
+        weightFactors.weightIdleTime = *parameters.weightIdleTime;
     }
     if ( parameters.weightIdleTime_interval.is_initialized() ) {
-        WeightFactors::idleTimeInterval = static_cast<unsigned int>( *parameters.weightIdleTime_interval );
+        weightFactors.idleTimeInterval = static_cast<unsigned int>( *parameters.weightIdleTime_interval );
     }
     if ( parameters.weightClosures.is_initialized() ) {
-        WeightFactors::weightClosures = *parameters.weightClosures;
+        weightFactors.weightClosures = *parameters.weightClosures;
     }
     if ( parameters.weightMaxClosures.is_initialized() ) {
-        WeightFactors::maxClosures = static_cast<unsigned int>( *parameters.weightMaxClosures );
+        weightFactors.maxClosures = static_cast<unsigned int>( *parameters.weightMaxClosures );
     }
     if ( parameters.weightLowDeclination.is_initialized() ) {
-        WeightFactors::weightDeclination = *parameters.weightLowDeclination;
+        weightFactors.weightDeclination = *parameters.weightLowDeclination;
     }
     if ( parameters.weightLowDeclination_begin.is_initialized() ) {
-        WeightFactors::declinationStartWeight = *parameters.weightLowDeclination_begin * deg2rad;
+        weightFactors.declinationStartWeight = *parameters.weightLowDeclination_begin * deg2rad;
     }
     if ( parameters.weightLowDeclination_full.is_initialized() ) {
-        WeightFactors::declinationFullWeight = *parameters.weightLowDeclination_full * deg2rad;
+        weightFactors.declinationFullWeight = *parameters.weightLowDeclination_full * deg2rad;
     }
     if ( parameters.weightLowElevation.is_initialized() ) {
-        WeightFactors::weightLowElevation = *parameters.weightLowElevation;
+        weightFactors.weightLowElevation = *parameters.weightLowElevation;
     }
     if ( parameters.weightLowElevation_begin.is_initialized() ) {
-        WeightFactors::lowElevationStartWeight = *parameters.weightLowElevation_begin * deg2rad;
+        weightFactors.lowElevationStartWeight = *parameters.weightLowElevation_begin * deg2rad;
     }
     if ( parameters.weightLowElevation_full.is_initialized() ) {
-        WeightFactors::lowElevationFullWeight = *parameters.weightLowElevation_full * deg2rad;
+        weightFactors.lowElevationFullWeight = *parameters.weightLowElevation_full * deg2rad;
     }
 
     // SKY COVERAGE
@@ -3134,7 +3282,7 @@ vector<MultiScheduling::Parameters> Initializer::readMultiSched( std::ostream &o
 #endif
         boost::property_tree::ptree mstree = *mstree_o;
 
-        MultiScheduling::setConstants( network_.getNSta(), sourceList_.getNQuasars() );
+        MultiScheduling::setConstants( network_.getNSta(), sourceList_.getNQuasars(), parameters_.weightFactors );
 
         unsigned int maxNumber = mstree.get( "maxNumber", numeric_limits<unsigned int>::max() );
         unsigned int seed = mstree.get(
@@ -3210,11 +3358,10 @@ void Initializer::initializeFocusCornersAlgorithm() noexcept {
         unsigned int cadence = xml_.get( "VieSchedpp.focusCorners.cadence", 900u );
         int nscans = xml_.get( "VieSchedpp.focusCorners.nscans", 1 );
         FocusCorners::flag = true;
-        FocusCorners::interval = cadence;
+        parameters_.focusCornerInterval = cadence;
         FocusCorners::nscans = nscans;
     } else {
         FocusCorners::flag = false;
-        FocusCorners::nextStart = numeric_limits<unsigned int>::max();
     }
 }
 
@@ -3316,7 +3463,6 @@ void Initializer::initializeCalibrationBlocks() {
 
     if ( tree.is_initialized() ) {
         CalibratorBlock::subnetting = tree->get( "subnetting", false );
-        CalibratorBlock::stationFlag = vector<char>( network_.getNSta(), false );
         CalibratorBlock::tryToIncludeAllStationFlag = tree->get( "tryToIncludeAllStations", false );
         CalibratorBlock::tryToIncludeAllStations_factor = tree->get( "tryToIncludeAllStations_factor", 3.0 );
         CalibratorBlock::numberOfObservations_factor = tree->get( "numberOfObservations_factor", 5.0 );
@@ -3421,12 +3567,10 @@ void Initializer::initializeAstrometricCalibrationBlocks( std::ofstream &of ) {
             if ( any.first == "cadence_nScanSelections" ) {
                 AstrometricCalibratorBlock::cadenceUnit = AstrometricCalibratorBlock::CadenceUnit::scans;
                 AstrometricCalibratorBlock::cadence = any.second.get_value<unsigned int>();
-                AstrometricCalibratorBlock::nextBlock = AstrometricCalibratorBlock::cadence;
                 of << "  calibration block every " << AstrometricCalibratorBlock::cadence << " scan selections\n";
             } else if ( any.first == "cadence_seconds" ) {
                 AstrometricCalibratorBlock::cadenceUnit = AstrometricCalibratorBlock::CadenceUnit::seconds;
                 AstrometricCalibratorBlock::cadence = any.second.get_value<unsigned int>();
-                AstrometricCalibratorBlock::nextBlock = AstrometricCalibratorBlock::cadence;
                 of << "  calibration block every " << AstrometricCalibratorBlock::cadence << " seconds\n";
             } else if ( any.first == "member" ) {
                 string member = any.second.get_value<string>();
@@ -3925,8 +4069,8 @@ void Initializer::connectObservingMode( std::ofstream &of ) noexcept {
 
 
 unordered_map<string, unique_ptr<AbstractFlux>> Initializer::generateFluxObject(
-    const string &name, const string &commonname, const map<std::string, vector<string>> &fluxCatalog,
-    bool fluxNecessary, std::ofstream &of ) {
+    const string &name, const string &commonname, const CatalogTable &fluxCatalog, bool fluxNecessary,
+    std::ofstream &of ) {
     unordered_map<string, unique_ptr<AbstractFlux>> flux;
     double flcon2{ pi / ( 3600.0 * 180.0 * 1000.0 ) };
 
@@ -4177,12 +4321,7 @@ void Initializer::initializeSatellitesToAvoid() {
         throw;
     }
 
-    unsigned long total = 0;
-    for ( const auto &any : AvoidSatellites::visible_ ) {
-        for ( const auto &sat : any.second ) {
-            total += sat.second.size();
-        }
-    }
+    unsigned long total = AvoidSatellites::nVisibleWindows();
 #ifdef VIESCHEDPP_LOG
     BOOST_LOG_TRIVIAL( info ) << "total of " << total << " periods with satellite passings";
 #else
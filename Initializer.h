@@ -50,6 +50,7 @@
 #include "Misc/LookupTable.h"
 #include "Misc/MultiScheduling.h"
 #include "Misc/ParallacticAngleBlock.h"
+#include "Misc/PrecalcCache.h"
 #include "Misc/TimeSystem.h"
 #include "Misc/WeightFactors.h"
 #include "Misc/sofa.h"
@@ -142,6 +143,14 @@ class Initializer : public VieVS_Object {
             true;  ///< consider scans (with reduced weight) if they are within min repeat time
 
         bool andAsConditionCombination = true;  ///< backup for condition combination. TRUE = and, FALSE = or
+
+        int nThreadsScanSelection = 1;          ///< number of threads used to create candidate scans
+        bool incrementalScanSelection = false;  ///< reuse unchanged candidate scans of previous scan selection
+        bool lazyScanSelection = false;         ///< rigorously update each candidate at most once (can change schedule)
+
+        unsigned int focusCornerInterval = 900;  ///< time interval between focus corner algorithm starts
+
+        WeightFactors weightFactors;  ///< weight factors (copied to scheduling context)
     };
 
     /**
@@ -149,8 +158,8 @@ class Initializer : public VieVS_Object {
      * @author Matthias Schartner
      */
     struct PRECALC {
-        std::vector<std::vector<unsigned long>>
-            subnettingSrcIds;  ///< list of all available second sources in subnetting
+        std::shared_ptr<const SubnettingPairs> subnettingSrcIds =
+            std::make_shared<const SubnettingPairs>();  ///< list of all available second sources in subnetting (shared)
     };
 
 
@@ -187,6 +196,8 @@ class Initializer : public VieVS_Object {
     /**
      *  @brief pre calculates all possible second scans used for subnetting
      * @author Matthias Schartner
+     *
+     * Source combinations are found via a sky partition (see SubnettingPairs) or read from the precalculation cache.
      */
     void precalcSubnettingSrcIds() noexcept;
 
@@ -211,6 +222,9 @@ class Initializer : public VieVS_Object {
     /**
      * @brief precalc azimuth elevations for stations
      * @author Matthias Schartner
+     *
+     * Values are read from the precalculation cache if available (see PrecalcCache), otherwise they are calculated
+     * (see calcAzElStations) and written to the cache.
      */
     void precalcAzElStations() noexcept;
 
@@ -283,8 +297,13 @@ class Initializer : public VieVS_Object {
     /**
      * @brief initializes astronomical parameters
      * @author Matthias Schartner
+     *
+     * Nutation and sun position are tabulated on a uniform grid and linearly interpolated in between. A finer grid
+     * can be defined via "VieSchedpp.general.ephemerisStep".
+     *
+     * @param ephemerisStep grid spacing of nutation and sun position in seconds
      */
-    static void initializeAstronomicalParameteres() noexcept;
+    static void initializeAstronomicalParameteres( unsigned int ephemerisStep = 3600 ) noexcept;
 
 
     /**
@@ -454,7 +473,7 @@ class Initializer : public VieVS_Object {
     void initializeSatellitesToAvoid();
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
     int version_ = 0;             ///< version
 
     boost::property_tree::ptree xml_;                    ///< content of VieSchedpp.xml file
@@ -475,6 +494,24 @@ class Initializer : public VieVS_Object {
     std::vector<CalibratorBlock> calib_;                                      ///< fringeFinder impact scan descriptor
     boost::optional<MultiScheduling::Parameters> multiSchedulingParameters_;  ///< multi scheduling paramters
 
+
+    /**
+     * @brief calculate azimuth elevation lookup tables of all stations
+     * @author Matthias Schartner
+     *
+     * Grids are preallocated for all stations and sources, afterwards all epochs of all stations are calculated in
+     * parallel.
+     *
+     * @param quasars all quasars
+     * @param satellites all satellites
+     * @param end end of grids in seconds since session start (exclusive)
+     * @param stepQuasar grid spacing of quasars in seconds
+     * @param stepSatellite grid spacing of satellites in seconds
+     */
+    void calcAzElStations( const std::vector<std::shared_ptr<const AbstractSource>> &quasars,
+                           const std::vector<std::shared_ptr<const AbstractSource>> &satellites, unsigned int end,
+                           unsigned int stepQuasar, unsigned int stepSatellite ) noexcept;
+
     /**
      * @brief station setup function
      * @author Matthias Schartner
@@ -583,8 +620,8 @@ class Initializer : public VieVS_Object {
     std::vector<unsigned long> getMembers( const std::string &name, const SourceList &sourceList );
 
     std::unordered_map<std::string, std::unique_ptr<AbstractFlux>> generateFluxObject(
-        const std::string &name, const std::string &commonname,
-        const std::map<std::string, std::vector<std::string>> &fluxCatalog, bool fluxNecessary, std::ofstream &of );
+        const std::string &name, const std::string &commonname, const CatalogTable &fluxCatalog, bool fluxNecessary,
+        std::ofstream &of );
 };  // namespace VieVS
 }  // namespace VieVS
 #endif /* INITIALIZER_H */
@@ -0,0 +1,113 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CatalogFile.h"
+
+#include <boost/algorithm/string.hpp>
+#include <cstring>
+#include <fstream>
+
+
+using namespace std;
+using namespace VieVS;
+
+
+CatalogFile::CatalogFile( const std::string &path ) {
+    {
+        ifstream test( path );
+        if ( !test.is_open() ) {
+            return;
+        }
+        test.seekg( 0, ios::end );
+        if ( test.tellg() <= 0 ) {
+            // empty files cannot be mapped
+            open_ = true;
+            return;
+        }
+    }
+    try {
+        boost::interprocess::file_mapping mapping( path.c_str(), boost::interprocess::read_only );
+        region_ = make_shared<boost::interprocess::mapped_region>( mapping, boost::interprocess::read_only );
+    } catch ( const boost::interprocess::interprocess_exception & ) {
+        return;
+    }
+    open_ = true;
+
+    const auto *begin = static_cast<const char *>( region_->get_address() );
+    const char *end = begin + region_->get_size();
+    content_ = Token( begin, region_->get_size() );
+    const char *start = begin;
+    while ( start != end ) {
+        const auto *lf = static_cast<const char *>( memchr( start, '\n', end - start ) );
+        const char *stop = lf == nullptr ? end : lf;
+        lines_.emplace_back( start, stop - start );
+
+        Token trimmed = trim( lines_.back() );
+        if ( !trimmed.empty() && trimmed[0] == '$' ) {
+            sections_.emplace( trimmed.to_string(), lines_.size() );
+        }
+        start = lf == nullptr ? end : lf + 1;
+    }
+}
+
+
+unsigned long CatalogFile::findSection( const std::string &flag ) const noexcept {
+    auto it = sections_.find( flag );
+    return it == sections_.end() ? lines_.size() : it->second;
+}
+
+
+void CatalogFile::split( Token line, std::vector<Token> &tokens ) {
+    tokens.clear();
+    const char *p = line.data();
+    const char *end = p + line.size();
+    const char *start = p;
+    while ( p != end ) {
+        if ( isSpace( *p ) ) {
+            tokens.emplace_back( start, p - start );
+            while ( p != end && isSpace( *p ) ) {
+                ++p;
+            }
+            start = p;
+        } else {
+            ++p;
+        }
+    }
+    tokens.emplace_back( start, end - start );
+}
+
+
+CatalogFile::Token CatalogFile::trim( Token line ) noexcept {
+    while ( !line.empty() && isSpace( line.front() ) ) {
+        line.remove_prefix( 1 );
+    }
+    while ( !line.empty() && isSpace( line.back() ) ) {
+        line.remove_suffix( 1 );
+    }
+    return line;
+}
+
+
+bool CatalogFile::version( Token line, std::vector<Token> &tokens, std::string &version ) {
+    split( line, tokens );
+    if ( tokens.size() >= 3 && boost::algorithm::to_lower_copy( tokens[1].to_string() ) == "version" ) {
+        version = tokens[2].to_string();
+        return true;
+    }
+    return false;
+}
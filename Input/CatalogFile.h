@@ -0,0 +1,160 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CatalogFile.h
+ * @brief class CatalogFile
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+
+#ifndef CATALOGFILE_H
+#define CATALOGFILE_H
+
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/utility/string_view.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace VieVS {
+
+/**
+ * @class CatalogFile
+ * @brief memory mapped sked catalog file split into lines
+ *
+ * The file is mapped once and split into lines (without line feed, equivalent to std::getline). Lines and tokens are
+ * views into the mapped file, strings are only created for values which are stored. The first line of each section
+ * ("$" flag) is indexed, so all catalogs stored in one .skd file share a single mapping.
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+class CatalogFile {
+   public:
+    using Token = boost::string_view;  ///< view into mapped file
+
+
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     *
+     * @param path path to file
+     */
+    explicit CatalogFile( const std::string &path );
+
+
+    /**
+     * @brief check if file could be opened
+     * @author Matthias Schartner
+     *
+     * @return true if file is open
+     */
+    bool isOpen() const noexcept { return open_; }
+
+
+    /**
+     * @brief getter for file content
+     * @author Matthias Schartner
+     *
+     * @return whole file
+     */
+    Token getContent() const noexcept { return content_; }
+
+
+    /**
+     * @brief getter for all lines
+     * @author Matthias Schartner
+     *
+     * @return all lines of file
+     */
+    const std::vector<Token> &getLines() const noexcept { return lines_; }
+
+
+    /**
+     * @brief first line of a section
+     * @author Matthias Schartner
+     *
+     * @param flag section flag (e.g. "$STATIONS")
+     * @return index of line after the first line equal to flag (number of lines if flag is not found)
+     */
+    unsigned long findSection( const std::string &flag ) const noexcept;
+
+
+    /**
+     * @brief split line at white spaces
+     * @author Matthias Schartner
+     *
+     * Equivalent to boost::split with boost::is_space() and boost::token_compress_on (leading and trailing white
+     * spaces lead to an empty first and last token).
+     *
+     * @param line line
+     * @param tokens tokens (output)
+     */
+    static void split( Token line, std::vector<Token> &tokens );
+
+
+    /**
+     * @brief remove leading and trailing white spaces
+     * @author Matthias Schartner
+     *
+     * @param line line
+     * @return trimmed line
+     */
+    static Token trim( Token line ) noexcept;
+
+
+    /**
+     * @brief catalog version
+     * @author Matthias Schartner
+     *
+     * Versions are defined as second and third token of a line (e.g. "* VERSION 2020Jan01").
+     *
+     * @param line line
+     * @param tokens buffer for tokens
+     * @param version version (output)
+     * @return true if line contains a version
+     */
+    static bool version( Token line, std::vector<Token> &tokens, std::string &version );
+
+   private:
+    bool open_ = false;                                           ///< flag if file could be opened
+    std::shared_ptr<boost::interprocess::mapped_region> region_;  ///< mapped file
+    Token content_;                                               ///< whole file
+    std::vector<Token> lines_;                                    ///< all lines
+    std::unordered_map<std::string, unsigned long> sections_;     ///< first line after section flag
+
+    /**
+     * @brief check for white space
+     * @author Matthias Schartner
+     *
+     * @param c character
+     * @return true if c is a white space
+     */
+    static bool isSpace( char c ) noexcept {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+    }
+};
+}  // namespace VieVS
+
+#endif  // CATALOGFILE_H
@@ -0,0 +1,144 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CatalogTable.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+
+using namespace std;
+using namespace VieVS;
+
+
+CatalogTable::CatalogTable( const std::map<std::string, std::vector<std::string>> &catalog ) {
+    unsigned long nstr = 0;
+    unsigned long nchar = 0;
+    for ( const auto &any : catalog ) {
+        nstr += 1 + any.second.size();
+        nchar += any.first.size();
+        for ( const auto &field : any.second ) {
+            nchar += field.size();
+        }
+    }
+    chars_.reserve( nchar );
+    offsets_.reserve( nstr + 1 );
+    entries_.reserve( catalog.size() + 1 );
+
+    auto add = [this]( const std::string &str ) {
+        offsets_.push_back( static_cast<uint32_t>( chars_.size() ) );
+        chars_.insert( chars_.end(), str.begin(), str.end() );
+    };
+    for ( const auto &any : catalog ) {
+        entries_.push_back( static_cast<uint32_t>( offsets_.size() ) );
+        add( any.first );
+        for ( const auto &field : any.second ) {
+            add( field );
+        }
+    }
+    offsets_.push_back( static_cast<uint32_t>( chars_.size() ) );
+    entries_.push_back( static_cast<uint32_t>( offsets_.size() - 1 ) );
+}
+
+
+CatalogTable::const_iterator CatalogTable::find( Token key ) const noexcept {
+    unsigned long first = 0;
+    unsigned long last = size();
+    while ( first < last ) {
+        unsigned long mid = first + ( last - first ) / 2;
+        int cmp = this->key( mid ).compare( key );
+        if ( cmp == 0 ) {
+            return const_iterator( this, mid );
+        } else if ( cmp < 0 ) {
+            first = mid + 1;
+        } else {
+            last = mid;
+        }
+    }
+    return end();
+}
+
+
+std::vector<std::string> CatalogTable::at( Token key ) const {
+    auto it = find( key );
+    if ( it == end() ) {
+        throw out_of_range( "catalog entry " + key.to_string() + " not found" );
+    }
+    return entry( it.index() ).second;
+}
+
+
+CatalogTable::value_type CatalogTable::entry( unsigned long idx ) const {
+    value_type entry;
+    entry.first = key( idx ).to_string();
+    unsigned long n = nfields( idx );
+    entry.second.reserve( n );
+    for ( unsigned long i = 0; i < n; ++i ) {
+        entry.second.push_back( field( idx, i ).to_string() );
+    }
+    return entry;
+}
+
+
+std::map<std::string, std::vector<std::string>> CatalogTable::toMap() const {
+    map<std::string, vector<std::string>> all;
+    for ( unsigned long i = 0; i < size(); ++i ) {
+        all.emplace_hint( all.end(), entry( i ) );
+    }
+    return all;
+}
+
+
+void CatalogTable::write( PrecalcCache::Writer &writer ) const {
+    writer.write( chars_ );
+    writer.write( offsets_ );
+    writer.write( entries_ );
+}
+
+
+bool CatalogTable::read( PrecalcCache::Reader &reader ) {
+    if ( !reader.read( chars_ ) || !reader.read( offsets_ ) || !reader.read( entries_ ) ) {
+        return false;
+    }
+
+    // offsets must be increasing within chars_ and entries increasing within offsets_, keys must be sorted
+    if ( offsets_.empty() != entries_.empty() ) {
+        return false;
+    }
+    if ( offsets_.empty() ) {
+        return chars_.empty();
+    }
+    if ( offsets_.front() != 0 || offsets_.back() != chars_.size() ||
+         !is_sorted( offsets_.begin(), offsets_.end() ) ) {
+        return false;
+    }
+    if ( entries_.front() != 0 || entries_.back() != offsets_.size() - 1 ) {
+        return false;
+    }
+    for ( unsigned long i = 1; i < entries_.size(); ++i ) {
+        if ( entries_[i] <= entries_[i - 1] ) {
+            return false;
+        }
+    }
+    for ( unsigned long i = 1; i < size(); ++i ) {
+        if ( !( key( i - 1 ) < key( i ) ) ) {
+            return false;
+        }
+    }
+    return true;
+}
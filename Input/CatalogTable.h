@@ -0,0 +1,316 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CatalogTable.h
+ * @brief class CatalogTable
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+
+#ifndef CATALOGTABLE_H
+#define CATALOGTABLE_H
+
+
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../Misc/PrecalcCache.h"
+#include "CatalogFile.h"
+
+
+namespace VieVS {
+
+/**
+ * @class CatalogTable
+ * @brief read-only sked catalog stored as one flat block of characters
+ *
+ * Entries are sorted by key. All strings (key followed by fields of each entry) are stored consecutively in one
+ * character block and addressed by offsets, so a table is filled with a few allocations and can be read from a
+ * catalog bundle as is.
+ *
+ * The interface follows a read-only std::map<std::string, std::vector<std::string>>. Entries are created on access
+ * and returned by value, use key() and field() to access single strings without copies.
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+class CatalogTable {
+   public:
+    using Token = CatalogFile::Token;                                     ///< view into character block
+    using value_type = std::pair<std::string, std::vector<std::string>>;  ///< catalog entry
+
+    /**
+     * @class const_iterator
+     * @brief iterator over entries (dereferencing creates the entry)
+     *
+     * @author Matthias Schartner
+     * @date 17.10.2026
+     */
+    class const_iterator {
+       public:
+        using iterator_category = std::forward_iterator_tag;  ///< iterator category
+        using value_type = CatalogTable::value_type;          ///< catalog entry
+        using difference_type = std::ptrdiff_t;               ///< difference type
+        using pointer = void;                                 ///< no pointer access
+        using reference = value_type;                         ///< entries are returned by value
+
+
+        /**
+         * @brief constructor
+         * @author Matthias Schartner
+         *
+         * @param table table
+         * @param idx entry index
+         */
+        const_iterator( const CatalogTable *table, unsigned long idx ) noexcept : table_{ table }, idx_{ idx } {}
+
+
+        /**
+         * @brief entry index
+         * @author Matthias Schartner
+         *
+         * @return entry index
+         */
+        unsigned long index() const noexcept { return idx_; }
+
+
+        /**
+         * @brief create entry
+         * @author Matthias Schartner
+         *
+         * @return catalog entry
+         */
+        value_type operator*() const { return table_->entry( idx_ ); }
+
+
+        /**
+         * @brief next entry
+         * @author Matthias Schartner
+         *
+         * @return this iterator
+         */
+        const_iterator &operator++() noexcept {
+            ++idx_;
+            return *this;
+        }
+
+
+        /**
+         * @brief compare iterators
+         * @author Matthias Schartner
+         *
+         * @param other other iterator
+         * @return true if both point to the same entry
+         */
+        bool operator==( const const_iterator &other ) const noexcept { return idx_ == other.idx_; }
+
+
+        /**
+         * @brief compare iterators
+         * @author Matthias Schartner
+         *
+         * @param other other iterator
+         * @return true if iterators point to different entries
+         */
+        bool operator!=( const const_iterator &other ) const noexcept { return idx_ != other.idx_; }
+
+       private:
+        const CatalogTable *table_;  ///< table
+        unsigned long idx_;          ///< entry index
+    };
+
+
+    /**
+     * @brief empty table
+     * @author Matthias Schartner
+     */
+    CatalogTable() = default;
+
+
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     *
+     * @param catalog catalog entries per key
+     */
+    explicit CatalogTable( const std::map<std::string, std::vector<std::string>> &catalog );
+
+
+    /**
+     * @brief number of entries
+     * @author Matthias Schartner
+     *
+     * @return number of entries
+     */
+    unsigned long size() const noexcept { return entries_.empty() ? 0 : entries_.size() - 1; }
+
+
+    /**
+     * @brief check if table is empty
+     * @author Matthias Schartner
+     *
+     * @return true if there are no entries
+     */
+    bool empty() const noexcept { return size() == 0; }
+
+
+    /**
+     * @brief iterator to first entry
+     * @author Matthias Schartner
+     *
+     * @return iterator to first entry
+     */
+    const_iterator begin() const noexcept { return const_iterator( this, 0 ); }
+
+
+    /**
+     * @brief iterator behind last entry
+     * @author Matthias Schartner
+     *
+     * @return iterator behind last entry
+     */
+    const_iterator end() const noexcept { return const_iterator( this, size() ); }
+
+
+    /**
+     * @brief find entry (binary search)
+     * @author Matthias Schartner
+     *
+     * @param key key
+     * @return iterator to entry or end() if key does not exist
+     */
+    const_iterator find( Token key ) const noexcept;
+
+
+    /**
+     * @brief number of entries with key (0 or 1)
+     * @author Matthias Schartner
+     *
+     * @param key key
+     * @return number of entries
+     */
+    unsigned long count( Token key ) const noexcept { return find( key ) != end() ? 1 : 0; }
+
+
+    /**
+     * @brief fields of an entry
+     * @author Matthias Schartner
+     *
+     * throws std::out_of_range if key does not exist
+     *
+     * @param key key
+     * @return fields of entry
+     */
+    std::vector<std::string> at( Token key ) const;
+
+
+    /**
+     * @brief key of an entry
+     * @author Matthias Schartner
+     *
+     * @param idx entry index
+     * @return key
+     */
+    Token key( unsigned long idx ) const noexcept { return str( entries_[idx] ); }
+
+
+    /**
+     * @brief number of fields of an entry
+     * @author Matthias Schartner
+     *
+     * @param idx entry index
+     * @return number of fields
+     */
+    unsigned long nfields( unsigned long idx ) const noexcept { return entries_[idx + 1] - entries_[idx] - 1; }
+
+
+    /**
+     * @brief field of an entry
+     * @author Matthias Schartner
+     *
+     * @param idx entry index
+     * @param ifield field index
+     * @return field
+     */
+    Token field( unsigned long idx, unsigned long ifield ) const noexcept {
+        return str( entries_[idx] + 1 + ifield );
+    }
+
+
+    /**
+     * @brief create entry
+     * @author Matthias Schartner
+     *
+     * @param idx entry index
+     * @return key and fields
+     */
+    value_type entry( unsigned long idx ) const;
+
+
+    /**
+     * @brief create all entries
+     * @author Matthias Schartner
+     *
+     * @return catalog entries per key
+     */
+    std::map<std::string, std::vector<std::string>> toMap() const;
+
+
+    /**
+     * @brief serialize table
+     * @author Matthias Schartner
+     *
+     * @param writer writer
+     */
+    void write( PrecalcCache::Writer &writer ) const;
+
+
+    /**
+     * @brief read serialized table
+     * @author Matthias Schartner
+     *
+     * @param reader reader
+     * @return true if successful
+     */
+    bool read( PrecalcCache::Reader &reader );
+
+   private:
+    std::vector<char> chars_;        ///< all strings, key followed by fields of each entry
+    std::vector<uint32_t> offsets_;  ///< start of each string in chars_ (followed by end of last string)
+    std::vector<uint32_t> entries_;  ///< index of key of each entry in offsets_ (followed by number of strings)
+
+    /**
+     * @brief string
+     * @author Matthias Schartner
+     *
+     * @param istr string index
+     * @return string
+     */
+    Token str( unsigned long istr ) const noexcept {
+        return Token( chars_.data() + offsets_[istr], offsets_[istr + 1] - offsets_[istr] );
+    }
+};
+}  // namespace VieVS
+
+#endif  // CATALOGTABLE_H
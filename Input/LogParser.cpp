@@ -21,7 +21,7 @@
 
 using namespace VieVS;
 using namespace std;
-unsigned long LogParser::nextId = 0;
+std::atomic<unsigned long> LogParser::nextId{ 0 };
 
 
 LogParser::LogParser( const std::string &filename ) : VieVS_Object( nextId++ ), filename_{ filename } {}
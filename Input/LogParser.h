@@ -129,7 +129,7 @@ class LogParser : public VieVS_Object {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     bool addedScheduledTimes_ = false;  ///< flag if scheduled times are added
 
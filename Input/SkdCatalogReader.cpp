@@ -18,10 +18,52 @@
 
 #include "SkdCatalogReader.h"
 
+#include <sys/stat.h>
+
 
 using namespace VieVS;
 using namespace std;
-unsigned long SkdCatalogReader::nextId = 0;
+std::atomic<unsigned long> SkdCatalogReader::nextId{ 0 };
+
+namespace {
+// layout version of binary catalog bundle (increase if layout changes)
+constexpr uint32_t bundleVersion = 2;
+
+// size and modification time of a file, false if it does not exist
+bool fileStamp( const string &path, uint64_t &size, int64_t &mtime ) {
+    struct stat status {};
+    if ( path.empty() || stat( path.c_str(), &status ) != 0 ) {
+        return false;
+    }
+    size = static_cast<uint64_t>( status.st_size );
+    mtime = static_cast<int64_t>( status.st_mtime );
+    return true;
+}
+
+void writeBundleMap( PrecalcCache::Writer &writer, const map<string, string> &values ) {
+    writer.write( static_cast<uint64_t>( values.size() ) );
+    for ( const auto &any : values ) {
+        writer.write( any.first );
+        writer.write( any.second );
+    }
+}
+
+bool readBundleMap( PrecalcCache::Reader &reader, map<string, string> &values ) {
+    uint64_t n;
+    if ( !reader.read( n ) ) {
+        return false;
+    }
+    for ( uint64_t i = 0; i < n; ++i ) {
+        string key;
+        string value;
+        if ( !reader.read( key ) || !reader.read( value ) ) {
+            return false;
+        }
+        values.emplace_hint( values.end(), std::move( key ), std::move( value ) );
+    }
+    return true;
+}
+}  // namespace
 
 // source.cat:
 // ^[^\*]\s*([\w+\$-]*)\s+([\w+\$-]*)\s+(\d{1,2})\s+(\d{1,2})\s+(\d{0,2}\.\d*)\s+([+-]?[\d]*)\s+(\d{1,2})\s+(\d{0,2}\.\d*)
@@ -101,316 +143,275 @@ std::map<std::string, std::vector<std::string>> SkdCatalogReader::readCatalog(
         }
     }
 
+    const CatalogFile &file = catalogFile( filepath );
+    if ( !file.isOpen() ) {
+#ifdef VIESCHEDPP_LOG
+        BOOST_LOG_TRIVIAL( fatal ) << "unable to open " << filepath << " file";
+#else
+        cout << "[fatal] unable to open " << filepath << " file";
+#endif
+        terminate();
+    }
+    const vector<CatalogFile::Token> &lines = file.getLines();
+    // if read from skd file start after flag
+    unsigned long iline = fromSkdFile ? file.findSection( skdFlag ) : 0;
+    vector<CatalogFile::Token> tokens;
+    auto readVersion = [&]( CatalogFile::Token line, const string &name ) {
+        string version;
+        if ( CatalogFile::version( line, tokens, version ) ) {
+            catalogsVersion_[name] = version;
+            return true;
+        }
+        return false;
+    };
+    auto toStrings = []( const vector<CatalogFile::Token> &views ) {
+        vector<string> strings;
+        strings.reserve( views.size() );
+        for ( const auto &any : views ) {
+            strings.push_back( any.to_string() );
+        }
+        return strings;
+    };
+
     // read in CATALOG. antenna, position and equip use the same routine
     switch ( type ) {
         case CATALOG::antenna:
         case CATALOG::position:
         case CATALOG::equip:
         case CATALOG::source: {
-            // open file
-            ifstream fid( filepath );
-            if ( !fid.is_open() ) {
-#ifdef VIESCHEDPP_LOG
-                BOOST_LOG_TRIVIAL( fatal ) << "unable to open " << filepath << " file";
-#else
-                cout << "[fatal] unable to open " << filepath << " file";
-#endif
-                terminate();
-            } else {
-                string line;
-                // if read from skd file read until you reach flag
-                if ( fromSkdFile ) {
-                    while ( getline( fid, line ) ) {
-                        if ( boost::trim_copy( line ) == skdFlag ) {
-                            break;
-                        }
-                    }
+            string versionName;
+            switch ( type ) {
+                case CATALOG::antenna: {
+                    versionName = "antenna";
+                    break;
                 }
-                bool versionFound = false;
-                std::map<string, string> eqId2staName;
-                // loop through file
-                while ( getline( fid, line ) ) {
-                    if ( !versionFound && line.length() > 0 ) {
-                        vector<string> splitVector;
-                        boost::split( splitVector, line, boost::is_space(), boost::token_compress_on );
-                        if ( splitVector.size() >= 3 ) {
-                            if ( boost::to_lower_copy( splitVector.at( 1 ) ) == "version" ) {
-                                if ( type == CATALOG::antenna ) {
-                                    catalogsVersion_["antenna"] = splitVector.at( 2 );
-                                    versionFound = true;
-                                }
-                                if ( type == CATALOG::position ) {
-                                    catalogsVersion_["position"] = splitVector.at( 2 );
-                                    versionFound = true;
-                                }
-                                if ( type == CATALOG::equip ) {
-                                    catalogsVersion_["equip"] = splitVector.at( 2 );
-                                    versionFound = true;
-                                }
-                                if ( type == CATALOG::source ) {
-                                    catalogsVersion_["source"] = splitVector.at( 2 );
-                                    versionFound = true;
-                                }
-                            }
-                        }
-                    }
+                case CATALOG::position: {
+                    versionName = "position";
+                    break;
+                }
+                case CATALOG::equip: {
+                    versionName = "equip";
+                    break;
+                }
+                default: {
+                    versionName = "source";
+                    break;
+                }
+            }
 
-                    line = boost::algorithm::trim_copy( line );
-                    if ( line.length() > 0 && line.at( 0 ) != '*' ) {
-                        // trim leading and trailing blanks
-                        if ( line.at( 0 ) == '$' ) {
-                            break;
-                        }
+            // hashed lookup of required stations and referenced keys
+            unordered_set<string> requiredKeys;
+            if ( type == CATALOG::antenna ) {
+                requiredKeys.insert( staNames_.begin(), staNames_.end() );
+            } else if ( type == CATALOG::position ) {
+                for ( const auto &any : antennaKey2positionKey_ ) {
+                    requiredKeys.insert( any.second );
+                }
+            } else if ( type == CATALOG::equip ) {
+                for ( const auto &any : antennaKey2equipKey_ ) {
+                    requiredKeys.insert( any.second );
+                }
+            }
 
-                        std::size_t pos = line.find( "*" );
-                        if ( pos != string::npos ) {
-                            line = line.substr( 0, pos );
-                            line = boost::algorithm::trim_copy( line );
-                        }
+            bool versionFound = false;
+            unordered_map<string, string> eqId2staName;
+            vector<CatalogFile::Token> fields;
+            // loop through file
+            for ( ; iline < lines.size(); ++iline ) {
+                CatalogFile::Token line = lines[iline];
+                if ( !versionFound && !line.empty() ) {
+                    versionFound = readVersion( line, versionName );
+                }
 
-                        vector<string> splitVector;
-                        boost::split( splitVector, line, boost::is_space(), boost::token_compress_on );
+                // trim leading and trailing blanks
+                line = CatalogFile::trim( line );
+                if ( line.empty() || line[0] == '*' ) {
+                    continue;
+                }
+                if ( line[0] == '$' ) {
+                    break;
+                }
 
-                        if ( fromSkdFile && type == CATALOG::antenna && line.at( 0 ) != 'A' ) {
-                            continue;
-                        }
-                        if ( fromSkdFile && type == CATALOG::position && line.at( 0 ) != 'P' ) {
-                            continue;
-                        }
-                        if ( fromSkdFile && type == CATALOG::equip && line.at( 0 ) != 'T' ) {
-                            if ( line.at( 0 ) == 'A' ) {
-                                eqId2staName[boost::algorithm::to_upper_copy( splitVector[15] )] = splitVector[2];
-                            }
-                            continue;
-                        }
-                        if ( fromSkdFile && type != CATALOG::source ) {
-                            splitVector.erase( splitVector.begin() );
-                        }
-                        if ( fromSkdFile && type == CATALOG::equip ) {
-                            splitVector.insert(
-                                splitVector.begin(),
-                                eqId2staName[boost::algorithm::to_upper_copy( splitVector[indexOfKey - 1] )] );
-                        }
+                std::size_t pos = line.find( '*' );
+                if ( pos != CatalogFile::Token::npos ) {
+                    line = CatalogFile::trim( line.substr( 0, pos ) );
+                }
+                CatalogFile::split( line, tokens );
 
-                        if ( type == CATALOG::equip && ( splitVector.size() < 6 || splitVector[5] == "C" ) ) {
-                            continue;
-                        }
+                if ( fromSkdFile && type == CATALOG::antenna && line[0] != 'A' ) {
+                    continue;
+                }
+                if ( fromSkdFile && type == CATALOG::position && line[0] != 'P' ) {
+                    continue;
+                }
+                if ( fromSkdFile && type == CATALOG::equip && line[0] != 'T' ) {
+                    if ( line[0] == 'A' && tokens.size() > 15 ) {
+                        eqId2staName[boost::algorithm::to_upper_copy( tokens[15].to_string() )] = tokens[2].to_string();
+                    }
+                    continue;
+                }
 
-                        // get key and convert it to upper case for case insensitivity
-                        string key = splitVector[indexOfKey];
-                        // add station name to key if you look at equip.cat because id alone is not unique in catalogs
-                        if ( type == CATALOG::equip ) {
-                            key = boost::algorithm::to_upper_copy(
-                                key.append( "|" ).append( splitVector[indexOfKey - 1] ) );
-                        }
+                fields.assign( tokens.begin(), tokens.end() );
+                if ( fromSkdFile && type != CATALOG::source ) {
+                    fields.erase( fields.begin() );
+                }
+                if ( fromSkdFile && type == CATALOG::equip ) {
+                    const string &staName =
+                        eqId2staName[boost::algorithm::to_upper_copy( fields[indexOfKey - 1].to_string() )];
+                    fields.insert( fields.begin(), CatalogFile::Token( staName ) );
+                }
 
-                        // save all station keys in case of antenna catalog
-                        if ( type == CATALOG::antenna ) {
-                            // look if this station is really required
-                            if ( find( staNames_.begin(), staNames_.end(), key ) == staNames_.end() ) {
-                                continue;
-                            }
-                            antennaKey2positionKey_[key] = splitVector.at( 13 );
-                            string id_EQ = boost::algorithm::to_upper_copy( splitVector.at( 14 ) + "|" + key );
-                            antennaKey2equipKey_[key] = id_EQ;
-                            if ( splitVector.size() == 16 ) {
-                                antennaKey2maskKey_[key] = splitVector.at( 15 );
-                            } else {
-                                antennaKey2maskKey_[key] = "--";
-                            }
-                        } else if ( type == CATALOG::position ) {
-                            if ( !util::valueExists( antennaKey2positionKey_, key ) ) {
-                                continue;
-                            }
-                        } else if ( type == CATALOG::equip ) {
-                            if ( !util::valueExists( antennaKey2equipKey_, key ) ) {
-                                continue;
-                            }
-                        } else if ( type == CATALOG::mask ) {
-                            if ( !util::valueExists( antennaKey2maskKey_, key ) ) {
-                                continue;
-                            }
-                        }
+                if ( type == CATALOG::equip && ( fields.size() < 6 || fields[5] == "C" ) ) {
+                    continue;
+                }
+
+                // get key and convert it to upper case for case insensitivity
+                string key = fields[indexOfKey].to_string();
+                // add station name to key if you look at equip.cat because id alone is not unique in catalogs
+                if ( type == CATALOG::equip ) {
+                    key = boost::algorithm::to_upper_copy( key.append( "|" ).append(
+                        fields[indexOfKey - 1].data(), fields[indexOfKey - 1].size() ) );
+                }
+
+                // save all station keys in case of antenna catalog
+                if ( type == CATALOG::antenna ) {
+                    // look if this station is really required
+                    if ( !readAllStations_ && requiredKeys.find( key ) == requiredKeys.end() ) {
+                        continue;
+                    }
+                    antennaKey2positionKey_[key] = fields.at( 13 ).to_string();
+                    string id_EQ = boost::algorithm::to_upper_copy( fields.at( 14 ).to_string() + "|" + key );
+                    antennaKey2equipKey_[key] = id_EQ;
+                    if ( fields.size() == 16 ) {
+                        antennaKey2maskKey_[key] = fields.at( 15 ).to_string();
+                    } else {
+                        antennaKey2maskKey_[key] = "--";
+                    }
+                } else if ( type == CATALOG::position || type == CATALOG::equip ) {
+                    if ( requiredKeys.find( key ) == requiredKeys.end() ) {
+                        continue;
+                    }
+                }
 
-                        // look if a key already exists, if not add it.
-                        if ( all.find( key ) == all.end() ) {
-                            all.insert( pair<string, vector<string>>( key, splitVector ) );
-                        } else {
+                // look if a key already exists, if not add it.
+                if ( all.find( key ) == all.end() ) {
+                    all.insert( pair<string, vector<string>>( key, toStrings( fields ) ) );
+                } else {
 #ifdef VIESCHEDPP_LOG
-                            BOOST_LOG_TRIVIAL( warning )
-                                << "duplicated element of '" << key << "' in " << filepath << " -> ignored";
+                    BOOST_LOG_TRIVIAL( warning )
+                        << "duplicated element of '" << key << "' in " << filepath << " -> ignored";
 #else
-                            cout << "[warning] duplicated element of '" << key << "' in " << filepath << " -> ignored";
+                    cout << "[warning] duplicated element of '" << key << "' in " << filepath << " -> ignored";
 #endif
-                        }
-                    }
                 }
             }
-            // close file
-            fid.close();
             break;
         }
 
         case CATALOG::mask: {
-            // open file
-            ifstream fid( filepath );
-            if ( !fid.is_open() ) {
-#ifdef VIESCHEDPP_LOG
-                BOOST_LOG_TRIVIAL( fatal ) << "unable to open " << filepath;
-#else
-                cout << "[fatal] unable to open " << filepath;
-#endif
-                terminate();
-            } else {
-                string line;
-                // if read from skd file read until you reach flag
-                if ( fromSkdFile ) {
-                    while ( getline( fid, line ) ) {
-                        if ( boost::trim_copy( line ) == skdFlag ) {
-                            break;
-                        }
-                    }
+            static const CatalogFile::Token blank( " " );
+            vector<CatalogFile::Token> splitVector_total;
+
+            bool versionFound = false;
+            // loop through CATALOG
+            for ( ; iline < lines.size(); ++iline ) {
+                CatalogFile::Token line = lines[iline];
+                if ( !versionFound && !line.empty() ) {
+                    versionFound = readVersion( line, "mask" );
                 }
-                vector<string> splitVector_total;
-
-                bool versionFound = false;
-                // loop through CATALOG
-                while ( getline( fid, line ) ) {
-                    if ( !versionFound && line.length() > 0 ) {
-                        vector<string> splitVector;
-                        boost::split( splitVector, line, boost::is_space(), boost::token_compress_on );
-                        if ( splitVector.size() >= 3 ) {
-                            if ( boost::to_lower_copy( splitVector.at( 1 ) ) == "version" ) {
-                                catalogsVersion_["mask"] = splitVector.at( 2 );
-                                versionFound = true;
-                            }
-                        }
-                    }
-
-                    line = boost::algorithm::trim_copy( line );
-                    if ( line.length() > 0 && line.at( 0 ) != '*' ) {
-                        // trim leading and trailing blanks
-                        if ( line.at( 0 ) == '$' ) {
-                            break;
-                        }
-                        if ( fromSkdFile && line.at( 0 ) != 'H' ) {
-                            continue;
-                        }
-
-                        // if first element is not an '-' this line belongs to new station mask
-                        if ( line.at( 0 ) != '-' && !splitVector_total.empty() ) {
-                            if ( fromSkdFile ) {
-                                splitVector_total.insert( splitVector_total.begin() + 1, " " );
-                            }
 
-                            // get key and convert it to upper case for case insensitivity
-                            string key = splitVector_total[indexOfKey];
+                // trim leading and trailing blanks
+                line = CatalogFile::trim( line );
+                if ( line.empty() || line[0] == '*' ) {
+                    continue;
+                }
+                if ( line[0] == '$' ) {
+                    break;
+                }
+                if ( fromSkdFile && line[0] != 'H' ) {
+                    continue;
+                }
 
-                            // previous mask is finished, add it to map
-                            all.insert( pair<string, vector<string>>( key, splitVector_total ) );
-                            splitVector_total.clear();
-                        }
+                // if first element is not an '-' this line belongs to new station mask
+                if ( line[0] != '-' && !splitVector_total.empty() ) {
+                    if ( fromSkdFile ) {
+                        splitVector_total.insert( splitVector_total.begin() + 1, blank );
+                    }
 
-                        // split vector
-                        vector<string> splitVector;
-                        boost::split( splitVector, line, boost::is_space(), boost::token_compress_on );
+                    // get key and convert it to upper case for case insensitivity
+                    string key = splitVector_total[indexOfKey].to_string();
 
-                        // if it is a new mask add all elements to vector, if not start at the 2nd element (ignore '-')
-                        if ( splitVector_total.empty() ) {
-                            splitVector_total.insert( splitVector_total.end(), splitVector.begin(), splitVector.end() );
-                        } else {
-                            splitVector_total.insert( splitVector_total.end(), splitVector.begin() + 1,
-                                                      splitVector.end() );
-                        }
-                    }
+                    // previous mask is finished, add it to map
+                    all.insert( pair<string, vector<string>>( key, toStrings( splitVector_total ) ) );
+                    splitVector_total.clear();
                 }
 
-                if ( fromSkdFile && !splitVector_total.empty() ) {
-                    splitVector_total.insert( splitVector_total.begin() + 1, " " );
+                // split vector
+                CatalogFile::split( line, tokens );
+
+                // if it is a new mask add all elements to vector, if not start at the 2nd element (ignore '-')
+                if ( splitVector_total.empty() ) {
+                    splitVector_total.insert( splitVector_total.end(), tokens.begin(), tokens.end() );
                 } else {
-                    return all;
+                    splitVector_total.insert( splitVector_total.end(), tokens.begin() + 1, tokens.end() );
                 }
-                string key = splitVector_total[indexOfKey];
+            }
 
-                all.insert( pair<string, vector<string>>( key, splitVector_total ) );
+            if ( fromSkdFile && !splitVector_total.empty() ) {
+                splitVector_total.insert( splitVector_total.begin() + 1, blank );
+            } else {
+                return all;
             }
+            string key = splitVector_total[indexOfKey].to_string();
+
+            all.insert( pair<string, vector<string>>( key, toStrings( splitVector_total ) ) );
             break;
         }
 
         case CATALOG::flux: {
-            // open file
-            ifstream fid( filepath );
-            if ( !fid.is_open() ) {
-#ifdef VIESCHEDPP_LOG
-                BOOST_LOG_TRIVIAL( fatal ) << "unable to open " << filepath;
-#else
-                cout << "[fatal] unable to open " << filepath;
-#endif
-                terminate();
-            } else {
-                string line;
-                vector<string> lines;
-                // if read from skd file read until you reach flag
-                if ( fromSkdFile ) {
-                    while ( getline( fid, line ) ) {
-                        if ( boost::trim_copy( line ) == skdFlag ) {
-                            break;
-                        }
-                    }
+            vector<string> fluxLines;
+            string sourceName;
+
+            bool versionFound = false;
+            // get first entry
+            for ( ; iline < lines.size(); ++iline ) {
+                CatalogFile::Token line = CatalogFile::trim( lines[iline] );
+                if ( !versionFound && !line.empty() ) {
+                    versionFound = readVersion( line, "flux" );
                 }
-                vector<string> splitVector_total;
-                string sourceName;
-
-                bool versionFound = false;
-                // get first entry
-                while ( getline( fid, line ) ) {
-                    line = boost::algorithm::trim_copy( line );
-                    if ( !versionFound && line.length() > 0 ) {
-                        vector<string> splitVector;
-                        boost::split( splitVector, line, boost::is_space(), boost::token_compress_on );
-                        if ( splitVector.size() >= 3 ) {
-                            if ( boost::to_lower_copy( splitVector.at( 1 ) ) == "version" ) {
-                                catalogsVersion_["flux"] = splitVector.at( 2 );
-                                versionFound = true;
-                            }
-                        }
-                    }
 
-                    if ( line.length() > 0 && line.at( 0 ) != '*' ) {
-                        boost::split( splitVector_total, line, boost::is_space(), boost::token_compress_on );
-                        sourceName = splitVector_total[indexOfKey];
-                        lines.push_back( line );
+                if ( !line.empty() && line[0] != '*' ) {
+                    CatalogFile::split( line, tokens );
+                    sourceName = tokens[indexOfKey].to_string();
+                    fluxLines.push_back( line.to_string() );
+                    ++iline;
+                    break;
+                }
+            }
+
+            // loop through CATALOG
+            for ( ; iline < lines.size(); ++iline ) {
+                // trim leading and trailing blanks
+                CatalogFile::Token line = CatalogFile::trim( lines[iline] );
+                if ( !line.empty() && line[0] != '*' ) {
+                    if ( line[0] == '$' ) {
                         break;
                     }
-                }
 
-                // loop through CATALOG
-                while ( getline( fid, line ) ) {
-                    // trim leading and trailing blanks
-                    line = boost::algorithm::trim_copy( line );
-                    if ( line.length() > 0 && line.at( 0 ) != '*' ) {
-                        if ( line.at( 0 ) == '$' ) {
-                            break;
-                        }
+                    CatalogFile::split( line, tokens );
+                    CatalogFile::Token newStation = tokens[indexOfKey];
 
-                        vector<string> splitVector;
-                        boost::split( splitVector, line, boost::is_space(), boost::token_compress_on );
-                        string newStation = splitVector[indexOfKey];
-
-                        if ( newStation == sourceName ) {
-                            lines.push_back( line );
-                            splitVector_total.insert( splitVector_total.end(), splitVector.begin(), splitVector.end() );
-                        } else {
-                            all.insert( pair<string, vector<string>>( sourceName, lines ) );
-                            lines.clear();
-                            lines.push_back( line );
-                            sourceName = newStation;
-                            splitVector_total = splitVector;
-                        }
+                    if ( newStation == sourceName ) {
+                        fluxLines.push_back( line.to_string() );
+                    } else {
+                        all.insert( pair<string, vector<string>>( sourceName, fluxLines ) );
+                        fluxLines.clear();
+                        fluxLines.push_back( line.to_string() );
+                        sourceName = newStation.to_string();
                     }
                 }
-                all.insert( pair<string, vector<string>>( sourceName, lines ) );
             }
+            all.insert( pair<string, vector<string>>( sourceName, fluxLines ) );
             break;
         }
 
@@ -423,6 +424,237 @@ std::map<std::string, std::vector<std::string>> SkdCatalogReader::readCatalog(
 }
 
 
+bool SkdCatalogReader::writeBundle( const std::string &file ) {
+    // always read text catalogs, including all stations
+    readAllStations_ = true;
+    sourceCatalog_ = CatalogTable( readCatalog( CATALOG::source ) );
+    fluxCatalog_ = CatalogTable( readCatalog( CATALOG::flux ) );
+    antennaCatalog_ = readCatalog( CATALOG::antenna );
+    positionCatalog_ = readCatalog( CATALOG::position );
+    equipCatalog_ = readCatalog( CATALOG::equip );
+    maskCatalog_ = readCatalog( CATALOG::mask );
+    readAllStations_ = false;
+
+    PrecalcCache::Writer writer;
+    // path, size, modification time and content hash of each text catalog
+    for ( const string *path : { &sourcePath_, &fluxPath_, &antennaPath_, &positionPath_, &equipPath_, &maskPath_,
+                                 &modesPath_, &recPath_, &tracksPath_, &freqPath_, &rxPath_, &loifPath_,
+                                 &hdposPath_ } ) {
+        uint64_t size = 0;
+        int64_t mtime = 0;
+        bool exists = fileStamp( *path, size, mtime );
+        CatalogFile::Token content = catalogFile( *path ).getContent();
+        writer.write( static_cast<uint8_t>( exists ) );
+        writer.write( size );
+        writer.write( mtime );
+        writer.write( PrecalcCache::Key().addBytes( content.data(), content.size() ).value() );
+    }
+
+    sourceCatalog_.write( writer );
+    fluxCatalog_.write( writer );
+    CatalogTable( antennaCatalog_ ).write( writer );
+    CatalogTable( positionCatalog_ ).write( writer );
+    CatalogTable( equipCatalog_ ).write( writer );
+    CatalogTable( maskCatalog_ ).write( writer );
+    writeBundleMap( writer, antennaKey2positionKey_ );
+    writeBundleMap( writer, antennaKey2equipKey_ );
+    writeBundleMap( writer, antennaKey2maskKey_ );
+    writeBundleMap( writer, catalogsVersion_ );
+
+    // mode catalogs are small and only partly read, they are stored as text
+    for ( const string *path :
+          { &modesPath_, &recPath_, &tracksPath_, &freqPath_, &rxPath_, &loifPath_, &hdposPath_ } ) {
+        const CatalogFile &catalog = catalogFile( *path );
+        writer.write( static_cast<uint8_t>( catalog.isOpen() ) );
+        writer.write( catalog.getContent().to_string() );
+    }
+
+    if ( !PrecalcCache::writeFile( file, bundleKey(), writer ) ) {
+        return false;
+    }
+#ifdef VIESCHEDPP_LOG
+    BOOST_LOG_TRIVIAL( info ) << "catalog bundle written to " << file << " (" << sourceCatalog_.size()
+                              << " sources, " << antennaCatalog_.size() << " stations)";
+#else
+    cout << "[info] catalog bundle written to " << file << " (" << sourceCatalog_.size() << " sources, "
+         << antennaCatalog_.size() << " stations)\n";
+#endif
+    return true;
+}
+
+
+PrecalcCache::Key SkdCatalogReader::bundleKey() const {
+    PrecalcCache::Key key;
+    key.add( string( "catalogs" ) ).add( bundleVersion );
+    for ( const string *path : { &sourcePath_, &fluxPath_, &antennaPath_, &positionPath_, &equipPath_, &maskPath_,
+                                 &modesPath_, &recPath_, &tracksPath_, &freqPath_, &rxPath_, &loifPath_,
+                                 &hdposPath_ } ) {
+        key.add( *path );
+    }
+    return key;
+}
+
+
+bool SkdCatalogReader::loadBundle() {
+    if ( bundleLoaded_.is_initialized() ) {
+        return *bundleLoaded_;
+    }
+    bundleLoaded_ = false;
+    if ( bundlePath_.empty() ) {
+        return false;
+    }
+
+    const vector<const string *> paths = { &sourcePath_, &fluxPath_,  &antennaPath_, &positionPath_, &equipPath_,
+                                           &maskPath_,   &modesPath_, &recPath_,     &tracksPath_,   &freqPath_,
+                                           &rxPath_,     &loifPath_,  &hdposPath_ };
+    string changed;
+    string reason;
+    CatalogTable source;
+    CatalogTable flux;
+    CatalogTable antenna;
+    CatalogTable position;
+    CatalogTable equip;
+    CatalogTable mask;
+    map<string, string> positionKeys;
+    map<string, string> equipKeys;
+    map<string, string> maskKeys;
+    map<string, string> versions;
+    map<string, string> modeCatalogs;
+    bool success = PrecalcCache::readFile( bundlePath_, bundleKey(), [&]( PrecalcCache::Reader &reader ) {
+        // compare text catalogs with bundle, content is only hashed if size and modification time are not conclusive
+        for ( const string *path : paths ) {
+            uint8_t existed;
+            uint64_t size;
+            int64_t mtime;
+            uint64_t hash;
+            if ( !reader.read( existed ) || !reader.read( size ) || !reader.read( mtime ) || !reader.read( hash ) ) {
+                return false;
+            }
+            uint64_t currentSize;
+            int64_t currentMtime;
+            if ( !changed.empty() ) {
+                continue;
+            }
+            bool exists = fileStamp( *path, currentSize, currentMtime );
+            if ( !existed ) {
+                // catalog created after the bundle was written
+                if ( exists ) {
+                    changed = *path;
+                    reason = "created";
+                }
+                continue;
+            }
+            if ( !exists ) {
+                // text catalogs are the source of truth, reading them would fail as well
+                changed = *path;
+                reason = "deleted";
+                continue;
+            }
+            if ( currentSize != size ) {
+                changed = *path;
+                reason = "changed";
+            } else if ( currentMtime != mtime || bundleVerify_ ) {
+                CatalogFile::Token content = catalogFile( *path ).getContent();
+                if ( PrecalcCache::Key().addBytes( content.data(), content.size() ).value() != hash ) {
+                    changed = *path;
+                    reason = "changed";
+                }
+            }
+        }
+
+        if ( !source.read( reader ) || !flux.read( reader ) || !antenna.read( reader ) || !position.read( reader ) ||
+             !equip.read( reader ) || !mask.read( reader ) || !readBundleMap( reader, positionKeys ) ||
+             !readBundleMap( reader, equipKeys ) || !readBundleMap( reader, maskKeys ) ||
+             !readBundleMap( reader, versions ) ) {
+            return false;
+        }
+        for ( const string *path :
+              { &modesPath_, &recPath_, &tracksPath_, &freqPath_, &rxPath_, &loifPath_, &hdposPath_ } ) {
+            uint8_t exists;
+            string content;
+            if ( !reader.read( exists ) || !reader.read( content ) ) {
+                return false;
+            }
+            if ( exists ) {
+                modeCatalogs[*path] = std::move( content );
+            }
+        }
+        return true;
+    } );
+    if ( !success ) {
+        return false;
+    }
+    if ( !changed.empty() ) {
+#ifdef VIESCHEDPP_LOG
+        BOOST_LOG_TRIVIAL( warning ) << "ignoring catalog bundle " << bundlePath_ << " (" << changed << " "
+                                     << reason << " since bundle was written)";
+#else
+        cout << "[warning] ignoring catalog bundle " << bundlePath_ << " (" << changed << " " << reason
+             << " since bundle was written)\n";
+#endif
+        return false;
+    }
+
+    sourceCatalog_ = std::move( source );
+    fluxCatalog_ = std::move( flux );
+    maskCatalog_ = mask.toMap();
+    for ( const auto &any : versions ) {
+        catalogsVersion_[any.first] = any.second;
+    }
+    bundleModeCatalogs_ = std::move( modeCatalogs );
+
+    // select stations (see readCatalog), only entries of selected stations are copied
+    antennaCatalog_.clear();
+    positionCatalog_.clear();
+    equipCatalog_.clear();
+    for ( const auto &staName : staNames_ ) {
+        auto it = antenna.find( staName );
+        if ( it == antenna.end() || antennaCatalog_.find( staName ) != antennaCatalog_.end() ) {
+            continue;
+        }
+        antennaCatalog_.insert( *it );
+        antennaKey2positionKey_[staName] = positionKeys.at( staName );
+        antennaKey2equipKey_[staName] = equipKeys.at( staName );
+        antennaKey2maskKey_[staName] = maskKeys.at( staName );
+
+        auto itPosition = position.find( antennaKey2positionKey_[staName] );
+        if ( itPosition != position.end() ) {
+            positionCatalog_.insert( *itPosition );
+        }
+        auto itEquip = equip.find( antennaKey2equipKey_[staName] );
+        if ( itEquip != equip.end() ) {
+            equipCatalog_.insert( *itEquip );
+        }
+    }
+
+    bundleLoaded_ = true;
+#ifdef VIESCHEDPP_LOG
+    BOOST_LOG_TRIVIAL( info ) << "read catalogs from bundle " << bundlePath_;
+#else
+    cout << "[info] read catalogs from bundle " << bundlePath_ << "\n";
+#endif
+    return true;
+}
+
+
+std::unique_ptr<std::istream> SkdCatalogReader::openCatalog( const std::string &path ) const {
+    auto it = bundleModeCatalogs_.find( path );
+    if ( it != bundleModeCatalogs_.end() ) {
+        return make_unique<istringstream>( it->second );
+    }
+    return make_unique<ifstream>( path );
+}
+
+
+const CatalogFile &SkdCatalogReader::catalogFile( const std::string &path ) {
+    auto it = catalogFiles_.find( path );
+    if ( it == catalogFiles_.end() ) {
+        it = catalogFiles_.emplace( path, make_shared<const CatalogFile>( path ) ).first;
+    }
+    return *it->second;
+}
+
+
 void SkdCatalogReader::setCatalogFilePathes( const boost::property_tree::ptree &ptreeWithPathes ) {
     sourcePath_ = ptreeWithPathes.get<string>( "source" );
     fluxPath_ = ptreeWithPathes.get<string>( "flux" );
@@ -439,6 +671,11 @@ void SkdCatalogReader::setCatalogFilePathes( const boost::property_tree::ptree &
     rxPath_ = ptreeWithPathes.get<string>( "rx" );
     loifPath_ = ptreeWithPathes.get<string>( "loif" );
     hdposPath_ = ptreeWithPathes.get<string>("hdpos");
+
+    bundlePath_ = ptreeWithPathes.get<string>( "bundle", "" );
+    bundleVerify_ = ptreeWithPathes.get<bool>( "bundle.<xmlattr>.verify", false );
+    bundleLoaded_.reset();
+    bundleModeCatalogs_.clear();
 }
 
 
@@ -462,6 +699,11 @@ void SkdCatalogReader::setCatalogFilePathes( const std::string &antenna, const s
     rxPath_ = rx;
     loifPath_ = loif;
     hdposPath_ = hdpos;
+
+    bundlePath_ = "";
+    bundleVerify_ = false;
+    bundleLoaded_.reset();
+    bundleModeCatalogs_.clear();
 }
 
 
@@ -481,20 +723,30 @@ void SkdCatalogReader::setCatalogFilePathes( const std::string &skdFile ) {
     rxPath_ = "";
     loifPath_ = "";
     hdposPath_ = "";
+
+    bundlePath_ = "";
+    bundleVerify_ = false;
+    bundleLoaded_.reset();
+    bundleModeCatalogs_.clear();
 }
 
 
 void SkdCatalogReader::initializeSourceCatalogs() {
-    sourceCatalog_ = readCatalog( CATALOG::source );
-    fluxCatalog_ = readCatalog( CATALOG::flux );
+    if ( loadBundle() ) {
+        return;
+    }
+    sourceCatalog_ = CatalogTable( readCatalog( CATALOG::source ) );
+    fluxCatalog_ = CatalogTable( readCatalog( CATALOG::flux ) );
 }
 
 
 void SkdCatalogReader::initializeStationCatalogs() {
-    antennaCatalog_ = readCatalog( CATALOG::antenna );
-    positionCatalog_ = readCatalog( CATALOG::position );
-    equipCatalog_ = readCatalog( CATALOG::equip );
-    maskCatalog_ = readCatalog( CATALOG::mask );
+    if ( !loadBundle() ) {
+        antennaCatalog_ = readCatalog( CATALOG::antenna );
+        positionCatalog_ = readCatalog( CATALOG::position );
+        equipCatalog_ = readCatalog( CATALOG::equip );
+        maskCatalog_ = readCatalog( CATALOG::mask );
+    }
 
     saveOneLetterCode();
     saveTwoLetterCode();
@@ -514,7 +766,8 @@ void SkdCatalogReader::initializeModesCatalogs( const string &obsModeName ) {
 
 
 void SkdCatalogReader::readModesCatalog( const string &obsModeName ) {
-    ifstream fmodes( modesPath_ );
+    unique_ptr<istream> fmodesStream = openCatalog( modesPath_ );
+    istream &fmodes = *fmodesStream;
     string line;
     bool versionFound = false;
     while ( getline( fmodes, line ) ) {
@@ -543,12 +796,12 @@ void SkdCatalogReader::readModesCatalog( const string &obsModeName ) {
             }
         }
     }
-    fmodes.close();
 }
 
 
 void SkdCatalogReader::readRecCatalog() {
-    ifstream frec( recPath_ );
+    unique_ptr<istream> frecStream = openCatalog( recPath_ );
+    istream &frec = *frecStream;
     string line;
     bool versionFound = false;
     while ( getline( frec, line ) ) {
@@ -604,13 +857,13 @@ void SkdCatalogReader::readRecCatalog() {
             }
         }
     }
-    frec.close();
 }
 
 
 void SkdCatalogReader::readTracksCatalog() {
     for ( const auto &tracksId : tracksIds_ ) {
-        ifstream ftracks( tracksPath_ );
+        unique_ptr<istream> ftracksStream = openCatalog( tracksPath_ );
+        istream &ftracks = *ftracksStream;
         string line;
 
         bool versionFound = false;
@@ -669,13 +922,13 @@ void SkdCatalogReader::readTracksCatalog() {
                 }
             }
         }
-        ftracks.close();
     }
 }
 
 
 void SkdCatalogReader::readFreqCatalog() {
-    ifstream ffreq( freqPath_ );
+    unique_ptr<istream> ffreqStream = openCatalog( freqPath_ );
+    istream &ffreq = *ffreqStream;
     string line;
 
     bool versionFound = false;
@@ -725,12 +978,12 @@ void SkdCatalogReader::readFreqCatalog() {
             }
         }
     }
-    ffreq.close();
 }
 
 
 void SkdCatalogReader::readRxCatalog() {
-    ifstream frx( rxPath_ );
+    unique_ptr<istream> frxStream = openCatalog( rxPath_ );
+    istream &frx = *frxStream;
     string line;
 
     bool versionFound = false;
@@ -775,7 +1028,6 @@ void SkdCatalogReader::readRxCatalog() {
             }
         }
     }
-    frx.close();
 }
 
 
@@ -783,7 +1035,8 @@ void SkdCatalogReader::readLoifCatalog() {
     string line;
     vector<string> lastItem;
     for ( const auto &loifId : loifIds_ ) {
-        ifstream floif( loifPath_ );
+        unique_ptr<istream> floifStream = openCatalog( loifPath_ );
+        istream &floif = *floifStream;
 
         bool versionFound = false;
         while ( getline( floif, line ) ) {
@@ -825,7 +1078,6 @@ void SkdCatalogReader::readLoifCatalog() {
             loifId2loifInfo_[loifId] = lastItem;
         }
 
-        floif.close();
     }
 }
 
@@ -835,7 +1087,8 @@ void SkdCatalogReader::readHdposCatalog() {
     vector<string> lastItem;
     string hdpos_id;
 
-    ifstream fid(hdposPath_);
+    unique_ptr<istream> fidStream = openCatalog( hdposPath_ );
+    istream &fid = *fidStream;
 
     vector<string> hdpos_ids;
     for (const auto &any : staName2hdposMap_) {
@@ -884,7 +1137,6 @@ void SkdCatalogReader::readHdposCatalog() {
         }
     }
 
-    fid.close();
 }
 
 
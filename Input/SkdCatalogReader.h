@@ -36,10 +36,17 @@
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <set>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include "../Misc/PrecalcCache.h"
 #include "../Misc/VieVS_Object.h"
+#include "CatalogFile.h"
+#include "CatalogTable.h"
 #include "../Misc/util.h"
 #ifdef VIESCHEDPP_LOG
 #include <boost/log/trivial.hpp>
@@ -83,6 +90,9 @@ class SkdCatalogReader : public VieVS_Object {
      * @brief setter for catalog pathes
      * @author Matthias Schartner
      *
+     * The optional entry "bundle" defines a binary catalog bundle (see writeBundle). Its attribute verify="true"
+     * compares the content of all text catalogs with the bundle instead of only their size and modification time.
+     *
      * @param ptreeWithPathes property tree with catalog pathes from .xml file
      */
     void setCatalogFilePathes( const boost::property_tree::ptree &ptreeWithPathes );
@@ -145,6 +155,29 @@ class SkdCatalogReader : public VieVS_Object {
     void initializeModesCatalogs( const std::string &obsModeName );
 
 
+    /**
+     * @brief write binary catalog bundle
+     * @author Matthias Schartner
+     *
+     * All text catalogs are read (including all stations) and stored in a binary file together with the path, size,
+     * modification time and a hash of the content of each text catalog. The bundle is used as long as the text
+     * catalogs are unchanged.
+     *
+     * @param file bundle file name
+     * @return true if successful
+     */
+    bool writeBundle( const std::string &file );
+
+
+    /**
+     * @brief check if catalogs are loaded from binary catalog bundle
+     * @author Matthias Schartner
+     *
+     * @return true if catalogs are loaded from bundle
+     */
+    bool isBundleLoaded() const noexcept { return bundleLoaded_.get_value_or( false ); }
+
+
     /**
      * @brief set station names
      * @author Matthias Schartner
@@ -185,18 +218,18 @@ class SkdCatalogReader : public VieVS_Object {
      * @brief getter for source catalog
      * @author Matthias Schartner
      *
-     * @return map with source name id as key and the corresponding catalog line as value
+     * @return table with source name id as key and the corresponding catalog line as value
      */
-    const std::map<std::string, std::vector<std::string>> &getSourceCatalog() const { return sourceCatalog_; }
+    const CatalogTable &getSourceCatalog() const { return sourceCatalog_; }
 
 
     /**
      * @brief getter for flux catalog
      * @author Matthias Schartner
      *
-     * @return map with source name as key and all flux infos as value
+     * @return table with source name as key and all flux infos as value
      */
-    const std::map<std::string, std::vector<std::string>> &getFluxCatalog() const { return fluxCatalog_; }
+    const CatalogTable &getFluxCatalog() const { return fluxCatalog_; }
 
 
     /**
@@ -468,7 +501,7 @@ class SkdCatalogReader : public VieVS_Object {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     std::vector<std::string> staNames_;  ///< list of all station
 
@@ -487,14 +520,18 @@ class SkdCatalogReader : public VieVS_Object {
     std::string rxPath_;      ///< rx catalog name
     std::string loifPath_;    ///< loif catalog name
     std::string hdposPath_;   ///< hdpos catalog name
+    std::string bundlePath_;  ///< binary catalog bundle name (optional)
+
+    bool bundleVerify_ = false;                              ///< compare content of text catalogs with bundle
+    boost::optional<bool> bundleLoaded_;                     ///< flag if catalog bundle is loaded (once checked)
+    bool readAllStations_ = false;                           ///< read all stations of antenna catalog
+    std::map<std::string, std::string> bundleModeCatalogs_;  ///< content of mode catalogs from bundle per path
 
     std::map<std::string, char> oneLetterCode_;         ///< map with station name as key and one letter codes as value
     std::map<std::string, std::string> twoLetterCode_;  ///< map with station name as key and two letter code as value
 
-    std::map<std::string, std::vector<std::string>>
-        sourceCatalog_;  ///< map with source name as key and catalog entry as value
-    std::map<std::string, std::vector<std::string>>
-        fluxCatalog_;  ///< map with source name as key and flux catalog entry as value
+    CatalogTable sourceCatalog_;  ///< table with source name as key and catalog entry as value
+    CatalogTable fluxCatalog_;    ///< table with source name as key and flux catalog entry as value
 
     std::map<std::string, std::vector<std::string>>
         antennaCatalog_;  ///< map with station name as key and catalog entry as value
@@ -549,10 +586,65 @@ class SkdCatalogReader : public VieVS_Object {
 
     std::map<std::string, std::string> catalogsVersion_;  ///< skd catalog versions
 
+    std::unordered_map<std::string, std::shared_ptr<const CatalogFile>>
+        catalogFiles_;  ///< memory mapped catalog files (shared by all catalogs stored in the same file)
+
+    /**
+     * @brief memory mapped catalog file
+     * @author Matthias Schartner
+     *
+     * Each file is mapped only once.
+     *
+     * @param path path to file
+     * @return catalog file
+     */
+    const CatalogFile &catalogFile( const std::string &path );
+
+
+    /**
+     * @brief hash of the pathes of all text catalogs
+     * @author Matthias Schartner
+     *
+     * @return bundle key
+     */
+    PrecalcCache::Key bundleKey() const;
+
+
+    /**
+     * @brief load binary catalog bundle
+     * @author Matthias Schartner
+     *
+     * The bundle is only used if the text catalogs did not change since the bundle was written. Text catalogs are
+     * compared by size and modification time, their content is only hashed if the modification time changed or if
+     * full verification is requested. Text catalogs which were deleted or created after the bundle was written make
+     * it stale as well.
+     *
+     * Source and flux catalog are used as stored in the bundle. Stations are selected the same way as in
+     * readCatalog, only their entries are copied to the station catalogs.
+     *
+     * @return true if catalogs are loaded from bundle
+     */
+    bool loadBundle();
+
+
+    /**
+     * @brief open catalog file as stream
+     * @author Matthias Schartner
+     *
+     * Content from the catalog bundle is used if available.
+     *
+     * @param path path to catalog
+     * @return catalog stream
+     */
+    std::unique_ptr<std::istream> openCatalog( const std::string &path ) const;
+
+
     /**
      * @brief This function reads a specific sked catalog file and stores the data in a map.
      * @author Matthias Schartner
      *
+     * Lines are tokenized into views of the memory mapped file, strings are only created for stored entries.
+     *
      * @param type catalog file which should be read
      * @return key is list of all Ids, value is corresponding catalog entry
      */
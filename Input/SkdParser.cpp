@@ -22,7 +22,7 @@
 using namespace VieVS;
 using namespace std;
 
-unsigned long SkdParser::nextId = 0;
+std::atomic<unsigned long> SkdParser::nextId{ 0 };
 
 
 SkdParser::SkdParser(const std::string &filename) : VieVS_Object(nextId++) {
@@ -340,6 +340,7 @@ void SkdParser::read() {
 
     ObservingMode::sourceBackupValue = sourceBackupValue;
     ObservingMode::stationBackupValue = stationBackupValue;
+    ObservingMode::indexBands();
 
     init.createSources( skd_, of );
 
@@ -107,7 +107,7 @@ class SkdParser : public VieVS_Object {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     std::string fname_;          ///< skd file name
     std::string fpath_;          ///< skd file path
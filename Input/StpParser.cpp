@@ -6,7 +6,7 @@
 
 using namespace VieVS;
 using namespace std;
-unsigned long StpParser::nextId = 0;
+std::atomic<unsigned long> StpParser::nextId{ 0 };
 
 void StpParser::parse() {
     std::ifstream file( fname_ );
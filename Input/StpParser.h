@@ -68,7 +68,7 @@ class StpParser : public VieVS_Object {
     std::shared_ptr<AbstractHorizonMask> getHorizionMask() { return mask_; }
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
 
     std::string fname_;
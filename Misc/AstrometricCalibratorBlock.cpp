@@ -28,8 +28,6 @@ unsigned int AstrometricCalibratorBlock::cadence = 0;
 AstrometricCalibratorBlock::CadenceUnit AstrometricCalibratorBlock::cadenceUnit =
     AstrometricCalibratorBlock::CadenceUnit::seconds;
 
-unsigned int AstrometricCalibratorBlock::nextBlock = 0;
-
 std::vector<unsigned long> AstrometricCalibratorBlock::calibratorSourceIds{};
 
 unsigned int AstrometricCalibratorBlock::nmaxScans = 0;
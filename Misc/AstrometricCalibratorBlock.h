@@ -69,8 +69,6 @@ class AstrometricCalibratorBlock {
     static unsigned int cadence;     ///< cadence
     static CadenceUnit cadenceUnit;  ///< cadence unit
 
-    static unsigned int nextBlock;  ///< seconds/number of scans when next block should start
-
     static std::vector<unsigned long> calibratorSourceIds;  ///< list of calibrator sources
 
     static unsigned int nmaxScans;  ///< maximum number of scans per calibrator block
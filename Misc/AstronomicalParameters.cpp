@@ -18,6 +18,9 @@
 
 #include "AstronomicalParameters.h"
 
+#include "TimeSystem.h"
+#include "sofa.h"
+
 
 using namespace VieVS;
 
@@ -32,43 +35,75 @@ std::vector<double> AstronomicalParameters::sun_ra;          ///< right ascensio
 std::vector<double> AstronomicalParameters::sun_dec;         ///< right ascension and declination of sun
 std::vector<unsigned int> AstronomicalParameters::sun_time;  ///< right ascension and declination of sun
 
-unsigned int AstronomicalParameters::getNutInterpolationIdx( unsigned int time ) {
-    unsigned int nut_precalc_idx = 0;
-    while ( AstronomicalParameters::earth_nutTime[nut_precalc_idx + 1] < time ) {
-        ++nut_precalc_idx;
+EphemerisTable AstronomicalParameters::earth_nut;  ///< nutation x, y and s
+EphemerisTable AstronomicalParameters::sun;        ///< right ascension and declination of sun
+
+namespace {
+/**
+ * @brief celestial to terrestrial rotation matrix of last requested epoch
+ * @author Matthias Schartner
+ */
+struct C2tCache {
+    unsigned long version = 0;  ///< version of interpolation tables used for calculation (0 = invalid)
+    double mjdStart = 0;        ///< session start used for calculation
+    unsigned int time = 0;      ///< epoch
+    double c2t[3][3] = {};      ///< rotation matrix
+};
+unsigned long tableVersion = 0;  ///< incremented whenever interpolation tables are created
+thread_local C2tCache c2tCache;
+}  // namespace
+
+void AstronomicalParameters::indexTables() {
+    unsigned int nutStep = earth_nutTime.size() > 1 ? earth_nutTime[1] - earth_nutTime[0] : 1;
+    earth_nut = EphemerisTable( nutStep, { earth_nutX, earth_nutY, earth_nutS } );
+
+    unsigned int sunStep = sun_time.size() > 1 ? sun_time[1] - sun_time[0] : 1;
+    sun = EphemerisTable( sunStep, { sun_ra, sun_dec } );
+
+    // tables changed, force recalculation of cached matrices
+    ++tableVersion;
+}
+
+void AstronomicalParameters::celestial2terrestrial( unsigned int time, double c2t[3][3] ) noexcept {
+    C2tCache &cache = c2tCache;
+    if ( cache.version != tableVersion || cache.mjdStart != TimeSystem::mjdStart || cache.time != time ) {
+        //  TIME
+        double date1 = 2400000.5;
+        double mjd = TimeSystem::mjdStart + static_cast<double>( time ) / 86400.0;
+
+        // Earth Rotation
+        double ERA = iauEra00( date1, mjd );
+
+        // precession nutation
+        double C[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+        unsigned int idx = earth_nut.index( time );
+        double x = earth_nut.interpolate( time, idx, 0 );
+        double y = earth_nut.interpolate( time, idx, 1 );
+        double s = earth_nut.interpolate( time, idx, 2 );
+        iauC2ixys( x, y, s, C );
+
+        //  Polar Motion
+        double W[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+        //  GCRS to ITRS
+        iauC2tcio( C, ERA, W, cache.c2t );
+
+        cache.version = tableVersion;
+        cache.mjdStart = TimeSystem::mjdStart;
+        cache.time = time;
     }
-    return nut_precalc_idx;
+    iauCr( cache.c2t, c2t );
 }
 
+unsigned int AstronomicalParameters::getNutInterpolationIdx( unsigned int time ) { return earth_nut.index( time ); }
+
 double AstronomicalParameters::getNutX( unsigned int time, unsigned int interpolationIdx ) {
-    unsigned int delta = AstronomicalParameters::earth_nutTime[1] - AstronomicalParameters::earth_nutTime[0];
-    unsigned int deltaTime = time - AstronomicalParameters::earth_nutTime[interpolationIdx];
-
-    double X = AstronomicalParameters::earth_nutX[interpolationIdx] +
-               ( AstronomicalParameters::earth_nutX[interpolationIdx + 1] -
-                 AstronomicalParameters::earth_nutX[interpolationIdx] ) /
-                   delta * deltaTime;
-    return X;
+    return earth_nut.interpolate( time, interpolationIdx, 0 );
 }
 
 double AstronomicalParameters::getNutY( unsigned int time, unsigned int interpolationIdx ) {
-    unsigned int delta = AstronomicalParameters::earth_nutTime[1] - AstronomicalParameters::earth_nutTime[0];
-    unsigned int deltaTime = time - AstronomicalParameters::earth_nutTime[interpolationIdx];
-
-    double Y = AstronomicalParameters::earth_nutY[interpolationIdx] +
-               ( AstronomicalParameters::earth_nutY[interpolationIdx + 1] -
-                 AstronomicalParameters::earth_nutY[interpolationIdx] ) /
-                   delta * deltaTime;
-    return Y;
+    return earth_nut.interpolate( time, interpolationIdx, 1 );
 }
 
 double AstronomicalParameters::getNutS( unsigned int time, unsigned int interpolationIdx ) {
-    unsigned int delta = AstronomicalParameters::earth_nutTime[1] - AstronomicalParameters::earth_nutTime[0];
-    unsigned int deltaTime = time - AstronomicalParameters::earth_nutTime[interpolationIdx];
-
-    double S = AstronomicalParameters::earth_nutS[interpolationIdx] +
-               ( AstronomicalParameters::earth_nutS[interpolationIdx + 1] -
-                 AstronomicalParameters::earth_nutS[interpolationIdx] ) /
-                   delta * deltaTime;
-    return S;
+    return earth_nut.interpolate( time, interpolationIdx, 2 );
 }
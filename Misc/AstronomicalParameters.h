@@ -30,6 +30,8 @@
 
 #include <vector>
 
+#include "EphemerisTable.h"
+
 
 namespace VieVS {
 
@@ -55,6 +57,31 @@ class AstronomicalParameters {
     static std::vector<double> sun_dec;         ///< declination of sun in radians
     static std::vector<unsigned int> sun_time;  ///< corresponding times of sun_ra and sun_rc entries
 
+    static EphemerisTable earth_nut;  ///< nutation x, y and s (columns 0, 1, 2) for direct index interpolation
+    static EphemerisTable sun;        ///< right ascension and declination of sun (columns 0, 1)
+
+
+    /**
+     * @brief create interpolation tables from nutation and sun time series
+     * @author Matthias Schartner
+     *
+     * Requires uniformly spaced entries in earth_nutTime and sun_time starting at session start.
+     */
+    static void indexTables();
+
+
+    /**
+     * @brief celestial to terrestrial rotation matrix (earth rotation and precession-nutation)
+     * @author Matthias Schartner
+     *
+     * The matrix of the last requested epoch is cached per thread and reused by all stations at this epoch.
+     *
+     * @param time time in seconds since session start
+     * @param c2t rotation matrix (output)
+     */
+    static void celestial2terrestrial( unsigned int time, double c2t[3][3] ) noexcept;
+
+
     static unsigned int getNutInterpolationIdx( unsigned int time );
     static double getNutX( unsigned int time, unsigned int interpolationIdx );
     static double getNutY( unsigned int time, unsigned int interpolationIdx );
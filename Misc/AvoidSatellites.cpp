@@ -16,11 +16,17 @@ double AvoidSatellites::orbitErrorPerDay = 2000;      /// set to 2 km by default
 double AvoidSatellites::minElevation = 20 * deg2rad;  /// set minimum elevation to 20 degrees
 int AvoidSatellites::frequency = 10;
 double AvoidSatellites::outputPercentage = 0.10;
-unordered_map<int, unordered_map<int, vector<pair<int, int>>>> AvoidSatellites::visible_{};
+unsigned int AvoidSatellites::bucketLength = 30;  /// avoidance index with 30 second time buckets
+vector<AvoidSatellites::VisibleWindows> AvoidSatellites::visible_{};
+vector<AvoidSatellites::AvoidanceIndex> AvoidSatellites::index_{};
 
-void AvoidSatellites::initialize( Network& network ) {
-    unsigned int dt = 60;
+namespace {
+// upper bound of velocity of satellite relative to station in meters per second
+// (escape velocity at Earth's surface plus rotational velocity at the equator)
+constexpr double maxVelocity = 11.2e3 + 0.47e3;
+}  // namespace
 
+void AvoidSatellites::initialize( Network& network ) {
     if ( satellitesToAvoid.size() > 1e3 ) {
 #ifdef VIESCHEDPP_LOG
         BOOST_LOG_TRIVIAL( info ) << "this might take a while (" << network.getNSta() << " stations with "
@@ -31,13 +37,33 @@ void AvoidSatellites::initialize( Network& network ) {
 #endif
     }
 
-    unsigned long total = network.getNSta() * satellitesToAvoid.size();
+    PrecalcCache::Key key = cacheKey( network );
+    if ( PrecalcCache::load( "avoidsatellites", key, load ) ) {
+        return;
+    }
+
+    unsigned long nsta = network.getNSta();
+    unsigned long nsat = satellitesToAvoid.size();
+    unsigned long total = nsta * nsat;
     unsigned long counter = 0;
     double next_percentage = outputPercentage;
 
-    for ( auto& sta : network.refStations() ) {
-        unsigned long staid = sta.getId();
-        for ( const auto& sat : satellitesToAvoid ) {
+    vector<vector<Window>> windows( total );
+    vector<vector<pair<unsigned long, Candidate>>> candidates( total );
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic )
+#endif
+    for ( long i = 0; i < static_cast<long>( total ); ++i ) {
+        // stations are shared between threads, only const member functions are allowed
+        const Station& sta = network.getStations()[i / nsat];
+        windows[i] = calcWindows( sta, satellitesToAvoid[i % nsat] );
+        candidates[i] = calcCandidates( sta, i % nsat, windows[i] );
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
             ++counter;
             if ( next_percentage > 0 &&
                  static_cast<double>( counter ) / static_cast<double>( total ) > next_percentage ) {
@@ -48,42 +74,218 @@ void AvoidSatellites::initialize( Network& network ) {
 #endif
                 next_percentage += outputPercentage;
             }
-            vector<pair<int, int>> tmp;
-            unsigned long satid = sat->getId();
-
-            PointingVector pv( staid, satid );
-            pv.setTime( 0 );
-            sta.calcAzEl_rigorous( sat, pv );
-
-            bool visible = sta.isVisible( pv, AvoidSatellites::minElevation );
-            unsigned int startTime = 0;
-            unsigned int endTime = 0;
-
-            for ( unsigned int i = dt; i < TimeSystem::duration; i += dt ) {
-                pv.setTime( i );
-                sta.calcAzEl_rigorous( sat, pv );
-
-                bool nowVisible = sta.isVisible( pv, AvoidSatellites::minElevation );
-                if ( !visible && nowVisible ) {
-                    startTime = i - dt;
-                    visible = true;
-                }
-                if ( visible && !nowVisible ) {
-                    endTime = i;
-                    tmp.emplace_back( startTime, endTime );
-                    visible = false;
-                    startTime = 0;
-                    endTime = 0;
-                }
+        }
+    }
+
+    unsigned long maxStaid = 0;
+    for ( const auto& sta : network.getStations() ) {
+        maxStaid = max( maxStaid, sta.getId() );
+    }
+    visible_.clear();
+    visible_.resize( nsta == 0 ? 0 : maxStaid + 1 );
+    for ( unsigned long ista = 0; ista < nsta; ++ista ) {
+        VisibleWindows& v = visible_[network.getStations()[ista].getId()];
+        v.offset.reserve( nsat + 1 );
+        v.offset.push_back( 0 );
+        for ( unsigned long isat = 0; isat < nsat; ++isat ) {
+            const vector<Window>& w = windows[ista * nsat + isat];
+            v.windows.insert( v.windows.end(), w.begin(), w.end() );
+            v.offset.push_back( v.windows.size() );
+        }
+    }
+
+    unsigned long nBuckets = TimeSystem::duration / bucketLength + 1;
+    index_.clear();
+    index_.resize( visible_.size() );
+    for ( unsigned long ista = 0; ista < nsta; ++ista ) {
+        AvoidanceIndex& v = index_[network.getStations()[ista].getId()];
+
+        // counting sort by bucket (satellites stay sorted within each bucket)
+        v.offset.assign( nBuckets + 1, 0 );
+        for ( unsigned long isat = 0; isat < nsat; ++isat ) {
+            for ( const auto& any : candidates[ista * nsat + isat] ) {
+                ++v.offset[any.first + 1];
             }
+        }
+        for ( unsigned long b = 0; b < nBuckets; ++b ) {
+            v.offset[b + 1] += v.offset[b];
+        }
+        v.candidates.resize( v.offset.back() );
+        vector<unsigned long> next( v.offset.begin(), v.offset.end() - 1 );
+        for ( unsigned long isat = 0; isat < nsat; ++isat ) {
+            for ( const auto& any : candidates[ista * nsat + isat] ) {
+                v.candidates[next[any.first]++] = any.second;
+            }
+        }
+    }
+
+    if ( PrecalcCache::enabled() ) {
+        PrecalcCache::Writer writer;
+        save( writer );
+        PrecalcCache::store( "avoidsatellites", key, writer );
+    }
+}
+
+
+PrecalcCache::Key AvoidSatellites::cacheKey( const Network& network ) {
+    PrecalcCache::Key key;
+    key.add( string( "avoidsatellites" ) ).add( TimeSystem::mjdStart ).add( TimeSystem::duration );
+    key.add( minElevation ).add( bucketLength ).add( orbitError ).add( orbitErrorPerDay ).add( extraMargin );
+    for ( const auto& sta : network.getStations() ) {
+        const auto& pos = sta.getPosition();
+        key.add( sta.getId() ).add( sta.getName() ).add( pos->getX() ).add( pos->getY() ).add( pos->getZ() );
+    }
+    for ( const auto& sat : satellitesToAvoid ) {
+        key.add( sat->getName() ).add( sat->getTleData() );
+    }
+    return key;
+}
+
+
+void AvoidSatellites::save( PrecalcCache::Writer& writer ) {
+    writer.write( static_cast<uint64_t>( visible_.size() ) );
+    for ( const auto& v : visible_ ) {
+        vector<unsigned int> flat;
+        flat.reserve( 2 * v.windows.size() );
+        for ( const auto& w : v.windows ) {
+            flat.push_back( w.first );
+            flat.push_back( w.second );
+        }
+        writer.write( v.offset );
+        writer.write( flat );
+    }
+    for ( const auto& v : index_ ) {
+        writer.write( v.offset );
+        writer.write( v.candidates );
+    }
+}
+
+
+bool AvoidSatellites::load( PrecalcCache::Reader& reader ) {
+    uint64_t n;
+    if ( !reader.read( n ) ) {
+        return false;
+    }
+    vector<VisibleWindows> visible( n );
+    vector<AvoidanceIndex> index( n );
+    for ( auto& v : visible ) {
+        vector<unsigned int> flat;
+        if ( !reader.read( v.offset ) || !reader.read( flat ) || flat.size() % 2 != 0 ) {
+            return false;
+        }
+        for ( unsigned long i = 0; i < flat.size(); i += 2 ) {
+            v.windows.emplace_back( flat[i], flat[i + 1] );
+        }
+    }
+    for ( auto& v : index ) {
+        if ( !reader.read( v.offset ) || !reader.read( v.candidates ) ) {
+            return false;
+        }
+    }
+
+    visible_ = std::move( visible );
+    index_ = std::move( index );
+    return true;
+}
+
+
+unsigned long AvoidSatellites::nVisibleWindows() noexcept {
+    unsigned long n = 0;
+    for ( const auto& any : visible_ ) {
+        n += any.windows.size();
+    }
+    return n;
+}
+
+
+vector<AvoidSatellites::Window> AvoidSatellites::calcWindows( const Station& sta,
+                                                              const shared_ptr<Satellite>& sat ) {
+    vector<Window> windows;
+    PointingVector pv( sta.getId(), sat->getId() );
+
+    bool visible = false;
+    unsigned int startTime = 0;
+    unsigned int previous = 0;
+    unsigned int t = 0;
+    while ( true ) {
+        pv.setTime( t );
+        sta.calcAzEl_rigorousUncached( sat, pv );
+        double delta = pv.getEl() - minElevation;
+
+        bool nowVisible = delta >= 0;
+        if ( !visible && nowVisible ) {
+            startTime = previous;
+            visible = true;
+        }
+        if ( visible && !nowVisible ) {
+            windows.emplace_back( startTime, t );
+            visible = false;
+        }
+        if ( t >= TimeSystem::duration ) {
+            break;
+        }
+
+        // Within dt, the topocentric direction changes by at most v*dt/(r-v*dt) in the celestial frame (r ...
+        // distance, v ... velocity) and the local horizon rotates by at most omega*dt with the Earth. Therefore,
+        // the elevation can not cross the minimum elevation as long as dt*(v/(r-v*dt)+omega) <= |delta| (smaller
+        // root of the corresponding quadratic equation).
+        double distance = get<2>( sat->calcRaDeDistTime( t, sta.getPosition() ) );
+        double d = abs( delta );
+        double b = maxVelocity * ( 1 + d ) + omega * distance;
+        double step = 2 * d * distance / ( b + sqrt( b * b - 4 * maxVelocity * omega * d * distance ) );
+        step = min( step, static_cast<double>( TimeSystem::duration - t ) );
+
+        previous = t;
+        t += max( 1u, static_cast<unsigned int>( step ) );
+        t = min( t, TimeSystem::duration );
+    }
+
+    if ( visible ) {
+        windows.emplace_back( startTime, TimeSystem::duration );
+    }
+    return windows;
+}
+
+
+vector<pair<unsigned long, AvoidSatellites::Candidate>> AvoidSatellites::calcCandidates(
+    const Station& sta, unsigned long satIdx, const vector<Window>& windows ) {
+    const auto& sat = satellitesToAvoid[satIdx];
+    // margin for rounding of cone radius to single precision
+    constexpr double roundingMargin = 1e-3;
+
+    vector<pair<unsigned long, Candidate>> candidates;
+    for ( const auto& window : windows ) {
+        for ( unsigned long b = window.first / bucketLength; b <= window.second / bucketLength; ++b ) {
+            unsigned int bucketStart = b * bucketLength;
+            unsigned int bucketEnd = bucketStart + bucketLength;
+            double halfLength = 0.5 * bucketLength;
+            unsigned int mid = bucketStart + bucketLength / 2;
+
+            Candidate c{};
+            c.start = window.first;
+            c.end = window.second;
+            c.satIdx = satIdx;
 
+            double ra, de, distance, dt;
+            tie( ra, de, distance, dt ) = sat->calcRaDeDistTime( mid, sta.getPosition() );
+            c.x = static_cast<float>( cos( de ) * cos( ra ) );
+            c.y = static_cast<float>( cos( de ) * sin( ra ) );
+            c.z = static_cast<float>( sin( de ) );
 
-            if ( visible ) {
-                endTime = TimeSystem::duration;
-                tmp.emplace_back( startTime, endTime );
+            // the distance can not decrease below minDistance within the bucket
+            double minDistance = distance - maxVelocity * halfLength;
+            if ( minDistance <= 0 || sat->nearestTle( bucketStart ) != sat->nearestTle( bucketEnd ) ) {
+                // no pre-filtering possible (satellite too close or position jumps to other TLE data)
+                c.cosRadius = -2;
+            } else {
+                double motion = log( distance / minDistance );
+                double orbitErr = orbitError + orbitErrorPerDay * ( dt + halfLength / 86400.0 );
+                double radius = motion + atan( orbitErr / minDistance ) + extraMargin + roundingMargin;
+                c.cosRadius = radius < pi ? static_cast<float>( cos( radius ) ) : -2.f;
             }
-            visible_[staid][satid] = tmp;
+            candidates.emplace_back( b, c );
         }
     }
+    return candidates;
 }
 /// by default, check satellite position every 10 seconds
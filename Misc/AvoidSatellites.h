@@ -6,6 +6,7 @@
 #define VIESCHEDPP_AVOIDSATELLITES_H
 
 #include "../Source/Satellite.h"
+#include "PrecalcCache.h"
 
 namespace VieVS {
 /**
@@ -25,10 +26,178 @@ class AvoidSatellites {
     static double minElevation;
     static int frequency;
     static double outputPercentage;
+    static unsigned int bucketLength;  ///< length of time buckets of avoidance index in seconds
 
+    /**
+     * @brief period in which a satellite might be above minimum elevation
+     * @author Matthias Schartner
+     */
+    using Window = std::pair<unsigned int, unsigned int>;
+
+
+    /**
+     * @brief satellite which might be close to a source direction during one time bucket
+     * @author Matthias Schartner
+     */
+    struct Candidate {
+        float x;               ///< x component of satellite direction in the middle of the bucket
+        float y;               ///< y component of satellite direction in the middle of the bucket
+        float z;               ///< z component of satellite direction in the middle of the bucket
+        float cosRadius;       ///< cosine of radius of cone in which the satellite might be harmful
+        unsigned int start;    ///< start of visibility window
+        unsigned int end;      ///< end of visibility window
+        unsigned long satIdx;  ///< index of satellite in satellitesToAvoid
+    };
+
+
+    /**
+     * @brief calculate periods in which satellites are visible for each station
+     * @author Matthias Schartner
+     *
+     * Elevation is sampled with an adaptive time step. The step is chosen such that the satellite can not cross
+     * the minimum elevation in between two samples, given an upper bound of its topocentric angular rate (satellite
+     * motion relative to the station plus rotation of the local horizon with the Earth). Far away from a rise or set
+     * crossing this allows steps of many minutes, close to a crossing the step is refined down to one second. The
+     * resulting windows therefore contain all epochs in which the satellite is above the minimum elevation.
+     *
+     * Afterwards, the avoidance index is build. For each station and time bucket, it lists all satellites with a
+     * visibility window overlapping the bucket together with a cone around the satellite direction. A satellite can
+     * only get closer to a source than the avoidance threshold if the source is inside this cone.
+     *
+     * The calculation is parallelized over all combinations of stations and satellites. Results are read from and
+     * written to the precalculation cache if it is enabled (see PrecalcCache).
+     *
+     * @param network station network
+     */
     static void initialize( Network &network );
 
-    static std::unordered_map<int, std::unordered_map<int, std::vector<std::pair<int, int>>>> visible_;
+
+    /**
+     * @brief visibility windows of one satellite at one station
+     * @author Matthias Schartner
+     *
+     * @param staid station id
+     * @param satIdx index of satellite in satellitesToAvoid
+     * @return begin and end of windows sorted by time
+     */
+    static std::pair<const Window *, const Window *> visibleWindows( unsigned long staid,
+                                                                     unsigned long satIdx ) noexcept {
+        if ( staid >= visible_.size() || satIdx + 1 >= visible_[staid].offset.size() ) {
+            return { nullptr, nullptr };
+        }
+        const VisibleWindows &v = visible_[staid];
+        const Window *data = v.windows.data();
+        return { data + v.offset[satIdx], data + v.offset[satIdx + 1] };
+    }
+
+
+    /**
+     * @brief total number of visibility windows
+     * @author Matthias Schartner
+     *
+     * @return number of windows over all stations and satellites
+     */
+    static unsigned long nVisibleWindows() noexcept;
+
+
+    /**
+     * @brief satellites which might be visible at one station at a certain time
+     * @author Matthias Schartner
+     *
+     * The visibility window and cone of each candidate must still be checked by the caller.
+     *
+     * @param staid station id
+     * @param time time in seconds since session start
+     * @return begin and end of candidates
+     */
+    static std::pair<const Candidate *, const Candidate *> candidates( unsigned long staid,
+                                                                       unsigned int time ) noexcept {
+        if ( staid >= index_.size() ) {
+            return { nullptr, nullptr };
+        }
+        const AvoidanceIndex &v = index_[staid];
+        unsigned long bucket = time / bucketLength;
+        if ( bucket + 1 >= v.offset.size() ) {
+            return { nullptr, nullptr };
+        }
+        const Candidate *data = v.candidates.data();
+        return { data + v.offset[bucket], data + v.offset[bucket + 1] };
+    }
+
+   private:
+    /**
+     * @brief visibility windows of all satellites at one station
+     * @author Matthias Schartner
+     */
+    struct VisibleWindows {
+        std::vector<unsigned long> offset;  ///< index of first window per satellite (size: number of satellites + 1)
+        std::vector<Window> windows;        ///< visibility windows of all satellites
+    };
+
+    /**
+     * @brief satellite candidates per time bucket at one station
+     * @author Matthias Schartner
+     */
+    struct AvoidanceIndex {
+        std::vector<unsigned long> offset;  ///< index of first candidate per bucket (size: number of buckets + 1)
+        std::vector<Candidate> candidates;  ///< candidates of all buckets
+    };
+
+    static std::vector<VisibleWindows> visible_;  ///< visibility windows per station id
+    static std::vector<AvoidanceIndex> index_;    ///< avoidance index per station id
+
+
+    /**
+     * @brief calculate visibility windows of one satellite at one station
+     * @author Matthias Schartner
+     *
+     * @param sta station
+     * @param sat satellite
+     * @return visibility windows sorted by time
+     */
+    static std::vector<Window> calcWindows( const Station &sta, const std::shared_ptr<Satellite> &sat );
+
+
+    /**
+     * @brief hash of all inputs of visibility windows and avoidance index
+     * @author Matthias Schartner
+     *
+     * @param network station network
+     * @return cache key
+     */
+    static PrecalcCache::Key cacheKey( const Network &network );
+
+
+    /**
+     * @brief write visibility windows and avoidance index to cache
+     * @author Matthias Schartner
+     *
+     * @param writer cache writer
+     */
+    static void save( PrecalcCache::Writer &writer );
+
+
+    /**
+     * @brief read visibility windows and avoidance index from cache
+     * @author Matthias Schartner
+     *
+     * @param reader cache reader
+     * @return true if successful
+     */
+    static bool load( PrecalcCache::Reader &reader );
+
+
+    /**
+     * @brief calculate avoidance index entries of one satellite at one station
+     * @author Matthias Schartner
+     *
+     * @param sta station
+     * @param satIdx index of satellite in satellitesToAvoid
+     * @param windows visibility windows of this satellite
+     * @return bucket index and candidate
+     */
+    static std::vector<std::pair<unsigned long, Candidate>> calcCandidates( const Station &sta, unsigned long satIdx,
+                                                                            const std::vector<Window> &windows );
 };
 }  // namespace VieVS
 
@@ -24,7 +24,7 @@
 using namespace std;
 using namespace VieVS;
 
-unsigned long CalibratorBlock::nextId = 0;
+std::atomic<unsigned long> CalibratorBlock::nextId{ 0 };
 string CalibratorBlock::intent_;
 bool CalibratorBlock::tryToIncludeAllStationFlag = false;
 bool CalibratorBlock::subnetting = false;
@@ -39,9 +39,6 @@ double CalibratorBlock::duration_offset = 1.0;
 double CalibratorBlock::averageBaseline_factor = 0.0;
 double CalibratorBlock::averageBaseline_offset = 1.0;
 
-
-std::vector<char> thread_local CalibratorBlock::stationFlag = std::vector<char>();
-
 CalibratorBlock::CalibratorBlock( unsigned int startTime, unsigned int nScans, unsigned int duration,
                                   std::string allowedSourceGroup )
     : VieVS_Object( nextId++ ),
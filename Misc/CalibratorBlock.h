@@ -72,10 +72,8 @@ class CalibratorBlock : public VieVS_Object {
     static double averageBaseline_factor;
     static double averageBaseline_offset;
 
-    static thread_local std::vector<char> stationFlag;
-
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
     unsigned int startTime;
     unsigned int nScans;
     unsigned int duration;
@@ -29,7 +29,6 @@ class DifferentialParallacticAngleBlock : public VieVS_Object {
     static unsigned int duration;
     static int nscans;
     static std::vector<double> angles;
-    static thread_local int iScan;
 
     static bool isAllowedSource( unsigned long srcid ) {
         return find( allowedSources.begin(), allowedSources.end(), srcid ) != allowedSources.end();
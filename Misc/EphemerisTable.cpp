@@ -0,0 +1,29 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EphemerisTable.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+EphemerisTable::EphemerisTable( unsigned int step, std::vector<std::vector<double>> columns )
+    : step_{ step }, columns_{ move( columns ) } {
+    nEpochs_ = columns_.empty() ? 0 : static_cast<unsigned int>( columns_.front().size() );
+}
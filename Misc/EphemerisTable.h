@@ -0,0 +1,136 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file EphemerisTable.h
+ * @brief class EphemerisTable
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+
+#ifndef EPHEMERISTABLE_H
+#define EPHEMERISTABLE_H
+
+
+#include <vector>
+
+
+namespace VieVS {
+
+/**
+ * @class EphemerisTable
+ * @brief time series of one or more quantities on a uniform time grid starting at session start
+ *
+ * The interpolation interval is calculated directly from the requested time. The grid spacing is chosen by the
+ * creator of the table (a finer grid results in a more accurate linear interpolation).
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+class EphemerisTable {
+   public:
+    /**
+     * @brief empty default constructor
+     * @author Matthias Schartner
+     */
+    EphemerisTable() = default;
+
+
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     *
+     * @param step grid spacing in seconds
+     * @param columns values of each quantity at grid epochs (all columns must have the same size)
+     */
+    EphemerisTable( unsigned int step, std::vector<std::vector<double>> columns );
+
+
+    /**
+     * @brief check if table is empty
+     * @author Matthias Schartner
+     *
+     * @return true if table has less than two epochs
+     */
+    bool empty() const noexcept { return nEpochs_ < 2; }
+
+
+    /**
+     * @brief getter for grid spacing
+     * @author Matthias Schartner
+     *
+     * @return grid spacing in seconds
+     */
+    unsigned int getStep() const noexcept { return step_; }
+
+
+    /**
+     * @brief index of interpolation interval
+     * @author Matthias Schartner
+     *
+     * A time exactly on a grid epoch (except the first) is assigned to the interval ending at this epoch.
+     *
+     * @param time time in seconds since session start
+     * @return index of first grid epoch of interpolation interval
+     */
+    unsigned int index( unsigned int time ) const noexcept {
+        unsigned int idx = time == 0 ? 0 : ( time - 1 ) / step_;
+        if ( idx + 2 > nEpochs_ ) {
+            idx = nEpochs_ - 2;
+        }
+        return idx;
+    }
+
+
+    /**
+     * @brief linear interpolation of one quantity
+     * @author Matthias Schartner
+     *
+     * @param time time in seconds since session start
+     * @param idx index of interpolation interval (see index())
+     * @param column index of quantity
+     * @return interpolated value
+     */
+    double interpolate( unsigned int time, unsigned int idx, unsigned int column ) const noexcept {
+        const std::vector<double> &v = columns_[column];
+        unsigned int deltaTime = time - idx * step_;
+        return v[idx] + ( v[idx + 1] - v[idx] ) / step_ * deltaTime;
+    }
+
+
+    /**
+     * @brief linear interpolation of one quantity
+     * @author Matthias Schartner
+     *
+     * @param time time in seconds since session start
+     * @param column index of quantity
+     * @return interpolated value
+     */
+    double interpolate( unsigned int time, unsigned int column ) const noexcept {
+        return interpolate( time, index( time ), column );
+    }
+
+   private:
+    unsigned int step_ = 1;                      ///< grid spacing in seconds
+    unsigned int nEpochs_ = 0;                   ///< number of grid epochs
+    std::vector<std::vector<double>> columns_;  ///< values of each quantity at grid epochs
+};
+}  // namespace VieVS
+
+#endif  // EPHEMERISTABLE_H
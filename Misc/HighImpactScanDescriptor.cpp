@@ -24,8 +24,8 @@
 using namespace std;
 using namespace VieVS;
 
-unsigned long HighImpactScanDescriptor::nextId = 0;
-unsigned long HighImpactScanDescriptor::AzElDescriptor::nextId = 0;
+std::atomic<unsigned long> HighImpactScanDescriptor::nextId{ 0 };
+std::atomic<unsigned long> HighImpactScanDescriptor::AzElDescriptor::nextId{ 0 };
 
 
 HighImpactScanDescriptor::AzElDescriptor::AzElDescriptor( double az, double el, double margin,
@@ -139,7 +139,8 @@ const vector<unsigned long> &HighImpactScanDescriptor::AzElDescriptor::getStaids
 
 void HighImpactScanDescriptor::updateHighImpactScans( const Network &network, const SourceList &sourceList,
                                                       const std::shared_ptr<const Mode> &mode,
-                                                      const std::shared_ptr<Subnetting> &subnetting ) {
+                                                      const std::shared_ptr<Subnetting> &subnetting,
+                                                      const SchedulingContext &context ) {
     highImpactScans_.calcStartTimes( network, sourceList );
     highImpactScans_.updateAzEl( network, sourceList );
     highImpactScans_.constructAllBaselines( network, sourceList );
@@ -151,13 +152,14 @@ void HighImpactScanDescriptor::updateHighImpactScans( const Network &network, co
         highImpactScans_.createSubnettingScans( subnetting, network, sourceList );
     }
 
-    highImpactScans_.generateScore( network, sourceList, scores_, interval_ );
+    highImpactScans_.generateScore( network, sourceList, scores_, interval_, context );
 }
 
 
 vector<Scan> HighImpactScanDescriptor::highestImpactScans( Network &network, const SourceList &sourceList,
-                                                           const std::shared_ptr<const Mode> &mode ) {
-    return highImpactScans_.selectBest( network, sourceList, mode );
+                                                           const std::shared_ptr<const Mode> &mode,
+                                                           const SchedulingContext &context ) {
+    return highImpactScans_.selectBest( network, sourceList, mode, context );
 }
 
 
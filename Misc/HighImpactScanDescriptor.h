@@ -136,10 +136,11 @@ class HighImpactScanDescriptor : public VieVS_Object {
      * @param sourceList source list
      * @param mode observing mode
      * @param subnetting subnetting information
+     * @param context scheduling context
      */
     void updateHighImpactScans( const Network &network, const SourceList &sourceList,
                                 const std::shared_ptr<const Mode> &mode,
-                                const std::shared_ptr<Subnetting> &subnetting );
+                                const std::shared_ptr<Subnetting> &subnetting, const SchedulingContext &context );
 
 
     /**
@@ -149,10 +150,11 @@ class HighImpactScanDescriptor : public VieVS_Object {
      * @param network station network
      * @param sourceList source list
      * @param mode observing mode
+     * @param context scheduling context
      * @return list of scans with highest impact score
      */
     std::vector<Scan> highestImpactScans( Network &network, const SourceList &sourceList,
-                                          const std::shared_ptr<const Mode> &mode );
+                                          const std::shared_ptr<const Mode> &mode, const SchedulingContext &context );
 
 
     /**
@@ -201,7 +203,7 @@ class HighImpactScanDescriptor : public VieVS_Object {
     class AzElDescriptor;
 
 
-    static unsigned long nextId;                  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;     ///< next id for this object type
     unsigned int interval_;                       ///< test interval in seconds
     unsigned int minTimeBetweenScans_;            ///< minimum time between high impact scans in seconds
     std::vector<AzElDescriptor> azElDescritors_;  ///< list of azimuth elevation descriptors
@@ -245,7 +247,7 @@ class HighImpactScanDescriptor::AzElDescriptor : public VieVS_Object {
 
 
    private:
-    static unsigned long nextId;         ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
     double az_;                          ///< target azimuth in radians
     double el_;                          ///< target elevation in radians
     double margin_;                      ///< target azimuth elevation margin
@@ -25,10 +25,17 @@ using namespace std;
 std::vector<double> VieVS::LookupTable::sinLookupTable;
 std::vector<double> VieVS::LookupTable::cosLookupTable;
 std::vector<double> VieVS::LookupTable::acosLookupTable;
-vector<vector<vector<float>>> VieVS::LookupTable::angularDistanceLookup = {};
+std::vector<float, boost::alignment::aligned_allocator<float, 64>> VieVS::LookupTable::angularDistanceLookup;
+std::vector<unsigned long> VieVS::LookupTable::angularDistanceRowOffset;
+double VieVS::LookupTable::angularDistanceSteps = 1;
+unsigned long VieVS::LookupTable::angularDistanceNEl = 0;
 
 
-void LookupTable::initialize() {
+void LookupTable::initialize( unsigned int stepsPerDegree ) {
+    sinLookupTable.clear();
+    cosLookupTable.clear();
+    acosLookupTable.clear();
+
     for ( int i = 0; i < twopi * 1001; ++i ) {
         double x = i * 0.001;
         double val = sin( x );
@@ -47,29 +54,39 @@ void LookupTable::initialize() {
         acosLookupTable.push_back( val );
     }
 
-    unsigned int maxEl = 91;
-    unsigned int sizeAz = 181;
-    vector<vector<vector<float>>> storage;
-
-    for ( unsigned int thisEl = 0; thisEl < maxEl; ++thisEl ) {
-        unsigned int sizeEl = maxEl - thisEl;
-        double thisEl_rad = thisEl * deg2rad;
+    // flat table: for each start elevation thisEl all azimuth differences deltaAz (0 to 180 degrees) with all
+    // elevation differences deltaEl (0 to 90 degrees - thisEl, plus one guard entry for rounding at the zenith)
+    angularDistanceSteps = stepsPerDegree;
+    unsigned long maxEl = 90 * stepsPerDegree + 1;
+    unsigned long sizeAz = 180 * stepsPerDegree + 1;
+    angularDistanceNEl = maxEl;
+
+    angularDistanceRowOffset.resize( maxEl + 1 );
+    angularDistanceRowOffset[0] = 0;
+    for ( unsigned long thisEl = 0; thisEl < maxEl; ++thisEl ) {
+        angularDistanceRowOffset[thisEl + 1] = angularDistanceRowOffset[thisEl] + sizeAz * ( maxEl + 1 - thisEl );
+    }
+    angularDistanceLookup.assign( angularDistanceRowOffset.back(), 0 );
 
-        vector<vector<float>> thisStorage( sizeAz, vector<float>( sizeEl, 0 ) );
+    // exact trigonometric functions, the .001 tables would limit the accuracy independent of the resolution
+    for ( unsigned long thisEl = 0; thisEl < maxEl; ++thisEl ) {
+        unsigned long sizeEl = maxEl + 1 - thisEl;
+        double thisEl_rad = thisEl / angularDistanceSteps * deg2rad;
+        double sinEl = sin( thisEl_rad );
+        double cosEl = cos( thisEl_rad );
 
-        for ( int deltaAz = 0; deltaAz < sizeAz; ++deltaAz ) {
-            double deltaAz_rad = deltaAz * deg2rad;
-            for ( int deltaEl = 0; deltaEl < sizeEl; ++deltaEl ) {
-                double deltaEl_rad = deltaEl * deg2rad;
+        for ( unsigned long deltaAz = 0; deltaAz < sizeAz; ++deltaAz ) {
+            double cosDeltaAz = cos( deltaAz / angularDistanceSteps * deg2rad );
+            float *row = &angularDistanceLookup[angularDistanceRowOffset[thisEl] + deltaAz * sizeEl];
+            for ( unsigned long deltaEl = 0; deltaEl < sizeEl; ++deltaEl ) {
+                double el2_rad = thisEl_rad + deltaEl / angularDistanceSteps * deg2rad;
 
-                double tmp = sinLookup( thisEl_rad ) * sinLookup( thisEl_rad + deltaEl_rad ) +
-                             cosLookup( thisEl_rad ) * cosLookup( thisEl_rad + deltaEl_rad ) * cosLookup( deltaAz_rad );
-                double angle = acosLookup( tmp );
+                double tmp = sinEl * sin( el2_rad ) + cosEl * cos( el2_rad ) * cosDeltaAz;
+                double angle = acos( max( -1.0, min( 1.0, tmp ) ) );
 
-                thisStorage[deltaAz][deltaEl] = static_cast<float>( angle );
+                row[deltaEl] = static_cast<float>( angle );
             }
         }
-        angularDistanceLookup.push_back( move( thisStorage ) );
     }
 }
 
@@ -79,32 +96,31 @@ float LookupTable::angularDistance( const PointingVector &p1, const PointingVect
 }
 
 
-double LookupTable::sinLookup( double x ) { return sinLookupTable[lround( x * 1000 )]; }
-
-
-double LookupTable::cosLookup( double x ) { return cosLookupTable[lround( x * 1000 )]; }
-
-
-double LookupTable::acosLookup( double x ) { return acosLookupTable.at( lround( x * 1000 ) + 1000 ); }
+void LookupTable::angularDistance( double phi, double theta, unsigned long n, const double *phis,
+                                   const double *thetas, float *distances ) noexcept {
+    // indices first (arithmetic only), afterwards the table lookups
+    constexpr unsigned long chunk = 64;
+    unsigned long idx[chunk];
+    for ( unsigned long start = 0; start < n; start += chunk ) {
+        unsigned long m = min( chunk, n - start );
+        for ( unsigned long i = 0; i < m; ++i ) {
+            idx[i] = distanceIndex( phi, theta, phis[start + i], thetas[start + i] );
+        }
+        for ( unsigned long i = 0; i < m; ++i ) {
+            distances[start + i] = angularDistanceLookup[idx[i]];
+        }
+    }
+}
 
 
-float LookupTable::angularDistance( double phi1, double theta1, double phi2, double theta2 ) noexcept {
-    if ( phi1 > phi2 ) {
-        swap( phi1, phi2 );
-    }
-    if ( theta1 > theta2 ) {
-        swap( theta1, theta2 );
-    }
+double LookupTable::sinLookup( double x ) { return sinLookupTable[lround( x * 1000 )]; }
 
-    double deltaPhi_tmp = ( phi2 - phi1 ) * rad2deg;
-    while ( deltaPhi_tmp > 180 ) {
-        deltaPhi_tmp = deltaPhi_tmp - 360;
-    }
 
-    long deltaPhi = abs( lround( deltaPhi_tmp ) );
+double LookupTable::cosLookup( double x ) { return cosLookupTable[lround( x * 1000 )]; }
 
-    auto thisTheta = lround( theta1 * rad2deg );
-    auto deltaTheta = lround( ( theta2 - theta1 ) * rad2deg );
 
-    return angularDistanceLookup[thisTheta][deltaPhi][deltaTheta];
+double LookupTable::acosLookup( double x ) {
+    long idx = lround( x * 1000 ) + 1000;
+    idx = max( 0l, min( idx, static_cast<long>( acosLookupTable.size() ) - 1 ) );
+    return acosLookupTable[idx];
 }
@@ -28,6 +28,8 @@
 #define LOOKUPTABLE_H
 
 
+#include <boost/align/aligned_allocator.hpp>
+#include <cmath>
 #include <unordered_map>
 #include <vector>
 
@@ -43,13 +45,24 @@ namespace VieVS {
  * the key is always an integer that counts in .001 intervals (using th sinLookup with a key of 327 would mean you
  * get sin(0.327) as a return value)
  *
+ * The angular distance table is one contiguous, cache line aligned array. Its resolution is configurable via
+ * initialize(). Both coordinates are rounded to the grid before the lookup, the table itself is built with the exact
+ * formula. Compared to the exact formula, the error is therefore only caused by the rounding: about 0.33 degrees on
+ * average and at most 1.5 degrees at the default resolution of 1 degree, halved with each halving of the step size.
+ * Finer grids increase the memory footprint cubically (about 3 MB for 1 degree, 24 MB for 0.5 degree) and therefore
+ * the number of cache misses.
+ *
  * @author Matthias Schartner
  * @date 02.08.2017
  */
 class LookupTable {
    private:
-    static std::vector<std::vector<std::vector<float>>>
-        angularDistanceLookup;  ///< lookup table for angular distance between two points
+    static std::vector<float, boost::alignment::aligned_allocator<float, 64>>
+        angularDistanceLookup;  ///< lookup table for angular distance between two points (flat, see distanceIndex)
+    static std::vector<unsigned long>
+        angularDistanceRowOffset;  ///< index of first element per start elevation in angularDistanceLookup
+    static double angularDistanceSteps;        ///< number of grid steps per degree of angular distance table
+    static unsigned long angularDistanceNEl;  ///< number of start elevations of angular distance table
     static std::vector<double>
         sinLookupTable;  ///< table for fast lookup for sine function with reduced accuracy. Key is fraction of .001 pi
     static std::vector<double>
@@ -61,8 +74,10 @@ class LookupTable {
     /**
      * @brief initialize lookup tables
      * @author Matthias Schartner
+     *
+     * @param stepsPerDegree resolution of angular distance table (number of grid steps per degree)
      */
-    static void initialize();
+    static void initialize( unsigned int stepsPerDegree = 1 );
 
 
     /**
@@ -116,7 +131,58 @@ class LookupTable {
      * @param theta2 end thatet in radians
      * @return angular distance between two points in radians
      */
-    static float angularDistance( double phi1, double theta1, double phi2, double theta2 ) noexcept;
+    static float angularDistance( double phi1, double theta1, double phi2, double theta2 ) noexcept {
+        return angularDistanceLookup[distanceIndex( phi1, theta1, phi2, theta2 )];
+    }
+
+
+    /**
+     * @brief angular distance between one point and many other points
+     * @author Matthias Schartner
+     *
+     * The result is identical to calling angularDistance for each point. Index calculation is done in one flat loop
+     * followed by the table lookups.
+     *
+     * @param phi start phi in radians
+     * @param theta start theta in radians
+     * @param n number of other points
+     * @param phis phi of other points in radians
+     * @param thetas theta of other points in radians
+     * @param distances angular distance to each other point in radians (output)
+     */
+    static void angularDistance( double phi, double theta, unsigned long n, const double *phis, const double *thetas,
+                                 float *distances ) noexcept;
+
+   private:
+    /**
+     * @brief index in angular distance table
+     * @author Matthias Schartner
+     *
+     * @param phi1 start phi in radians
+     * @param theta1 start theta in radians
+     * @param phi2 end phi in radians
+     * @param theta2 end thatet in radians
+     * @return index in angularDistanceLookup
+     */
+    static unsigned long distanceIndex( double phi1, double theta1, double phi2, double theta2 ) noexcept {
+        if ( phi1 > phi2 ) {
+            std::swap( phi1, phi2 );
+        }
+        if ( theta1 > theta2 ) {
+            std::swap( theta1, theta2 );
+        }
+
+        double deltaPhi_tmp = ( phi2 - phi1 ) * rad2deg;
+        while ( deltaPhi_tmp > 180 ) {
+            deltaPhi_tmp = deltaPhi_tmp - 360;
+        }
+
+        long deltaPhi = std::abs( std::lround( deltaPhi_tmp * angularDistanceSteps ) );
+        long thisTheta = std::lround( theta1 * rad2deg * angularDistanceSteps );
+        long deltaTheta = std::lround( ( theta2 - theta1 ) * rad2deg * angularDistanceSteps );
+
+        return angularDistanceRowOffset[thisTheta] + deltaPhi * ( angularDistanceNEl + 1 - thisTheta ) + deltaTheta;
+    }
 };
 }  // namespace VieVS
 
@@ -22,10 +22,11 @@
 using namespace std;
 using namespace VieVS;
 
-unsigned long MultiScheduling::nextId = 0;
+std::atomic<unsigned long> MultiScheduling::nextId{ 0 };
 bool MultiScheduling::pick_random = false;
 unsigned long MultiScheduling::nsta_ = 0;
 unsigned long MultiScheduling::nsrc_ = 0;
+WeightFactors MultiScheduling::weightFactors_;
 
 std::default_random_engine MultiScheduling::random_engine_ = std::default_random_engine();
 
@@ -88,7 +89,7 @@ std::vector<MultiScheduling::Parameters> MultiScheduling::createMultiSchedulePar
     }
 
     for ( auto &para : allPARA ) {
-        para.normalizeWeightFactors();
+        para.normalizeWeightFactors( weightFactors_ );
         para.normalizeWeights( nsta_, nsrc_ );
     }
     return allPARA;
@@ -110,16 +111,16 @@ std::vector<MultiScheduling::Parameters> MultiScheduling::createMultiSchedulePar
 
     // create map with all weight factors
     map<string, vector<double>> weightFactors = {
-        { "weight_factor_sky-coverage", vector<double>{ WeightFactors::weightSkyCoverage } },
-        { "weight_factor_number_of_observations", vector<double>{ WeightFactors::weightNumberOfObservations } },
-        { "weight_factor_duration", vector<double>{ WeightFactors::weightDuration } },
-        { "weight_factor_average_sources", vector<double>{ WeightFactors::weightAverageSources } },
-        { "weight_factor_average_stations", vector<double>{ WeightFactors::weightAverageStations } },
-        { "weight_factor_average_baselines", vector<double>{ WeightFactors::weightAverageBaselines } },
-        { "weight_factor_idle_time", vector<double>{ WeightFactors::weightIdleTime } },
-        { "weight_factor_closures", vector<double>{ WeightFactors::weightClosures } },
-        { "weight_factor_low_declination", vector<double>{ WeightFactors::weightDeclination } },
-        { "weight_factor_low_elevation", vector<double>{ WeightFactors::weightLowElevation } } };
+        { "weight_factor_sky-coverage", vector<double>{ weightFactors_.weightSkyCoverage } },
+        { "weight_factor_number_of_observations", vector<double>{ weightFactors_.weightNumberOfObservations } },
+        { "weight_factor_duration", vector<double>{ weightFactors_.weightDuration } },
+        { "weight_factor_average_sources", vector<double>{ weightFactors_.weightAverageSources } },
+        { "weight_factor_average_stations", vector<double>{ weightFactors_.weightAverageStations } },
+        { "weight_factor_average_baselines", vector<double>{ weightFactors_.weightAverageBaselines } },
+        { "weight_factor_idle_time", vector<double>{ weightFactors_.weightIdleTime } },
+        { "weight_factor_closures", vector<double>{ weightFactors_.weightClosures } },
+        { "weight_factor_low_declination", vector<double>{ weightFactors_.weightDeclination } },
+        { "weight_factor_low_elevation", vector<double>{ weightFactors_.weightLowElevation } } };
 
     // check if a weight factor is changed during multi scheduling
     bool weigthFactorFound = false;
@@ -1013,7 +1014,7 @@ vector<MultiScheduling::Parameters> MultiScheduling::evolution_step( int gen,
     }
 
     for ( auto &any : new_pop ) {
-        any.normalizeWeightFactors();
+        any.normalizeWeightFactors( weightFactors_ );
         any.normalizeWeights( nsta_, nsrc_ );
     }
 
@@ -1219,67 +1220,67 @@ MultiScheduling::Parameters::Parameters( const std::vector<Parameters> &v, doubl
     baselineMinScan = f_map_uint( collect<map<string, unsigned int>>( &Parameters::baselineMinScan, v ) );
 }
 
-void MultiScheduling::Parameters::normalizeWeightFactors() {
+void MultiScheduling::Parameters::normalizeWeightFactors( const WeightFactors &weightFactors ) {
     double sum = 0;
 
     if ( weightSkyCoverage.is_initialized() ) {
         sum += *weightSkyCoverage;
     } else {
-        sum += WeightFactors::weightSkyCoverage;
+        sum += weightFactors.weightSkyCoverage;
     }
 
     if ( weightNumberOfObservations.is_initialized() ) {
         sum += *weightNumberOfObservations;
     } else {
-        sum += WeightFactors::weightNumberOfObservations;
+        sum += weightFactors.weightNumberOfObservations;
     }
 
     if ( weightDuration.is_initialized() ) {
         sum += *weightDuration;
     } else {
-        sum += WeightFactors::weightDuration;
+        sum += weightFactors.weightDuration;
     }
 
     if ( weightAverageSources.is_initialized() ) {
         sum += *weightAverageSources;
     } else {
-        sum += WeightFactors::weightAverageSources;
+        sum += weightFactors.weightAverageSources;
     }
 
     if ( weightAverageStations.is_initialized() ) {
         sum += *weightAverageStations;
     } else {
-        sum += WeightFactors::weightAverageStations;
+        sum += weightFactors.weightAverageStations;
     }
 
     if ( weightAverageBaselines.is_initialized() ) {
         sum += *weightAverageBaselines;
     } else {
-        sum += WeightFactors::weightAverageBaselines;
+        sum += weightFactors.weightAverageBaselines;
     }
 
     if ( weightIdleTime.is_initialized() ) {
         sum += *weightIdleTime;
     } else {
-        sum += WeightFactors::weightIdleTime;
+        sum += weightFactors.weightIdleTime;
     }
 
     if ( weightClosures.is_initialized() ) {
         sum += *weightClosures;
     } else {
-        sum += WeightFactors::weightClosures;
+        sum += weightFactors.weightClosures;
     }
 
     if ( weightLowDeclination.is_initialized() ) {
         sum += *weightLowDeclination;
     } else {
-        sum += WeightFactors::weightDeclination;
+        sum += weightFactors.weightDeclination;
     }
 
     if ( weightLowElevation.is_initialized() ) {
         sum += *weightLowElevation;
     } else {
-        sum += WeightFactors::weightLowElevation;
+        sum += weightFactors.weightLowElevation;
     }
 
     if ( sum > 0 && weightSkyCoverage.is_initialized() ) {
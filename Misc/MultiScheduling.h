@@ -144,8 +144,10 @@ class MultiScheduling : public VieVS_Object {
         /**
          * @brief normalize weight factors
          * @author Matthias Schartner
+         *
+         * @param weightFactors weight factors used for all parameters that are not changed
          */
-        void normalizeWeightFactors();
+        void normalizeWeightFactors( const WeightFactors &weightFactors );
 
 
         /**
@@ -669,10 +671,12 @@ class MultiScheduling : public VieVS_Object {
      *
      * @param nsta number of stations
      * @param nsrc number of sources
+     * @param weightFactors weight factors of the reference schedule
      */
-    static void setConstants( unsigned long nsta, unsigned long nsrc ) {
+    static void setConstants( unsigned long nsta, unsigned long nsrc, const WeightFactors &weightFactors ) {
         MultiScheduling::nsta_ = nsta;
         MultiScheduling::nsrc_ = nsrc;
+        MultiScheduling::weightFactors_ = weightFactors;
     }
 
     /**
@@ -765,11 +769,12 @@ class MultiScheduling : public VieVS_Object {
 
 
    private:
-    static unsigned long nextId;                       ///< next id
+    static std::atomic<unsigned long> nextId;          ///< next id
     static std::default_random_engine random_engine_;  ///< random number generator engine
     static bool pick_random;
     static unsigned long nsta_;
     static unsigned long nsrc_;
+    static WeightFactors weightFactors_;  ///< weight factors of the reference schedule
 
     std::unordered_map<std::string, std::vector<std::string>> stationGroups_;   ///< used station groups
     std::unordered_map<std::string, std::vector<std::string>> sourceGroups_;    ///< used source groups
@@ -0,0 +1,186 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecalcCache.h"
+
+#include <boost/format.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#ifdef VIESCHEDPP_LOG
+#include <boost/log/trivial.hpp>
+#endif
+
+
+using namespace std;
+using namespace VieVS;
+
+std::string PrecalcCache::directory{};
+bool PrecalcCache::bypass = false;
+
+constexpr uint32_t PrecalcCache::magic_;
+constexpr uint32_t PrecalcCache::version_;
+
+
+bool PrecalcCache::load( const std::string &name, const Key &key, const std::function<bool( Reader & )> &reader ) {
+    if ( !enabled() || bypass ) {
+        return false;
+    }
+    string file = fileName( name, key );
+    if ( !readFile( file, key, reader ) ) {
+        return false;
+    }
+
+#ifdef VIESCHEDPP_LOG
+    BOOST_LOG_TRIVIAL( info ) << "read " << name << " from cache " << file;
+#else
+    cout << "[info] read " << name << " from cache " << file << "\n";
+#endif
+    return true;
+}
+
+
+void PrecalcCache::store( const std::string &name, const Key &key, const Writer &writer ) {
+    if ( !enabled() ) {
+        return;
+    }
+    string file = fileName( name, key );
+    if ( !writeFile( file, key, writer ) ) {
+        return;
+    }
+
+#ifdef VIESCHEDPP_LOG
+    BOOST_LOG_TRIVIAL( info ) << "write " << name << " to cache " << file;
+#else
+    cout << "[info] write " << name << " to cache " << file << "\n";
+#endif
+}
+
+
+bool PrecalcCache::readFile( const std::string &file, const Key &key,
+                             const std::function<bool( Reader & )> &reader ) {
+    {
+        ifstream test( file );
+        if ( !test.good() ) {
+            return false;
+        }
+    }
+
+    try {
+        boost::interprocess::file_mapping mapping( file.c_str(), boost::interprocess::read_only );
+        boost::interprocess::mapped_region region( mapping, boost::interprocess::read_only );
+        const auto *data = static_cast<const char *>( region.get_address() );
+        uint64_t size = region.get_size();
+
+        Header header{};
+        if ( size < sizeof( Header ) ) {
+            throw runtime_error( "file too small" );
+        }
+        memcpy( &header, data, sizeof( Header ) );
+        if ( header.magic != magic_ || header.version != version_ || header.key != key.value() ||
+             header.size != size - sizeof( Header ) ) {
+            throw runtime_error( "invalid header" );
+        }
+        const char *payload = data + sizeof( Header );
+        if ( header.checksum != checksum( payload, header.size ) ) {
+            throw runtime_error( "invalid checksum" );
+        }
+
+        Reader r( payload, header.size );
+        if ( !reader( r ) || !r.atEnd() ) {
+            throw runtime_error( "invalid payload" );
+        }
+    } catch ( const exception &e ) {
+#ifdef VIESCHEDPP_LOG
+        BOOST_LOG_TRIVIAL( warning ) << "ignoring " << file << " (" << e.what() << ")";
+#else
+        cout << "[warning] ignoring " << file << " (" << e.what() << ")\n";
+#endif
+        return false;
+    }
+    return true;
+}
+
+
+bool PrecalcCache::writeFile( const std::string &file, const Key &key, const Writer &writer ) {
+    const vector<char> &buffer = writer.getBuffer();
+
+    Header header{};
+    header.magic = magic_;
+    header.version = version_;
+    header.key = key.value();
+    header.size = buffer.size();
+    header.checksum = checksum( buffer.data(), buffer.size() );
+
+    // write to unique temporary file and rename afterwards
+    auto unique = static_cast<unsigned long long>( chrono::steady_clock::now().time_since_epoch().count() ) ^
+                  static_cast<unsigned long long>( hash<thread::id>()( this_thread::get_id() ) );
+    string tmp = ( boost::format( "%s.%016x.tmp" ) % file % unique ).str();
+
+    bool success;
+    {
+        ofstream of( tmp, ios::binary );
+        of.write( reinterpret_cast<const char *>( &header ), sizeof( Header ) );
+        of.write( buffer.data(), static_cast<streamsize>( buffer.size() ) );
+        of.close();
+        success = !of.fail();
+    }
+    if ( success ) {
+        success = rename( tmp.c_str(), file.c_str() ) == 0;
+    }
+    if ( !success ) {
+        remove( tmp.c_str() );
+#ifdef VIESCHEDPP_LOG
+        BOOST_LOG_TRIVIAL( warning ) << "could not write " << file;
+#else
+        cout << "[warning] could not write " << file << "\n";
+#endif
+    }
+    return success;
+}
+
+
+std::string PrecalcCache::fileName( const std::string &name, const Key &key ) {
+    string dir = directory;
+    if ( !dir.empty() && dir.back() != '/' && dir.back() != '\\' ) {
+        dir.push_back( '/' );
+    }
+    return ( boost::format( "%s%s_%016x.bin" ) % dir % name % key.value() ).str();
+}
+
+
+uint64_t PrecalcCache::checksum( const char *data, uint64_t size ) noexcept {
+    // FNV-1a on 64 bit words (remaining bytes individually)
+    uint64_t hash = 14695981039346656037ull;
+    uint64_t i = 0;
+    for ( ; i + 8 <= size; i += 8 ) {
+        uint64_t word;
+        memcpy( &word, data + i, 8 );
+        hash ^= word;
+        hash *= 1099511628211ull;
+    }
+    for ( ; i < size; ++i ) {
+        hash ^= static_cast<unsigned char>( data[i] );
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
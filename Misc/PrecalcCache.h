@@ -0,0 +1,400 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file PrecalcCache.h
+ * @brief class PrecalcCache
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+
+#ifndef PRECALCCACHE_H
+#define PRECALCCACHE_H
+
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+namespace VieVS {
+
+/**
+ * @class PrecalcCache
+ * @brief optional on-disk cache of precalculated values
+ *
+ * Each entry is a binary file in the cache directory named after the entry and a 64 bit hash of all inputs the
+ * precalculated values depend on (see Key). A changed input therefore leads to a different file name and the values
+ * are recalculated. Files start with a header (magic number, format version, key, payload size and checksum) which
+ * is checked before the payload is used. Files are written to a temporary file first and renamed afterwards, so
+ * concurrent runs never see partially written entries.
+ *
+ * Files are read via memory mapping. The payload consists of plain arrays which are copied into the final data
+ * structures.
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+class PrecalcCache {
+   public:
+    static std::string directory;  ///< cache directory (empty if cache is disabled)
+    static bool bypass;            ///< do not read cached values (recalculated values are still written)
+
+
+    /**
+     * @class Key
+     * @brief hash of all inputs of a cache entry (64 bit FNV-1a on 64 bit words)
+     *
+     * @author Matthias Schartner
+     * @date 16.10.2026
+     */
+    class Key {
+       public:
+        /**
+         * @brief add string
+         * @author Matthias Schartner
+         *
+         * @param str string
+         * @return this key
+         */
+        Key &add( const std::string &str ) noexcept {
+            add( static_cast<uint64_t>( str.size() ) );
+            addBytes( str.data(), str.size() );
+            return *this;
+        }
+
+
+        /**
+         * @brief add arithmetic value
+         * @author Matthias Schartner
+         *
+         * @param value value
+         * @return this key
+         */
+        template <typename T>
+        Key &add( T value ) noexcept {
+            static_assert( std::is_arithmetic<T>::value, "only arithmetic values can be added" );
+            addBytes( &value, sizeof( T ) );
+            return *this;
+        }
+
+
+        /**
+         * @brief add raw bytes
+         * @author Matthias Schartner
+         *
+         * @param data pointer to data
+         * @param n number of bytes
+         * @return this key
+         */
+        Key &addBytes( const void *data, unsigned long n ) noexcept {
+            // 64 bit words, remaining bytes individually
+            const auto *bytes = static_cast<const unsigned char *>( data );
+            unsigned long i = 0;
+            for ( ; i + 8 <= n; i += 8 ) {
+                uint64_t word;
+                std::memcpy( &word, bytes + i, 8 );
+                hash_ ^= word;
+                hash_ *= 1099511628211ull;
+            }
+            for ( ; i < n; ++i ) {
+                hash_ ^= bytes[i];
+                hash_ *= 1099511628211ull;
+            }
+            return *this;
+        }
+
+
+        /**
+         * @brief getter for hash value
+         * @author Matthias Schartner
+         *
+         * @return hash value
+         */
+        uint64_t value() const noexcept { return hash_; }
+
+       private:
+        uint64_t hash_ = 14695981039346656037ull;  ///< current hash value
+    };
+
+
+    /**
+     * @class Writer
+     * @brief serializes plain values and arrays into a buffer
+     *
+     * @author Matthias Schartner
+     * @date 16.10.2026
+     */
+    class Writer {
+       public:
+        /**
+         * @brief write plain value
+         * @author Matthias Schartner
+         *
+         * @param value value
+         */
+        template <typename T>
+        void write( const T &value ) {
+            static_assert( std::is_trivially_copyable<T>::value, "only plain values can be written" );
+            const auto *bytes = reinterpret_cast<const char *>( &value );
+            buffer_.insert( buffer_.end(), bytes, bytes + sizeof( T ) );
+        }
+
+
+        /**
+         * @brief write array of plain values (preceded by its size)
+         * @author Matthias Schartner
+         *
+         * @param values values
+         */
+        template <typename T, typename A>
+        void write( const std::vector<T, A> &values ) {
+            static_assert( std::is_trivially_copyable<T>::value, "only plain values can be written" );
+            write( static_cast<uint64_t>( values.size() ) );
+            const auto *bytes = reinterpret_cast<const char *>( values.data() );
+            buffer_.insert( buffer_.end(), bytes, bytes + values.size() * sizeof( T ) );
+        }
+
+
+        /**
+         * @brief write string (preceded by its size)
+         * @author Matthias Schartner
+         *
+         * @param str string
+         */
+        void write( const std::string &str ) {
+            write( static_cast<uint64_t>( str.size() ) );
+            buffer_.insert( buffer_.end(), str.begin(), str.end() );
+        }
+
+
+        /**
+         * @brief getter for buffer
+         * @author Matthias Schartner
+         *
+         * @return serialized data
+         */
+        const std::vector<char> &getBuffer() const noexcept { return buffer_; }
+
+       private:
+        std::vector<char> buffer_;  ///< serialized data
+    };
+
+
+    /**
+     * @class Reader
+     * @brief reads plain values and arrays from a (memory mapped) buffer
+     *
+     * All read functions return false if the buffer is exhausted.
+     *
+     * @author Matthias Schartner
+     * @date 16.10.2026
+     */
+    class Reader {
+       public:
+        /**
+         * @brief constructor
+         * @author Matthias Schartner
+         *
+         * @param data start of buffer
+         * @param size size of buffer in bytes
+         */
+        Reader( const char *data, uint64_t size ) : pos_{ data }, end_{ data + size } {}
+
+
+        /**
+         * @brief read plain value
+         * @author Matthias Schartner
+         *
+         * @param value value (output)
+         * @return true if successful
+         */
+        template <typename T>
+        bool read( T &value ) noexcept {
+            static_assert( std::is_trivially_copyable<T>::value, "only plain values can be read" );
+            if ( static_cast<uint64_t>( end_ - pos_ ) < sizeof( T ) ) {
+                return false;
+            }
+            std::memcpy( &value, pos_, sizeof( T ) );
+            pos_ += sizeof( T );
+            return true;
+        }
+
+
+        /**
+         * @brief read array of plain values
+         * @author Matthias Schartner
+         *
+         * @param values values (output)
+         * @return true if successful
+         */
+        template <typename T, typename A>
+        bool read( std::vector<T, A> &values ) {
+            static_assert( std::is_trivially_copyable<T>::value, "only plain values can be read" );
+            uint64_t n;
+            if ( !read( n ) || static_cast<uint64_t>( end_ - pos_ ) / sizeof( T ) < n ) {
+                return false;
+            }
+            values.resize( n );
+            std::memcpy( values.data(), pos_, n * sizeof( T ) );
+            pos_ += n * sizeof( T );
+            return true;
+        }
+
+
+        /**
+         * @brief read string
+         * @author Matthias Schartner
+         *
+         * @param str string (output)
+         * @return true if successful
+         */
+        bool read( std::string &str ) {
+            uint64_t n;
+            if ( !read( n ) || static_cast<uint64_t>( end_ - pos_ ) < n ) {
+                return false;
+            }
+            str.assign( pos_, n );
+            pos_ += n;
+            return true;
+        }
+
+
+        /**
+         * @brief check if whole buffer is read
+         * @author Matthias Schartner
+         *
+         * @return true if end of buffer is reached
+         */
+        bool atEnd() const noexcept { return pos_ == end_; }
+
+       private:
+        const char *pos_;  ///< current read position
+        const char *end_;  ///< end of buffer
+    };
+
+
+    /**
+     * @brief check if cache is enabled
+     * @author Matthias Schartner
+     *
+     * @return true if cache directory is defined
+     */
+    static bool enabled() noexcept { return !directory.empty(); }
+
+
+    /**
+     * @brief load cache entry
+     * @author Matthias Schartner
+     *
+     * The reader function must consume the whole payload and return true, otherwise the entry is treated as invalid.
+     *
+     * @param name entry name
+     * @param key hash of all inputs
+     * @param reader function which reads the payload
+     * @return true if entry was found and successfully read
+     */
+    static bool load( const std::string &name, const Key &key, const std::function<bool( Reader & )> &reader );
+
+
+    /**
+     * @brief store cache entry
+     * @author Matthias Schartner
+     *
+     * Errors are logged and otherwise ignored.
+     *
+     * @param name entry name
+     * @param key hash of all inputs
+     * @param writer serialized payload
+     */
+    static void store( const std::string &name, const Key &key, const Writer &writer );
+
+
+
+    /**
+     * @brief read file with header and payload
+     * @author Matthias Schartner
+     *
+     * Invalid files are logged and otherwise ignored.
+     *
+     * @param file file name
+     * @param key hash of all inputs
+     * @param reader function which reads the payload
+     * @return true if file was found and successfully read
+     */
+    static bool readFile( const std::string &file, const Key &key, const std::function<bool( Reader & )> &reader );
+
+
+    /**
+     * @brief write file with header and payload
+     * @author Matthias Schartner
+     *
+     * Errors are logged and otherwise ignored.
+     *
+     * @param file file name
+     * @param key hash of all inputs
+     * @param writer serialized payload
+     * @return true if successful
+     */
+    static bool writeFile( const std::string &file, const Key &key, const Writer &writer );
+
+   private:
+    static constexpr uint32_t magic_ = 0x43505356;  ///< magic number ("VSPC")
+    static constexpr uint32_t version_ = 1;         ///< format version (increase if any payload layout changes)
+
+    /**
+     * @brief file header
+     * @author Matthias Schartner
+     */
+    struct Header {
+        uint32_t magic;     ///< magic number
+        uint32_t version;   ///< format version
+        uint64_t key;       ///< hash of all inputs
+        uint64_t size;      ///< payload size in bytes
+        uint64_t checksum;  ///< checksum of payload
+    };
+
+
+    /**
+     * @brief file name of a cache entry
+     * @author Matthias Schartner
+     *
+     * @param name entry name
+     * @param key hash of all inputs
+     * @return file name including directory
+     */
+    static std::string fileName( const std::string &name, const Key &key );
+
+
+    /**
+     * @brief checksum of payload
+     * @author Matthias Schartner
+     *
+     * @param data start of payload
+     * @param size size of payload in bytes
+     * @return checksum
+     */
+    static uint64_t checksum( const char *data, uint64_t size ) noexcept;
+};
+}  // namespace VieVS
+
+#endif  // PRECALCCACHE_H
@@ -0,0 +1,72 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SchedulingContext.h
+ * @brief class SchedulingContext
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+
+#ifndef SCHEDULINGCONTEXT_H
+#define SCHEDULINGCONTEXT_H
+
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "WeightFactors.h"
+
+
+namespace VieVS {
+
+/**
+ * @class SchedulingContext
+ * @brief mutable state of one schedule which changes during scan selection
+ *
+ * Each Scheduler owns one context and passes it to Subcon, Scan and the scheduling algorithms. Together with the
+ * weight factors of the schedule (which differ between multi scheduling runs), it holds all state which differs
+ * between schedules. Static members of these classes only hold read only parameters which are set during
+ * initialization. Therefore, several schedules can be calculated concurrently in one process.
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+struct SchedulingContext {
+    WeightFactors weightFactors;  ///< weight factors of this schedule
+
+    unsigned int nScanSelections = 0;     ///< number of selected main scans
+    unsigned int scanSequenceModulo = 0;  ///< modulo of scan selection in custom scan sequence
+
+    unsigned int nextAstrometricCalibratorBlock = 0;  ///< seconds/number of scans when next block should start
+    std::vector<char> calibratorStationFlag;          ///< flag per station if it was observed in calibrator block
+    int iDifferentialParallacticAngleScan = 0;        ///< index of current differential parallactic angle scan
+
+    unsigned int focusCornerInterval = 900;                                        ///< time interval between algorithm
+    bool focusCornerStart = false;                                                 ///< focus observation at corner
+    int focusCornerScan = 0;                                                       ///< index of focus corner scans
+    unsigned int focusCornerNextStart = std::numeric_limits<unsigned int>::max();  ///< next algorithm start
+    std::vector<double> focusCornerLastAzimuth;                                    ///< last observed corner azimuth
+    std::vector<std::pair<int, double>> focusCornerBackupWeight;                   ///< backup source weights
+    std::vector<int> focusCornerStaid2groupid;                                     ///< station id to corner group id
+};
+}  // namespace VieVS
+
+#endif  // SCHEDULINGCONTEXT_H
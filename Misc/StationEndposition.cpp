@@ -22,7 +22,7 @@
 using namespace std;
 using namespace VieVS;
 
-unsigned long StationEndposition::nextId = 0;
+std::atomic<unsigned long> StationEndposition::nextId{ 0 };
 
 
 StationEndposition::StationEndposition( unsigned long nsta ) : VieVS_Object( nextId++ ) {
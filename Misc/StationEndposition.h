@@ -218,7 +218,7 @@ class StationEndposition : public VieVS_Object {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     std::vector<char> stationAvailable_;                          ///< saves available state of station
     std::vector<char> stationPossible_;                           ///< true if it is possible to use this station
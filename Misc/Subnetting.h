@@ -28,9 +28,12 @@
 #define SUBNETTING_H
 
 
+#include <memory>
 #include <utility>
 #include <vector>
 
+#include "SubnettingPairs.h"
+
 
 namespace VieVS {
 /**
@@ -48,7 +51,7 @@ class Subnetting {
      *
      * @param subnettingSrcIds list of possible subnetting source ids
      */
-    explicit Subnetting( std::vector<std::vector<unsigned long>> subnettingSrcIds )
+    explicit Subnetting( std::shared_ptr<const SubnettingPairs> subnettingSrcIds )
         : subnettingSrcIds{ std::move( subnettingSrcIds ) } {
 
           };
@@ -71,7 +74,7 @@ class Subnetting {
      *
      * @return list of possible subnetting source ids
      */
-    const std::vector<std::vector<unsigned long>> &getSubnettingSrcIds() const { return subnettingSrcIds; }
+    const SubnettingPairs &getSubnettingSrcIds() const { return *subnettingSrcIds; }
 
 
    private:
@@ -86,7 +89,8 @@ class Subnetting {
     virtual bool allowedMinSta( unsigned long nsta, unsigned long nsta_max ) = 0;
 
 
-    std::vector<std::vector<unsigned long>> subnettingSrcIds;  ///< list of possible subnetting source ids
+    std::shared_ptr<const SubnettingPairs>
+        subnettingSrcIds;  ///< list of possible subnetting source ids (shared between schedulers)
 };
 
 
@@ -106,7 +110,8 @@ class Subnetting_percent : public Subnetting {
      * @param subnettingSrcIds list of possible subnetting source ids
      * @param percent minimum necessary percentage of stations (e.g.: = 0.8)
      */
-    explicit Subnetting_percent( std::vector<std::vector<unsigned long>> subnettingSrcIds, double percent )
+    explicit Subnetting_percent( std::shared_ptr<const SubnettingPairs> subnettingSrcIds,
+                                 double percent )
         : Subnetting( std::move( subnettingSrcIds ) ), percent_{ percent } {}
 
 
@@ -142,7 +147,8 @@ class Subnetting_minIdle : public Subnetting {
      * @param subnettingSrcIds list of possible subnetting source ids
      * @param maxIdle maximum allowed number of idle stations
      */
-    explicit Subnetting_minIdle( std::vector<std::vector<unsigned long>> subnettingSrcIds, int maxIdle )
+    explicit Subnetting_minIdle( std::shared_ptr<const SubnettingPairs> subnettingSrcIds,
+                                 int maxIdle )
         : Subnetting( std::move( subnettingSrcIds ) ), maxIdle_{ maxIdle } {}
 
 
@@ -0,0 +1,160 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SubnettingPairs.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Constants.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+SubnettingPairs::SubnettingPairs( const std::vector<double> &ra, const std::vector<double> &de, unsigned long nsrc,
+                                  double minAngle ) {
+    unsigned long nquasars = ra.size();
+    vector<double> sinDe( nquasars );
+    vector<double> cosDe( nquasars );
+    vector<double> raNorm( nquasars );
+    for ( unsigned long i = 0; i < nquasars; ++i ) {
+        sinDe[i] = sin( de[i] );
+        cosDe[i] = cos( de[i] );
+        raNorm[i] = fmod( ra[i], twopi );
+        if ( raNorm[i] < 0 ) {
+            raNorm[i] += twopi;
+        }
+    }
+
+    // declination zones, quasars sorted by right ascension within each zone
+    auto nZones = static_cast<unsigned long>( max( 1., min( 180., floor( sqrt( nquasars ) ) ) ) );
+    double zoneHeight = pi / static_cast<double>( nZones );
+    auto zoneOf = [&]( double dec ) {
+        auto z = static_cast<long>( floor( ( dec + halfpi ) / zoneHeight ) );
+        return static_cast<unsigned long>( max( 0l, min( static_cast<long>( nZones ) - 1, z ) ) );
+    };
+    vector<vector<unsigned int>> zones( nZones );
+    for ( unsigned long i = 0; i < nquasars; ++i ) {
+        zones[zoneOf( de[i] )].push_back( static_cast<unsigned int>( i ) );
+    }
+    vector<vector<double>> zoneRa( nZones );
+    for ( unsigned long z = 0; z < nZones; ++z ) {
+        auto &zone = zones[z];
+        stable_sort( zone.begin(), zone.end(),
+                     [&]( unsigned int a, unsigned int b ) { return raNorm[a] < raNorm[b]; } );
+        for ( unsigned int id : zone ) {
+            zoneRa[z].push_back( raNorm[id] );
+        }
+    }
+
+    // all second sources are inside a cap around the antipode (radius enlarged to stay conservative)
+    double radius = pi - minAngle + 1e-9;
+    double cosMinAngle = cos( minAngle );
+    vector<vector<unsigned int>> rows( nquasars );
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic, 64 )
+#endif
+    for ( long i = 0; i < static_cast<long>( nquasars ); ++i ) {
+        vector<unsigned int> &row = rows[i];
+        if ( radius <= 0 ) {
+            continue;
+        }
+
+        double raA = fmod( raNorm[i] + pi, twopi );
+        double deA = -de[i];
+        double width = twopi;
+        if ( radius < halfpi && abs( deA ) + radius < halfpi ) {
+            width = asin( min( 1., sin( radius ) / cos( deA ) ) ) + 1e-9;
+        }
+
+        auto check = [&]( unsigned int j ) {
+            if ( j <= static_cast<unsigned long>( i ) ) {
+                return;
+            }
+            double tmp = sinDe[i] * sinDe[j] + cosDe[i] * cosDe[j] * cos( ra[i] - ra[j] );
+            // acos only close to the threshold (and outside of its domain, where the distance is undefined)
+            if ( ( tmp >= -1 && tmp < cosMinAngle - 1e-12 ) ||
+                 ( tmp <= cosMinAngle + 1e-12 && acos( tmp ) > minAngle ) ) {
+                row.push_back( j );
+            }
+        };
+        auto checkRange = [&]( unsigned long z, double ra1, double ra2 ) {
+            const auto &zra = zoneRa[z];
+            auto first = lower_bound( zra.begin(), zra.end(), ra1 );
+            auto last = upper_bound( first, zra.end(), ra2 );
+            for ( auto it = first; it != last; ++it ) {
+                check( zones[z][distance( zra.begin(), it )] );
+            }
+        };
+
+        unsigned long z1 = zoneOf( deA - radius );
+        unsigned long z2 = zoneOf( deA + radius );
+        for ( unsigned long z = z1; z <= z2; ++z ) {
+            if ( width >= pi ) {
+                for ( unsigned int j : zones[z] ) {
+                    check( j );
+                }
+            } else if ( raA - width < 0 ) {
+                checkRange( z, 0, raA + width );
+                checkRange( z, raA - width + twopi, twopi );
+            } else if ( raA + width >= twopi ) {
+                checkRange( z, raA - width, twopi );
+                checkRange( z, 0, raA + width - twopi );
+            } else {
+                checkRange( z, raA - width, raA + width );
+            }
+        }
+        sort( row.begin(), row.end() );
+    }
+
+    offset_.reserve( nsrc + 1 );
+    offset_.push_back( 0 );
+    unsigned long n = 0;
+    for ( const auto &row : rows ) {
+        n += row.size();
+    }
+    ids_.reserve( n );
+    for ( unsigned long i = 0; i < nsrc; ++i ) {
+        if ( i < nquasars ) {
+            ids_.insert( ids_.end(), rows[i].begin(), rows[i].end() );
+            vector<unsigned int>().swap( rows[i] );
+        }
+        offset_.push_back( ids_.size() );
+    }
+}
+
+
+void SubnettingPairs::save( PrecalcCache::Writer &writer ) const {
+    writer.write( offset_ );
+    writer.write( ids_ );
+}
+
+
+bool SubnettingPairs::load( PrecalcCache::Reader &reader ) {
+    vector<unsigned long> offset;
+    vector<unsigned int> ids;
+    if ( !reader.read( offset ) || !reader.read( ids ) || offset.empty() || offset.back() != ids.size() ) {
+        return false;
+    }
+    offset_ = std::move( offset );
+    ids_ = std::move( ids );
+    return true;
+}
@@ -0,0 +1,124 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SubnettingPairs.h
+ * @brief class SubnettingPairs
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+
+#ifndef SUBNETTINGPAIRS_H
+#define SUBNETTINGPAIRS_H
+
+
+#include <utility>
+#include <vector>
+
+#include "PrecalcCache.h"
+
+
+namespace VieVS {
+
+/**
+ * @class SubnettingPairs
+ * @brief list of possible subnetting source combinations
+ *
+ * For each quasar all quasars with a larger id and an angular distance larger than the minimum subnetting angle are
+ * stored (sorted by id) in a compressed row layout (one offset array and one id array).
+ *
+ * Pairs are found via a sky partition into declination zones sorted by right ascension. All quasars with an angular
+ * distance larger than the minimum angle are located within a cap around the antipode of the first quasar. Only
+ * quasars of the zones and right ascension ranges covered by this cap are checked.
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+class SubnettingPairs {
+   public:
+    /**
+     * @brief empty default constructor
+     * @author Matthias Schartner
+     */
+    SubnettingPairs() = default;
+
+
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     *
+     * @param ra right ascension of all quasars (index = source id)
+     * @param de declination of all quasars (index = source id)
+     * @param nsrc total number of sources
+     * @param minAngle minimum angular distance between both sources
+     */
+    SubnettingPairs( const std::vector<double> &ra, const std::vector<double> &de, unsigned long nsrc,
+                     double minAngle );
+
+
+    /**
+     * @brief possible second sources
+     * @author Matthias Schartner
+     *
+     * @param srcid id of first source
+     * @return begin and end of list of possible second source ids
+     */
+    std::pair<const unsigned int *, const unsigned int *> get( unsigned long srcid ) const noexcept {
+        if ( srcid + 1 >= offset_.size() ) {
+            return { nullptr, nullptr };
+        }
+        const unsigned int *data = ids_.data();
+        return { data + offset_[srcid], data + offset_[srcid + 1] };
+    }
+
+
+    /**
+     * @brief total number of source combinations
+     * @author Matthias Schartner
+     *
+     * @return number of source combinations
+     */
+    unsigned long size() const noexcept { return ids_.size(); }
+
+
+    /**
+     * @brief write to cache
+     * @author Matthias Schartner
+     *
+     * @param writer cache writer
+     */
+    void save( PrecalcCache::Writer &writer ) const;
+
+
+    /**
+     * @brief read from cache
+     * @author Matthias Schartner
+     *
+     * @param reader cache reader
+     * @return true if successful
+     */
+    bool load( PrecalcCache::Reader &reader );
+
+   private:
+    std::vector<unsigned long> offset_;  ///< index of first second source per source id (size: number of sources + 1)
+    std::vector<unsigned int> ids_;      ///< ids of second sources of all source ids
+};
+}  // namespace VieVS
+
+#endif  // SUBNETTINGPAIRS_H
@@ -18,12 +18,17 @@
 
 #include "TimeSystem.h"
 
+#include "sofa.h"
+
 
 double VieVS::TimeSystem::mjdStart = 0;
 boost::posix_time::ptime VieVS::TimeSystem::startTime = boost::posix_time::ptime();
 boost::posix_time::ptime VieVS::TimeSystem::endTime = boost::posix_time::ptime();
 unsigned int VieVS::TimeSystem::duration = 0;
 DateTime VieVS::TimeSystem::startSgp4 = DateTime( 2000, 1, 1 );
+double VieVS::TimeSystem::siderealTimeMjdStart_ = 0;
+std::vector<double> VieVS::TimeSystem::gmst82_;
+std::vector<double> VieVS::TimeSystem::gmst_;
 
 
 double VieVS::TimeSystem::mjd2gmst( double mjd ) {
@@ -51,6 +56,37 @@ double VieVS::TimeSystem::mjd2gmst( double mjd ) {
 }
 
 
+void VieVS::TimeSystem::precalcSiderealTime( unsigned int end ) {
+    double date1 = 2400000.5;
+    gmst82_.resize( end );
+    gmst_.resize( end );
+    for ( unsigned int t = 0; t < end; ++t ) {
+        double mjd = mjdStart + static_cast<double>( t ) / 86400.0;
+        gmst82_[t] = iauGmst82( date1, mjd );
+        gmst_[t] = mjd2gmst( mjd );
+    }
+    siderealTimeMjdStart_ = mjdStart;
+}
+
+
+double VieVS::TimeSystem::internalTime2gmst82( unsigned int time ) noexcept {
+    if ( time < gmst82_.size() && siderealTimeMjdStart_ == mjdStart ) {
+        return gmst82_[time];
+    }
+    double date1 = 2400000.5;
+    double date2 = mjdStart + static_cast<double>( time ) / 86400.0;
+    return iauGmst82( date1, date2 );
+}
+
+
+double VieVS::TimeSystem::internalTime2gmst( unsigned int time ) noexcept {
+    if ( time < gmst_.size() && siderealTimeMjdStart_ == mjdStart ) {
+        return gmst_[time];
+    }
+    return mjd2gmst( mjdStart + static_cast<double>( time ) / 86400.0 );
+}
+
+
 std::string VieVS::TimeSystem::time2string( const boost::posix_time::ptime &ptime ) {
     int month = ptime.date().month();
     std::string dateStr =
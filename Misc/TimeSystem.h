@@ -30,6 +30,7 @@
 
 #include <boost/date_time.hpp>
 #include <boost/format.hpp>
+#include <vector>
 
 #include "../SGP4/DateTime.h"
 #include "Constants.h"
@@ -62,6 +63,41 @@ class TimeSystem {
     static double mjd2gmst( double mjd );
 
 
+    /**
+     * @brief tabulate sidereal time for every second of the session
+     * @author Matthias Schartner
+     *
+     * Must be called after the session start is set. Later changes of the session start invalidate the tables.
+     *
+     * @param end end of tables in seconds since session start (exclusive)
+     */
+    static void precalcSiderealTime( unsigned int end );
+
+
+    /**
+     * @brief Greenwich mean sidereal time (IAU 1982 model, see iauGmst82) at internal time
+     * @author Matthias Schartner
+     *
+     * Looked up in the precalculated table if possible.
+     *
+     * @param time time in seconds since session start
+     * @return Greenwich mean sidereal time
+     */
+    static double internalTime2gmst82( unsigned int time ) noexcept;
+
+
+    /**
+     * @brief Greenwich mean sidereal time (see mjd2gmst) at internal time
+     * @author Matthias Schartner
+     *
+     * Looked up in the precalculated table if possible.
+     *
+     * @param time time in seconds since session start
+     * @return Greenwich mean sidereal time
+     */
+    static double internalTime2gmst( unsigned int time ) noexcept;
+
+
     /**
      * @brief converts datetime to string
      * @author Matthias Schartner
@@ -367,6 +403,11 @@ class TimeSystem {
         return DateTime( ptime.date().year(), ptime.date().month(), ptime.date().day(), ptime.time_of_day().hours(),
                          ptime.time_of_day().minutes(), ptime.time_of_day().seconds() );
     }
+
+   private:
+    static double siderealTimeMjdStart_;  ///< session start used for sidereal time tables
+    static std::vector<double> gmst82_;   ///< Greenwich mean sidereal time (iauGmst82) per second
+    static std::vector<double> gmst_;     ///< Greenwich mean sidereal time (mjd2gmst) per second
 };
 }  // namespace VieVS
 
@@ -29,6 +29,7 @@
 #define VLBI_SCHEDULER_VIEVS_OBJECT_H
 
 
+#include <atomic>
 #include <string>
 
 
@@ -19,24 +19,95 @@
 #include "WeightFactors.h"
 
 
-double thread_local VieVS::WeightFactors::weightSkyCoverage = 0;
-double thread_local VieVS::WeightFactors::weightNumberOfObservations = 0;
-double thread_local VieVS::WeightFactors::weightDuration = 0;
+using namespace VieVS;
 
-double thread_local VieVS::WeightFactors::weightAverageSources = 0;
-double thread_local VieVS::WeightFactors::weightAverageStations = 0;
-double thread_local VieVS::WeightFactors::weightAverageBaselines = 0;
 
-double thread_local VieVS::WeightFactors::weightIdleTime = 0;
-unsigned int thread_local VieVS::WeightFactors::idleTimeInterval = 0;
+void WeightFactors::summary( std::ofstream &of ) const {
+    of << "weight factors: \n";
+    if ( weightSkyCoverage != 0 ) {
+        of << " sky coverage:           " << weightSkyCoverage << "\n";
+    }
+    if ( weightNumberOfObservations != 0 ) {
+        of << " number of observations: " << weightNumberOfObservations << "\n";
+    }
+    if ( weightDuration != 0 ) {
+        of << " duration:               " << weightDuration << "\n";
+    }
+    if ( weightAverageSources != 0 ) {
+        of << " average sources:        " << weightAverageSources << "\n";
+    }
+    if ( weightAverageStations != 0 ) {
+        of << " average stations:       " << weightAverageStations << "\n";
+    }
+    if ( weightAverageBaselines != 0 ) {
+        of << " average baselines:      " << weightAverageBaselines << "\n";
+    }
+    if ( weightIdleTime != 0 ) {
+        of << " weight idle time:       " << weightIdleTime << "\n";
+        of << "     idle time interval: " << idleTimeInterval << "\n";
+    }
+    if ( weightClosures != 0 ) {
+        of << " closures:               " << weightClosures << "\n";
+        of << "     max closures:       " << maxClosures << "\n";
+    }
+    if ( weightDeclination != 0 ) {
+        of << " declination             " << weightDeclination << "\n";
+        of << "     from 90 to " << declinationStartWeight * rad2deg << " = 0\n";
+        of << "     from " << declinationStartWeight * rad2deg << " to " << declinationFullWeight * rad2deg
+           << " = linear interpolation\n";
+        of << "     from " << declinationFullWeight * rad2deg << " to -90"
+           << " = 1\n";
+    }
+    if ( weightLowElevation != 0 ) {
+        of << " elevation               " << weightLowElevation << "\n";
+        of << "     from 90 to " << lowElevationStartWeight * rad2deg << " = 0\n";
+        of << "     from " << lowElevationStartWeight * rad2deg << " to " << lowElevationFullWeight * rad2deg
+           << " = linear interpolation\n";
+        of << "     from " << lowElevationFullWeight * rad2deg << " to 0"
+           << " = 1\n";
+    }
+    of << "\n";
+}
 
-double thread_local VieVS::WeightFactors::weightClosures = 0;
-unsigned int thread_local VieVS::WeightFactors::maxClosures = 0;
 
-double thread_local VieVS::WeightFactors::weightDeclination = 0;
-double thread_local VieVS::WeightFactors::declinationStartWeight = 0;
-double thread_local VieVS::WeightFactors::declinationFullWeight = 0;
+std::string WeightFactors::statisticsValues() const {
+    double sum = weightSkyCoverage + weightNumberOfObservations + weightDuration + weightAverageSources +
+                 weightAverageStations + weightAverageBaselines + weightIdleTime + weightDeclination +
+                 weightLowElevation + weightClosures;
 
-double thread_local VieVS::WeightFactors::weightLowElevation = 0;
-double thread_local VieVS::WeightFactors::lowElevationStartWeight = 30;
-double thread_local VieVS::WeightFactors::lowElevationFullWeight = 20;
+    std::ostringstream str;
+
+    str << weightSkyCoverage / sum << "," << weightNumberOfObservations / sum << "," << weightDuration / sum << ","
+        << weightAverageSources / sum << "," << weightAverageStations / sum << "," << weightAverageBaselines / sum
+        << "," << weightIdleTime / sum << ",";
+
+    if ( weightIdleTime == 0 ) {
+        str << 0 << ",";
+    } else {
+        str << idleTimeInterval << ",";
+    }
+
+    str << weightClosures / sum << ",";
+    if ( maxClosures == 0 ) {
+        str << 0 << ",";
+    } else {
+        str << maxClosures << ",";
+    }
+
+    str << weightDeclination / sum << ",";
+    if ( weightDeclination == 0 ) {
+        str << 0 << "," << 0 << ",";
+    } else {
+        str << declinationStartWeight << "," << declinationFullWeight << ",";
+    }
+
+
+    str << weightLowElevation / sum << ",";
+    if ( weightLowElevation == 0 ) {
+        str << 0 << "," << 0 << ",";
+    } else {
+        str << lowElevationStartWeight << "," << lowElevationFullWeight << ",";
+    }
+
+    return str.str();
+}
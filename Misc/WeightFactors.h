@@ -40,35 +40,38 @@ namespace VieVS {
  * @class WeightFactors
  * @brief storage of all VLBI weight factors
  *
+ * Weight factors of one schedule. They are read from the parameter file, might be changed by multi scheduling and
+ * are passed to the scan selection as part of the SchedulingContext.
+ *
  * @author Matthias Schartner
  * @date 14.08.2017
  */
 class WeightFactors {
    public:
-    static thread_local double weightSkyCoverage;           ///< weight factor for sky Coverage
-    static thread_local double weightNumberOfObservations;  ///< weight factor for number of observations
-    static thread_local double weightDuration;              ///< weight factor for duration
+    double weightSkyCoverage = 0;           ///< weight factor for sky Coverage
+    double weightNumberOfObservations = 0;  ///< weight factor for number of observations
+    double weightDuration = 0;              ///< weight factor for duration
 
-    static thread_local double weightAverageSources;    ///< weight factor for average out sources
-    static thread_local double weightAverageStations;   ///< weight factor for average out stations
-    static thread_local double weightAverageBaselines;  ///< weight factor for average out baselines
+    double weightAverageSources = 0;    ///< weight factor for average out sources
+    double weightAverageStations = 0;   ///< weight factor for average out stations
+    double weightAverageBaselines = 0;  ///< weight factor for average out baselines
 
-    static thread_local double weightIdleTime;          ///< weight factor for extra weight after long idle time
-    static thread_local unsigned int idleTimeInterval;  ///< long idle time interval
+    double weightIdleTime = 0;          ///< weight factor for extra weight after long idle time
+    unsigned int idleTimeInterval = 0;  ///< long idle time interval
 
-    static thread_local double weightClosures;          ///< weight factor for closure delays
-    static thread_local unsigned int maxClosures;       ///< maximum number of closure delays
+    double weightClosures = 0;     ///< weight factor for closure delays
+    unsigned int maxClosures = 0;  ///< maximum number of closure delays
 
-    static thread_local double weightDeclination;       ///< weight factor for declination
-    static thread_local double declinationStartWeight;  ///< start declination of additional weight
+    double weightDeclination = 0;       ///< weight factor for declination
+    double declinationStartWeight = 0;  ///< start declination of additional weight
     ///< (everything above has factor 0)
-    static thread_local double declinationFullWeight;  ///< end declination of additional declination weight slope
+    double declinationFullWeight = 0;  ///< end declination of additional declination weight slope
     ///< (everything below has factor 1)
 
-    static thread_local double weightLowElevation;       ///< weight factor for low elevation scans
-    static thread_local double lowElevationStartWeight;  ///< start elevation of additional weight
+    double weightLowElevation = 0;        ///< weight factor for low elevation scans
+    double lowElevationStartWeight = 30;  ///< start elevation of additional weight
     ///< (everything above has factor 0)
-    static thread_local double lowElevationFullWeight;  ///< end elevation of additional declination weight slope
+    double lowElevationFullWeight = 20;  ///< end elevation of additional declination weight slope
     ///< (everything below has factor 1)
 
 
@@ -78,52 +81,7 @@ class WeightFactors {
      *
      * @param of out stream object
      */
-    static void summary( std::ofstream &of ) {
-        of << "weight factors: \n";
-        if ( weightSkyCoverage != 0 ) {
-            of << " sky coverage:           " << weightSkyCoverage << "\n";
-        }
-        if ( weightNumberOfObservations != 0 ) {
-            of << " number of observations: " << weightNumberOfObservations << "\n";
-        }
-        if ( weightDuration != 0 ) {
-            of << " duration:               " << weightDuration << "\n";
-        }
-        if ( weightAverageSources != 0 ) {
-            of << " average sources:        " << weightAverageSources << "\n";
-        }
-        if ( weightAverageStations != 0 ) {
-            of << " average stations:       " << weightAverageStations << "\n";
-        }
-        if ( weightAverageBaselines != 0 ) {
-            of << " average baselines:      " << weightAverageBaselines << "\n";
-        }
-        if ( weightIdleTime != 0 ) {
-            of << " weight idle time:       " << weightIdleTime << "\n";
-            of << "     idle time interval: " << idleTimeInterval << "\n";
-        }
-        if ( weightClosures != 0 ) {
-            of << " closures:               " << weightClosures << "\n";
-            of << "     max closures:       " << maxClosures << "\n";
-        }
-        if ( weightDeclination != 0 ) {
-            of << " declination             " << weightDeclination << "\n";
-            of << "     from 90 to " << declinationStartWeight * rad2deg << " = 0\n";
-            of << "     from " << declinationStartWeight * rad2deg << " to " << declinationFullWeight * rad2deg
-               << " = linear interpolation\n";
-            of << "     from " << declinationFullWeight * rad2deg << " to -90"
-               << " = 1\n";
-        }
-        if ( weightLowElevation != 0 ) {
-            of << " elevation               " << weightLowElevation << "\n";
-            of << "     from 90 to " << lowElevationStartWeight * rad2deg << " = 0\n";
-            of << "     from " << lowElevationStartWeight * rad2deg << " to " << lowElevationFullWeight * rad2deg
-               << " = linear interpolation\n";
-            of << "     from " << lowElevationFullWeight * rad2deg << " to 0"
-               << " = 1\n";
-        }
-        of << "\n";
-    }
+    void summary( std::ofstream &of ) const;
 
 
     /**
@@ -154,47 +112,7 @@ class WeightFactors {
      * @brief value entries for statistics.csv file
      * @author Matthias Schartner
      */
-    static std::string statisticsValues() {
-        double sum = weightSkyCoverage + weightNumberOfObservations + weightDuration + weightAverageSources +
-                     weightAverageStations + weightAverageBaselines + weightIdleTime + weightDeclination +
-                     weightLowElevation + weightClosures;
-
-        std::ostringstream str;
-
-        str << weightSkyCoverage / sum << "," << weightNumberOfObservations / sum << "," << weightDuration / sum << ","
-            << weightAverageSources / sum << "," << weightAverageStations / sum << "," << weightAverageBaselines / sum
-            << "," << weightIdleTime / sum << ",";
-
-        if ( weightIdleTime == 0 ) {
-            str << 0 << ",";
-        } else {
-            str << idleTimeInterval << ",";
-        }
-
-        str << weightClosures / sum << ",";
-        if ( maxClosures == 0 ) {
-            str << 0 << ",";
-        } else {
-            str << maxClosures << ",";
-        }
-
-        str << weightDeclination / sum << ",";
-        if ( weightDeclination == 0 ) {
-            str << 0 << "," << 0 << ",";
-        } else {
-            str << declinationStartWeight << "," << declinationFullWeight << ",";
-        }
-
-
-        str << weightLowElevation / sum << ",";
-        if ( weightLowElevation == 0 ) {
-            str << 0 << "," << 0 << ",";
-        } else {
-            str << lowElevationStartWeight << "," << lowElevationFullWeight << ",";
-        }
-
-        return str.str();
-    }
+    std::string statisticsValues() const;
 };
 }  // namespace VieVS
 #endif  // WEIGHTFACTORS_H
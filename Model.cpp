@@ -105,6 +105,8 @@ namespace VieVS {
             src2idx_.insert(std::make_pair(q->getId(), src2idx_.size()));
         }
 
+        Model::precalcStationVisibility();
+
         // StaActive
         size_t count = 0;
         for(size_t t = 0; t < blockCount_; ++t) {
@@ -471,8 +473,40 @@ namespace VieVS {
 
 // helper implementations
 namespace VieVS {
+    void Model::precalcStationVisibility(void) noexcept {
+        std::vector<std::shared_ptr<const AbstractSource>> sources = sourceList_.getSources();
+        size_t nsta = network_.getNSta();
+        size_t nsrc = sourceList_.getNSrc();
+        staVisible_.assign((blockCount_ + 1) * nsta * nsrc, 0);
+
+        for(Station& s : network_.refStations()) {
+            for(size_t t = 0; t <= blockCount_; ++t) {
+                std::vector<PointingVector> pvs;
+                pvs.reserve(sources.size());
+                for(const auto& q : sources) {
+                    pvs.emplace_back(s.getId(), q->getId());
+                    pvs.back().setTime(t * blockLength_);
+                }
+                s.calcAzEl_rigorous(sources, pvs);
+
+                for(size_t i = 0; i < sources.size(); ++i) {
+                    const auto& q = sources[i];
+                    size_t idx = (t * nsta + s.getId()) * nsrc + q->getId();
+                    staVisible_[idx] = s.isVisible(pvs[i], q->getPARA().minElevation);
+                }
+            }
+        }
+    }
+
     bool Model::checkStationVisibility(size_t t, 
         std::shared_ptr<const VieVS::AbstractSource> q, Station& s) const noexcept {
+        size_t nsta = network_.getNSta();
+        size_t nsrc = sourceList_.getNSrc();
+        if(!staVisible_.empty() && t + 1 <= blockCount_) {
+            return staVisible_[(t * nsta + s.getId()) * nsrc + q->getId()] && 
+                staVisible_[((t + 1) * nsta + s.getId()) * nsrc + q->getId()];
+        }
+
         // make sure source is visible at this time
         PointingVector pv0(s.getId(), q->getId());
         pv0.setTime(t * blockLength_);
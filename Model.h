@@ -133,6 +133,10 @@ private:
         const std::shared_ptr<const AbstractSource> q2,
         size_t t1, size_t t2) const noexcept;
 
+    // calculates visibility of all sources for all stations at all block boundaries
+    // (one batched azimuth/elevation calculation per station and epoch)
+    void precalcStationVisibility(void) noexcept;
+
 private:
     // references from VieVS::Scheduler
     VieVS::Network& network_;
@@ -147,6 +151,8 @@ private:
     size_t windowBlockCount_;
     // the length of the sliding optimization window (in seconds)
     unsigned int windowLength_;
+    // visibility of each source per station at each block boundary, indexed by [t][staid][srcid]
+    std::vector<char> staVisible_;
 
 private:
     // the sky coverage model used for the objective function
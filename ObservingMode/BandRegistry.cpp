@@ -0,0 +1,70 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BandRegistry.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+std::vector<std::string> BandRegistry::names_;
+std::unordered_map<std::string, unsigned long> BandRegistry::ids_;
+bool BandRegistry::frozen_ = false;
+constexpr double BandRegistry::undefined;
+
+
+unsigned long BandRegistry::registerBand( const std::string &band ) {
+    auto it = ids_.find( band );
+    if ( it != ids_.end() ) {
+        return it->second;
+    }
+    if ( frozen_ ) {
+        throw logic_error( "band " + band + " registered after observing mode initialization" );
+    }
+    unsigned long id = names_.size();
+    names_.push_back( band );
+    ids_[band] = id;
+    return id;
+}
+
+
+boost::optional<unsigned long> BandRegistry::getId( const std::string &band ) {
+    auto it = ids_.find( band );
+    if ( it == ids_.end() ) {
+        return boost::none;
+    }
+    return it->second;
+}
+
+
+std::vector<double> BandRegistry::perBand( const std::unordered_map<std::string, double> &values ) {
+    vector<double> v = undefinedPerBand();
+    for ( const auto &any : values ) {
+        auto it = ids_.find( any.first );
+        if ( it != ids_.end() ) {
+            v[it->second] = any.second;
+        }
+    }
+    return v;
+}
+
+
+void BandRegistry::throwUndefined( unsigned long bandId, const char *what, const std::string &owner ) {
+    string band = bandId < names_.size() ? names_[bandId] : "with id " + to_string( bandId );
+    throw out_of_range( string( what ) + " of band " + band + " not defined in parameters " + owner );
+}
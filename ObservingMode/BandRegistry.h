@@ -0,0 +1,175 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file BandRegistry.h
+ * @brief class BandRegistry
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+
+#ifndef VIESCHEDPP_BANDREGISTRY_H
+#define VIESCHEDPP_BANDREGISTRY_H
+
+
+#include <boost/optional.hpp>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace VieVS {
+
+/**
+ * @class BandRegistry
+ * @brief dense integer ids of all observed bands
+ *
+ * Each band name gets a small integer id when it is first registered. Ids are never changed or removed. Per band
+ * values (minimum SNR, recording rates, flux information, ...) can therefore be stored in flat vectors indexed by band
+ * id instead of string keyed maps.
+ *
+ * Bands are only registered while the observing mode is initialized. The registry is frozen afterwards (see freeze),
+ * before any station, baseline or source parameters are created. From then on it is read only and can be used
+ * concurrently by all schedulers. Registering a new band in a frozen registry throws.
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+class BandRegistry {
+   public:
+    /**
+     * @brief register a band
+     * @author Matthias Schartner
+     *
+     * @param band band name
+     * @return band id (existing id if band is already registered)
+     * @throws std::logic_error if band is new and the registry is already frozen
+     */
+    static unsigned long registerBand( const std::string &band );
+
+
+    /**
+     * @brief freeze registry after observing mode initialization
+     * @author Matthias Schartner
+     */
+    static void freeze() { frozen_ = true; }
+
+
+    /**
+     * @brief check if registry is frozen
+     * @author Matthias Schartner
+     *
+     * @return true if no new bands can be registered
+     */
+    static bool isFrozen() { return frozen_; }
+
+
+    /**
+     * @brief get id of a band
+     * @author Matthias Schartner
+     *
+     * @param band band name
+     * @return band id or none if band is not registered
+     */
+    static boost::optional<unsigned long> getId( const std::string &band );
+
+
+    /**
+     * @brief get name of a band
+     * @author Matthias Schartner
+     *
+     * @param id band id
+     * @return band name
+     */
+    static const std::string &getName( unsigned long id ) { return names_[id]; }
+
+
+    /**
+     * @brief number of registered bands
+     * @author Matthias Schartner
+     *
+     * @return number of registered bands
+     */
+    static unsigned long size() { return names_.size(); }
+
+
+    /**
+     * @brief vector with one undefined value per registered band
+     * @author Matthias Schartner
+     *
+     * @return undefined value per band id
+     */
+    static std::vector<double> undefinedPerBand() { return std::vector<double>( names_.size(), undefined ); }
+
+
+    /**
+     * @brief convert band name keyed values to a vector indexed by band id
+     * @author Matthias Schartner
+     *
+     * Registered bands without entry in values are undefined, see at().
+     *
+     * @param values value per band name
+     * @return value per band id
+     */
+    static std::vector<double> perBand( const std::unordered_map<std::string, double> &values );
+
+
+    /**
+     * @brief bounds checked access to a value per band id
+     * @author Matthias Schartner
+     *
+     * @param values value per band id (see perBand)
+     * @param bandId band id
+     * @param what name of value (used in error message)
+     * @param owner name of object holding the values (used in error message)
+     * @return value of this band
+     * @throws std::out_of_range if there is no value for this band
+     */
+    static double at( const std::vector<double> &values, unsigned long bandId, const char *what,
+                      const std::string &owner ) {
+        if ( bandId >= values.size() || std::isnan( values[bandId] ) ) {
+            throwUndefined( bandId, what, owner );
+        }
+        return values[bandId];
+    }
+
+   private:
+    static constexpr double undefined = std::numeric_limits<double>::quiet_NaN();  ///< marker of undefined values
+
+    static std::vector<std::string> names_;                      ///< band name per band id
+    static std::unordered_map<std::string, unsigned long> ids_;  ///< band id per band name
+    static bool frozen_;                                         ///< no new bands can be registered
+
+
+    /**
+     * @brief throw error for undefined value
+     * @author Matthias Schartner
+     *
+     * @param bandId band id
+     * @param what name of value
+     * @param owner name of object holding the values
+     */
+    [[noreturn]] static void throwUndefined( unsigned long bandId, const char *what, const std::string &owner );
+};
+}  // namespace VieVS
+
+#endif  // VIESCHEDPP_BANDREGISTRY_H
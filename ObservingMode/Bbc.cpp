@@ -22,8 +22,8 @@
 using namespace VieVS;
 using namespace std;
 
-unsigned long VieVS::Bbc::nextId = 0;
-unsigned long VieVS::Bbc::Bbc_assign::nextId = 0;
+std::atomic<unsigned long> VieVS::Bbc::nextId{ 0 };
+std::atomic<unsigned long> VieVS::Bbc::Bbc_assign::nextId{ 0 };
 
 
 Bbc::Bbc( std::string name ) : VieVS_NamedObject{ std::move( name ), nextId++ } {}
@@ -137,7 +137,7 @@ class Bbc : public VieVS_NamedObject {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     /**
      * @class Bbc_assign
@@ -180,7 +180,7 @@ class Bbc : public VieVS_NamedObject {
         unsigned int physical_bbc_number_;  ///< Physical BBC# or DBE channel#
         std::string if_name_;               ///< Logical IF 'link' with if_def statement in $IF block
        private:
-        static unsigned long nextId;  ///< next id for this object type
+        static std::atomic<unsigned long> nextId;  ///< next id for this object type
     };
 
 
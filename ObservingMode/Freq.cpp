@@ -22,8 +22,8 @@
 using namespace VieVS;
 using namespace std;
 
-unsigned long VieVS::Freq::nextId = 0;
-unsigned long VieVS::Freq::Chan_def::nextId = 0;
+std::atomic<unsigned long> VieVS::Freq::nextId{ 0 };
+std::atomic<unsigned long> VieVS::Freq::Chan_def::nextId{ 0 };
 
 
 Freq::Freq( std::string name ) : VieVS_NamedObject{ std::move( name ), nextId++ } {}
@@ -254,7 +254,7 @@ class Freq : public VieVS_NamedObject {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     /**
      * @class Chan_def
@@ -309,7 +309,7 @@ class Freq : public VieVS_NamedObject {
         std::string phase_cal_id_;   ///< 'Phase-cal_ID': Logical phase-cal name
 
        private:
-        static unsigned long nextId;  ///< next id for this object type
+        static std::atomic<unsigned long> nextId;  ///< next id for this object type
     };
 
 
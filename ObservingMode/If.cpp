@@ -22,8 +22,8 @@
 using namespace VieVS;
 using namespace std;
 
-unsigned long VieVS::If::nextId = 0;
-unsigned long VieVS::If::If_def::nextId = 0;
+std::atomic<unsigned long> VieVS::If::nextId{ 0 };
+std::atomic<unsigned long> VieVS::If::If_def::nextId{ 0 };
 
 
 If::If( std::string name ) : VieVS_NamedObject{ std::move( name ), nextId++ } {}
@@ -258,7 +258,7 @@ class If : public VieVS_NamedObject {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     /**
      * @class If_def
@@ -311,7 +311,7 @@ class If : public VieVS_NamedObject {
         double phase_cal_base_frequency_;  ///< Phase-cal base frequency
 
        private:
-        static unsigned long nextId;  ///< next id for this object type
+        static std::atomic<unsigned long> nextId;  ///< next id for this object type
     };
 
 
@@ -23,7 +23,7 @@
 using namespace VieVS;
 using namespace std;
 
-unsigned long VieVS::Mode::nextId = 0;
+std::atomic<unsigned long> VieVS::Mode::nextId{ 0 };
 
 
 Mode::Mode( std::string name, unsigned long nsta ) : VieVS_NamedObject{ std::move( name ), nextId++ }, nsta_{ nsta } {}
@@ -122,6 +122,7 @@ void Mode::calcRecordingRates() {
 
             staids2efficiency_[{ staid1, staid2 }] = efficiency;
             staids2recordingRate_[{ staid1, staid2 }] = overlappingFrequencies;
+            indexRecordingRates( { staid1, staid2 } );
         }
     }
 }
@@ -138,6 +139,7 @@ void Mode::setRecordingRates( const std::string &band, double recRate ) {
         // update recording rate for this baseline and band
         for ( unsigned long staid2 = staid1 + 1; staid2 < nsta_; ++staid2 ) {
             staids2recordingRate_[{ staid1, staid2 }][band] = recRate;
+            indexRecordingRates( { staid1, staid2 } );
         }
     }
 }
@@ -378,6 +380,40 @@ double Mode::recordingRate( unsigned long staid1, unsigned long staid2, const st
 }
 
 
+const std::vector<double> &Mode::recordingRates( unsigned long staid1, unsigned long staid2 ) const {
+    static const vector<double> empty;
+    if ( staid1 > staid2 ) {
+        swap( staid1, staid2 );
+    }
+    auto it = staids2recordingRatePerBand_.find( { staid1, staid2 } );
+    // if station id combination is not saved in map all recording rates are 0
+    if ( it == staids2recordingRatePerBand_.end() ) {
+        return empty;
+    }
+    return it->second;
+}
+
+
+void Mode::indexBands() {
+    bandIds_.clear();
+    for ( const auto &band : bands_ ) {
+        bandIds_.push_back( BandRegistry::registerBand( band ) );
+    }
+}
+
+
+void Mode::indexRecordingRates( const std::pair<unsigned long, unsigned long> &staids ) {
+    vector<double> &rates = staids2recordingRatePerBand_[staids];
+    for ( const auto &any : staids2recordingRate_[staids] ) {
+        unsigned long id = BandRegistry::registerBand( any.first );
+        if ( rates.size() <= id ) {
+            rates.resize( id + 1, 0 );
+        }
+        rates[id] = any.second;
+    }
+}
+
+
 boost::optional<const std::vector<unsigned long> &> Mode::getAllStationsWithBlock(
     const std::shared_ptr<const If> &this_if ) const {
     for ( const auto &any : ifs_ ) {
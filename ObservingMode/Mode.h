@@ -36,6 +36,7 @@
 
 #include "../Input/SkdCatalogReader.h"
 #include "../Misc/VieVS_NamedObject.h"
+#include "BandRegistry.h"
 #include "Bbc.h"
 #include "Freq.h"
 #include "If.h"
@@ -110,6 +111,7 @@ class Mode : public VieVS_NamedObject {
         freqs_.emplace_back( newFreq, staids );
         const auto &tmp = newFreq->getBands();
         bands_.insert( tmp.begin(), tmp.end() );
+        indexBands();
     }
 
 
@@ -170,7 +172,10 @@ class Mode : public VieVS_NamedObject {
      *
      * @param bands list of all bands
      */
-    void setBands( const std::set<std::string> &bands ) { bands_ = bands; }
+    void setBands( const std::set<std::string> &bands ) {
+        bands_ = bands;
+        indexBands();
+    }
 
 
     /**
@@ -185,6 +190,19 @@ class Mode : public VieVS_NamedObject {
     double recordingRate( unsigned long staid1, unsigned long staid2, const std::string &band ) const;
 
 
+    /**
+     * @brief recording rate per band id for observation
+     * @author Matthias Schartner
+     *
+     * bands without entry at the end of the vector have a recording rate of 0
+     *
+     * @param staid1 station 1
+     * @param staid2 station 2
+     * @return recording rate per band id
+     */
+    const std::vector<double> &recordingRates( unsigned long staid1, unsigned long staid2 ) const;
+
+
     /**
      * @brief efficiency factor between stations
      * @author Matthias Schartner
@@ -366,6 +384,15 @@ class Mode : public VieVS_NamedObject {
     const std::set<std::string> &getAllBands() const { return bands_; }
 
 
+    /**
+     * @brief get ids of all bands
+     * @author Matthias Schartner
+     *
+     * @return ids of all bands (see BandRegistry)
+     */
+    const std::vector<unsigned long> &getAllBandIds() const { return bandIds_; }
+
+
     /**
      * @brief getter for number of stations
      * @author Matthias Schartner
@@ -496,7 +523,7 @@ class Mode : public VieVS_NamedObject {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     unsigned long nsta_;  ///< number of stations
 
@@ -514,13 +541,33 @@ class Mode : public VieVS_NamedObject {
     std::unordered_map<std::pair<unsigned long, unsigned long>, std::unordered_map<std::string, double>,
                        boost::hash<std::pair<unsigned long, unsigned long>>>
         staids2recordingRate_;  ///< recording rate per station ids and band
+    std::unordered_map<std::pair<unsigned long, unsigned long>, std::vector<double>,
+                       boost::hash<std::pair<unsigned long, unsigned long>>>
+        staids2recordingRatePerBand_;  ///< recording rate per station ids and band id
     std::unordered_map<std::pair<unsigned long, unsigned long>, double,
                        boost::hash<std::pair<unsigned long, unsigned long>>>
         staids2efficiency_;  ///< efficiency per station ids
 
     std::unordered_map<unsigned long, double> staid2totalRecordingRate_;  ///< total recording rate per station id
 
-    std::set<std::string> bands_;  ///< list of all bands
+    std::set<std::string> bands_;          ///< list of all bands
+    std::vector<unsigned long> bandIds_;  ///< ids of all bands (same order as bands_)
+
+
+    /**
+     * @brief register all bands and update band ids
+     * @author Matthias Schartner
+     */
+    void indexBands();
+
+
+    /**
+     * @brief copy recording rates of one station pair to vector indexed by band id
+     * @author Matthias Schartner
+     *
+     * @param staids station ids
+     */
+    void indexRecordingRates( const std::pair<unsigned long, unsigned long> &staids );
 
     /**
      * @brief station ids to property tree
@@ -8,7 +8,7 @@
 using namespace VieVS;
 using namespace std;
 
-unsigned long VieVS::ObservingMode::nextId = 0;
+std::atomic<unsigned long> VieVS::ObservingMode::nextId{ 0 };
 
 VieVS::ObservingMode::Type VieVS::ObservingMode::type = VieVS::ObservingMode::Type::simple;
 
@@ -18,6 +18,9 @@ std::unordered_map<std::string, double> VieVS::ObservingMode::wavelengths{
 
 std::unordered_map<std::string, double> VieVS::ObservingMode::minSNR;  ///< backup min SNR
 
+std::vector<VieVS::ObservingMode::Backup> VieVS::ObservingMode::sourceBackupPerBand;
+std::vector<double> VieVS::ObservingMode::wavelengthPerBand;
+
 std::unordered_map<std::string, VieVS::ObservingMode::Property>
     VieVS::ObservingMode::stationProperty;  ///< is band required or optional for station
 std::unordered_map<std::string, VieVS::ObservingMode::Backup>
@@ -180,6 +183,7 @@ void ObservingMode::simpleMode( unsigned long nsta, double samplerate, unsigned
 
     for ( const auto &any : band2channel ) {
         bands.insert( any.first );
+        BandRegistry::registerBand( any.first );
         double recRate = samplerate * bits * any.second * 1e6;
         mode->setRecordingRates( any.first, recRate );
 
@@ -723,7 +727,28 @@ void ObservingMode::calcMeanFrequencies() {
 void ObservingMode::addDummyBands( const std::map<std::string, std::vector<double>> &band ) {
     for ( const auto &any : band ) {
         bands.insert( any.first );
+        BandRegistry::registerBand( any.first );
         double mfreq = accumulate( any.second.begin(), any.second.end(), 0.0 ) / any.second.size();
         wavelengths[any.first] = mfreq;
     }
 }
+
+
+void ObservingMode::indexBands() {
+    // all bands are known now, station, baseline and source parameters are created afterwards
+    BandRegistry::freeze();
+    unsigned long nbands = BandRegistry::size();
+    sourceBackupPerBand = vector<Backup>( nbands, Backup::none );
+    wavelengthPerBand = vector<double>( nbands, 0 );
+    for ( unsigned long iband = 0; iband < nbands; ++iband ) {
+        const string &band = BandRegistry::getName( iband );
+        auto itBackup = sourceBackup.find( band );
+        if ( itBackup != sourceBackup.end() ) {
+            sourceBackupPerBand[iband] = itBackup->second;
+        }
+        auto itWavelength = wavelengths.find( band );
+        if ( itWavelength != wavelengths.end() ) {
+            wavelengthPerBand[iband] = itWavelength->second;
+        }
+    }
+}
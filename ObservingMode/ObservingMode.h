@@ -20,6 +20,7 @@
 #define VIESCHEDPP_OBSMODES_H
 
 
+#include "BandRegistry.h"
 #include "Mode.h"
 
 /**
@@ -88,6 +89,18 @@ class ObservingMode : public VieVS_Object {
     static std::set<std::string> bands;                          ///< list of all observed bands
     static std::unordered_map<std::string, double> wavelengths;  ///< backup wavelength for commonly used bands
 
+    static std::vector<Backup> sourceBackupPerBand;  ///< backup version for source per band id (see indexBands)
+    static std::vector<double> wavelengthPerBand;    ///< wavelength per band id (see indexBands)
+
+
+    /**
+     * @brief copy band name keyed source backup models and wavelengths to vectors indexed by band id
+     * @author Matthias Schartner
+     *
+     * has to be called after the observing mode and band policies are initialized. Freezes the BandRegistry.
+     */
+    static void indexBands();
+
     /**
      * @brief constructor
      * @author Matthias Schartner
@@ -186,6 +199,9 @@ class ObservingMode : public VieVS_Object {
         freqs_.push_back( newFreq );
         const auto &tmp = newFreq->getBands();
         ObservingMode::bands.insert( tmp.begin(), tmp.end() );
+        for ( const auto &band : tmp ) {
+            BandRegistry::registerBand( band );
+        }
     }
 
 
@@ -467,7 +483,7 @@ class ObservingMode : public VieVS_Object {
 
 
    private:
-    static unsigned long nextId;             ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
     std::vector<std::string> stationNames_;  ///< station names
 
     std::vector<std::shared_ptr<const Mode>> modes_;                     ///< list of all MODE blocks
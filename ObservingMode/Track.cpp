@@ -22,8 +22,8 @@
 using namespace VieVS;
 using namespace std;
 
-unsigned long VieVS::Track::nextId = 0;
-unsigned long VieVS::Track::Fanout_definition::nextId = 0;
+std::atomic<unsigned long> VieVS::Track::nextId{ 0 };
+std::atomic<unsigned long> VieVS::Track::Fanout_definition::nextId{ 0 };
 
 
 Track::Track( std::string name ) : VieVS_NamedObject{ std::move( name ), nextId++ } {}
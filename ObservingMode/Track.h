@@ -215,7 +215,7 @@ class Track : public VieVS_NamedObject {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     /**
      * @class Fanout_definition
@@ -273,7 +273,7 @@ class Track : public VieVS_NamedObject {
         int fourth_multiplex_track_;  ///< Fourth multiplex track
 
        private:
-        static unsigned long nextId;  ///< next id for this object type
+        static std::atomic<unsigned long> nextId;  ///< next id for this object type
     };
 
 
@@ -22,7 +22,7 @@
 using namespace VieVS;
 using namespace std;
 
-unsigned long Ast::nextId = 0;
+std::atomic<unsigned long> Ast::nextId{ 0 };
 
 
 Ast::Ast( const std::string &file ) : VieVS_Object( nextId++ ) { of = ofstream( file ); }
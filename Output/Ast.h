@@ -81,7 +81,7 @@ class Ast : public VieVS_Object {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     std::ofstream of;  ///< output stream object
 
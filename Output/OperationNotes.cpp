@@ -22,7 +22,7 @@
 using namespace VieVS;
 using namespace std;
 
-unsigned long OperationNotes::nextId = 0;
+std::atomic<unsigned long> OperationNotes::nextId{ 0 };
 
 
 OperationNotes::OperationNotes( const std::string &file ) : VieVS_Object( nextId++ ) { of = ofstream( file ); }
@@ -31,7 +31,8 @@ OperationNotes::OperationNotes( const std::string &file ) : VieVS_Object( nextId
 void OperationNotes::writeOperationNotes( const Network &network, const SourceList &sourceList,
                                           const std::vector<Scan> &scans,
                                           const std::shared_ptr<const ObservingMode> &obsModes,
-                                          const boost::property_tree::ptree &xml, int version,
+                                          const boost::property_tree::ptree &xml, const WeightFactors &weightFactors,
+                                          int version,
                                           boost::optional<MultiScheduling::Parameters> multiSchedulingParameters ) {
     string expName = xml.get( "VieSchedpp.general.experimentName", "schedule" );
     string description = xml.get( "VieSchedpp.output.experimentDescription", "" );
@@ -229,7 +230,7 @@ void OperationNotes::writeOperationNotes( const Network &network, const SourceLi
           "====================================\n\n";
 
     displayGeneralStatistics( scans );
-    WeightFactors::summary( of );
+    weightFactors.summary( of );
     displaySatelliteAvoidance();
 
     displaySkyCoverageScore( network );
@@ -65,12 +65,14 @@ class OperationNotes : public VieVS_Object {
      * @param scans list of all scans
      * @param obsModes observing mode
      * @param xml paramters.xml file
+     * @param weightFactors weight factors of this schedule
      * @param version version number
      * @param multiSchedulingParameters multi scheduling parameters
      */
     void writeOperationNotes( const Network &network, const SourceList &sourceList, const std::vector<Scan> &scans,
                               const std::shared_ptr<const ObservingMode> &obsModes,
-                              const boost::property_tree::ptree &xml, int version,
+                              const boost::property_tree::ptree &xml, const WeightFactors &weightFactors,
+                              int version,
                               boost::optional<MultiScheduling::Parameters> multiSchedulingParameters = boost::none );
 
 
@@ -86,7 +88,7 @@ class OperationNotes : public VieVS_Object {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     std::ofstream of;  ///< output stream object
 
@@ -21,7 +21,7 @@
 
 using namespace std;
 using namespace VieVS;
-unsigned long Output::nextId = 0;
+std::atomic<unsigned long> Output::nextId{ 0 };
 
 
 Output::Output(Scheduler &sched)
@@ -33,6 +33,7 @@ Output::Output(Scheduler &sched)
           obsModes_{ sched.obsModes_ },
           path_{std::move(sched.path_)},
           multiSchedulingParameters_{ std::move( sched.multiSchedulingParameters_ ) },
+          weightFactors_{ sched.context_.weightFactors },
           version_{sched.version_} {}
 
 
@@ -140,7 +141,7 @@ void Output::writeSkd( const SkdCatalogReader &skdCatalogReader ) {
     cout << "[info] writing skd file to: " << fileName;
 #endif
     Skd skd( path_ + fileName );
-    skd.writeSkd( network_, sourceList_, scans_, skdCatalogReader, xml_ );
+    skd.writeSkd( network_, sourceList_, scans_, skdCatalogReader, xml_, weightFactors_ );
 }
 
 
@@ -153,7 +154,8 @@ void Output::writeOperationsNotes() {
     cout << "[info] writing operation notes file to: " << fileName;
 #endif
     OperationNotes notes( path_ + fileName );
-    notes.writeOperationNotes( network_, sourceList_, scans_, obsModes_, xml_, version_, multiSchedulingParameters_ );
+    notes.writeOperationNotes( network_, sourceList_, scans_, obsModes_, xml_, weightFactors_, version_,
+                               multiSchedulingParameters_ );
 }
 
 
@@ -511,7 +513,7 @@ void Output::writeStatistics( std::ofstream &of ) {
     oString.append( std::to_string( a25m60Mean ) ).append( "," );
     oString.append( std::to_string( a37m60Mean ) ).append( "," );
 
-    oString.append( WeightFactors::statisticsValues() );
+    oString.append( weightFactors_.statisticsValues() );
 
     for ( auto any : obsPer ) {
         oString.append( std::to_string( any ) ).append( "," );
@@ -158,7 +158,7 @@ class Output : public VieVS_NamedObject {
     void debugSkyCoverage();
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     boost::property_tree::ptree xml_;  ///< content of VieSchedpp.xml file
 
@@ -169,6 +169,7 @@ class Output : public VieVS_NamedObject {
     std::vector<Scan> scans_;                                                 ///< all scans in schedule
     const std::shared_ptr<const ObservingMode> &obsModes_;                    ///< observing mode
     boost::optional<MultiScheduling::Parameters> multiSchedulingParameters_;  ///< multi scheduling parameters
+    WeightFactors weightFactors_;                                             ///< weight factors of this schedule
 
 
     /**
@@ -22,7 +22,7 @@
 using namespace VieVS;
 using namespace std;
 
-unsigned long SNR_table::nextId = 0;
+std::atomic<unsigned long> SNR_table::nextId{ 0 };
 
 
 SNR_table::SNR_table( const std::string &file ) : VieVS_Object( nextId++ ) { of = ofstream( file ); }
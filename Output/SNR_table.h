@@ -65,7 +65,7 @@ class SNR_table : public VieVS_Object {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     std::ofstream of;  ///< output stream object *filename*.snr
 };
@@ -24,14 +24,15 @@
 using namespace std;
 using namespace VieVS;
 
-unsigned long Skd::nextId = 0;
+std::atomic<unsigned long> Skd::nextId{ 0 };
 
 
 Skd::Skd( const string &file ) : VieVS_Object( nextId++ ) { of = ofstream( file ); }
 
 
 void Skd::writeSkd( const Network &network, const SourceList &sourceList, const std::vector<Scan> &scans,
-                    const SkdCatalogReader &skdCatalogReader, const boost::property_tree::ptree &xml ) {
+                    const SkdCatalogReader &skdCatalogReader, const boost::property_tree::ptree &xml,
+                    const WeightFactors &weightFactors ) {
     of << "$EXPER " << xml.get<string>( "VieSchedpp.general.experimentName" ) << endl;
     //    if(xml.get_optional<std::string>("VieSchedpp.output.piName").is_initialized()){
     //        of << "* PI name:       " << *xml.get_optional<std::string>("VieSchedpp.output.piName") << "\n";
@@ -57,7 +58,7 @@ void Skd::writeSkd( const Network &network, const SourceList &sourceList, const
     skd_OP();
     skd_DOWNTIME( network );
     skd_MAJOR( network.getStations(), sourceList, xml, skdCatalogReader );
-    skd_MINOR();
+    skd_MINOR( weightFactors );
     skd_ASTROMETRIC();
     skd_BROADBAND();
     skd_CATALOG_USED( xml, skdCatalogReader );
@@ -292,7 +293,7 @@ void Skd::skd_MAJOR( const vector<Station> &stations, const SourceList &sourceLi
 }
 
 
-void Skd::skd_MINOR() {
+void Skd::skd_MINOR( const WeightFactors &weightFactors ) {
     //    of << "*\n";
     //    of <<
     //    "*=========================================================================================================\n";
@@ -304,18 +305,18 @@ void Skd::skd_MINOR() {
     of << boost::format( "%-14s %-3s %-3s %8.2f\n" ) % "Astro" % "No" % "Abs" % 0.00;
     of << boost::format( "%-14s %-3s %-3s %8.2f\n" ) % "BegScan" % "No" % "Abs" % 0.00;
     of << boost::format( "%-14s %-3s %-3s %8.2f\n" ) % "Covar" % "No" % "Abs" % 0.00;
-    of << boost::format( "%-14s %-3s %-3s %8.2f\n" ) % "EndScan" % "Yes" % "Abs" % WeightFactors::weightDuration;
+    of << boost::format( "%-14s %-3s %-3s %8.2f\n" ) % "EndScan" % "Yes" % "Abs" % weightFactors.weightDuration;
     of << boost::format( "%-14s %-3s %-3s %8.2f\n" ) % "LowDec" % "No" % "Abs" % 0.00;
     of << boost::format( "%-14s %-3s %-3s %8.2f 0.00\n" ) % "NumLoEl" % "No" % "Abs" % 0.00;
     of << boost::format( "%-14s %-3s %-3s %8.2f\n" ) % "NumRiseSet" % "No" % "Abs" % 0.00;
     of << boost::format( "%-14s %-3s %-3s %8.2f\n" ) % "NumObs" % "Yes" % "Abs" %
-              WeightFactors::weightNumberOfObservations;
-    of << boost::format( "%-14s %-3s %-3s %8.2f\n" ) % "SkyCov" % "Yes" % "Abs" % WeightFactors::weightSkyCoverage;
+              weightFactors.weightNumberOfObservations;
+    of << boost::format( "%-14s %-3s %-3s %8.2f\n" ) % "SkyCov" % "Yes" % "Abs" % weightFactors.weightSkyCoverage;
     of << boost::format( "%-14s %-3s %-3s %8.2f NONE\n" ) % "SrcEvn" % "Yes" % "Abs" %
-              WeightFactors::weightAverageSources;
+              weightFactors.weightAverageSources;
     of << boost::format( "%-14s %-3s %-3s %8.2f\n" ) % "SrcWt" % "Yes" % "Abs" % 1.00;
     of << boost::format( "%-14s %-3s %-3s %8.2f NONE\n" ) % "StatEvn" % "Yes" % "Abs" %
-              WeightFactors::weightAverageStations;
+              weightFactors.weightAverageStations;
     of << boost::format( "%-14s %-3s %-3s %8.2f\n" ) % "StatIdle" % "No" % "Abs" % 0.00;
     of << boost::format( "%-14s %-3s %-3s %8.2f\n" ) % "StatWt" % "Yes" % "Abs" % 1.00;
     of << boost::format( "%-14s %-3s %-3s %8.2f\n" ) % "TimeVar" % "No" % "Abs" % 0.00;
@@ -432,7 +433,7 @@ void Skd::skd_SOURCES( const SourceList &sourceList, const SkdCatalogReader &skd
     //    of <<
     //    "*=========================================================================================================\n";
     //    of << "*\n";
-    const map<string, vector<string>> &src = skdCatalogReader.getSourceCatalog();
+    const CatalogTable &src = skdCatalogReader.getSourceCatalog();
 
     for ( const auto &any : sourceList.getQuasars() ) {
         if ( any->getNTotalScans() > 0 ) {
@@ -586,7 +587,7 @@ void Skd::skd_FLUX( const SourceList &sourceList, const SkdCatalogReader &skdCat
     //    "*=========================================================================================================\n";
     //    of << "*\n";
 
-    const map<string, vector<string>> &flu = skdCatalogReader.getFluxCatalog();
+    const CatalogTable &flu = skdCatalogReader.getFluxCatalog();
     for ( const auto &any : sourceList.getSources() ) {
         if ( any->getNTotalScans() > 0 ) {
             const string &name = any->getName();
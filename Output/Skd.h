@@ -61,13 +61,15 @@ class Skd : public VieVS_Object {
      * @param scans scheduled scans
      * @param skdCatalogReader skd catalog reader
      * @param xml VieSchedpp.xml file
+     * @param weightFactors weight factors of this schedule
      */
     void writeSkd( const Network &network, const SourceList &sourceList, const std::vector<Scan> &scans,
-                   const SkdCatalogReader &skdCatalogReader, const boost::property_tree::ptree &xml );
+                   const SkdCatalogReader &skdCatalogReader, const boost::property_tree::ptree &xml,
+                   const WeightFactors &weightFactors );
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     std::ofstream of;  ///< output stream object *filename*.skd
 
@@ -115,8 +117,10 @@ class Skd : public VieVS_Object {
     /**
      * @brief write skd $MINOR block
      * @author Matthias Schartner
+     *
+     * @param weightFactors weight factors of this schedule
      */
-    void skd_MINOR();
+    void skd_MINOR( const WeightFactors &weightFactors );
 
 
     /**
@@ -22,7 +22,7 @@
 using namespace VieVS;
 using namespace std;
 
-unsigned long SourceStatistics::nextId = 0;
+std::atomic<unsigned long> SourceStatistics::nextId{ 0 };
 
 
 SourceStatistics::SourceStatistics( const std::string &file ) : VieVS_Object( nextId++ ) { of = ofstream( file ); }
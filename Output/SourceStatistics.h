@@ -68,7 +68,7 @@ class SourceStatistics : public VieVS_Object {
                     const boost::property_tree::ptree &xml );
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     std::ofstream of;  ///< output stream object
 
@@ -21,7 +21,7 @@
 
 using namespace std;
 using namespace VieVS;
-unsigned long Vex::nextId = 0;
+std::atomic<unsigned long> Vex::nextId{ 0 };
 
 
 Vex::Vex( const string &file ) : VieVS_Object( nextId++ ) {
@@ -132,7 +132,7 @@ class Vex : public VieVS_Object {
     }
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     std::ofstream of;                   ///< output stream object *filename*.vex
     std::string eol = ";\n";            ///< end of line string
@@ -0,0 +1,197 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CandidatePool.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+std::atomic<unsigned long> CandidatePool::nextId{ 0 };
+
+
+CandidatePool::CandidatePool() : VieVS_Object( nextId++ ) {}
+
+
+void CandidatePool::reset( unsigned long nsta, unsigned long nsrc ) {
+    stationStates_ = vector<StationState>( nsta );
+    stationVersions_ = vector<unsigned long>( nsta, 0 );
+    sourceStates_ = vector<SourceState>( nsrc );
+    sourceVersions_ = vector<unsigned long>( nsrc, 0 );
+    entries_ = vector<Entry>( nsrc );
+    mode_ = nullptr;
+
+    nReused_ = 0;
+    nRecomputed_ = 0;
+    usecSaved_ = 0;
+    totalUsecSaved_ = 0;
+    usecPerCandidate_ = 0;
+    nPerCandidate_ = 0;
+}
+
+
+void CandidatePool::clear() {
+#ifdef VIESCHEDPP_LOG
+    if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "candidate pool " << this->printId() << " cleared";
+#endif
+    for ( auto &entry : entries_ ) {
+        entry = Entry();
+    }
+}
+
+
+void CandidatePool::checkForChanges( const Network &network, const SourceList &sourceList,
+                                     const std::shared_ptr<const Mode> &mode ) {
+    if ( stationStates_.size() != network.getNSta() || entries_.size() != sourceList.getNSrc() ) {
+        reset( network.getNSta(), sourceList.getNSrc() );
+    }
+    if ( mode != mode_ ) {
+        clear();
+        mode_ = mode;
+    }
+
+    for ( const auto &sta : network.getStations() ) {
+        unsigned long staid = sta.getId();
+        StationState state = stationState( sta );
+        if ( !( state == stationStates_[staid] ) ) {
+            stationStates_[staid] = state;
+            ++stationVersions_[staid];
+        }
+    }
+
+    for ( const auto &src : sourceList.getSources() ) {
+        unsigned long srcid = src->getId();
+        SourceState state = sourceState( *src );
+        if ( !( state == sourceStates_[srcid] ) ) {
+            sourceStates_[srcid] = state;
+            ++sourceVersions_[srcid];
+        }
+    }
+}
+
+
+void CandidatePool::invalidateStation( unsigned long staid ) {
+    if ( staid < stationVersions_.size() ) {
+        ++stationVersions_[staid];
+    }
+}
+
+
+void CandidatePool::invalidateSource( unsigned long srcid ) {
+    if ( srcid < sourceVersions_.size() ) {
+        ++sourceVersions_[srcid];
+    }
+}
+
+
+bool CandidatePool::lookup( const Scan &visibleScan, boost::optional<Scan> &candidate ) const {
+    unsigned long srcid = visibleScan.getSourceId();
+    if ( srcid >= entries_.size() ) {
+        return false;
+    }
+
+    const Entry &entry = entries_[srcid];
+    if ( !entry.initialized || entry.type != visibleScan.getType() || entry.sourceVersion != sourceVersions_[srcid] ||
+         entry.pointingVectors.size() != visibleScan.getNSta() ) {
+        return false;
+    }
+
+    // start times and slew times depend on the pointing vectors of the visible scan
+    for ( unsigned long i = 0; i < entry.pointingVectors.size(); ++i ) {
+        const PointingVector &stored = entry.pointingVectors[i];
+        const PointingVector &pv = visibleScan.getPointingVector( static_cast<int>( i ) );
+        unsigned long staid = stored.getStaid();
+        if ( pv.getStaid() != staid || pv.getTime() != stored.getTime() || pv.getAz() != stored.getAz() ||
+             pv.getEl() != stored.getEl() || entry.stationVersions[i] != stationVersions_[staid] ) {
+            return false;
+        }
+    }
+
+    candidate = entry.candidate;
+    return true;
+}
+
+
+void CandidatePool::store( unsigned long srcid, Scan::ScanType type, std::vector<PointingVector> pointingVectors,
+                           const boost::optional<Scan> &candidate ) {
+    if ( srcid >= entries_.size() ) {
+        return;
+    }
+
+    Entry &entry = entries_[srcid];
+    entry.initialized = true;
+    entry.type = type;
+    entry.stationVersions.clear();
+    for ( const auto &pv : pointingVectors ) {
+        entry.stationVersions.push_back( stationVersions_[pv.getStaid()] );
+    }
+    entry.pointingVectors = std::move( pointingVectors );
+    entry.sourceVersion = sourceVersions_[srcid];
+    entry.candidate = candidate;
+}
+
+
+void CandidatePool::addStatistics( unsigned long nReused, unsigned long nRecomputed, long long int usecRecomputed ) {
+    nReused_ = nReused;
+    nRecomputed_ = nRecomputed;
+
+    usecPerCandidate_ += usecRecomputed;
+    nPerCandidate_ += nRecomputed;
+
+    // estimate saved time based on the average calculation time of all previously calculated candidates
+    if ( nPerCandidate_ > 0 ) {
+        usecSaved_ = static_cast<double>( usecPerCandidate_ ) / nPerCandidate_ * nReused_;
+    } else {
+        usecSaved_ = 0;
+    }
+    totalUsecSaved_ += usecSaved_;
+}
+
+
+void CandidatePool::output( std::ofstream &of ) const {
+    string msg = ( boost::format( "candidate pool: reused %d, recalculated %d scans (estimated time saved %.2f ms, "
+                                  "total %.2f ms)" ) %
+                   nReused_ % nRecomputed_ % ( usecSaved_ / 1000. ) % ( totalUsecSaved_ / 1000. ) )
+                     .str();
+    of << boost::format( "| %=140s |\n" ) % msg;
+}
+
+
+CandidatePool::StationState CandidatePool::stationState( const Station &station ) {
+    StationState state;
+    const PointingVector &pv = station.getCurrentPointingVector();
+    state.srcid = pv.getSrcid();
+    state.time = pv.getTime();
+    state.az = pv.getAz();
+    state.el = pv.getEl();
+    state.nTotalScans = station.getNTotalScans();
+    state.totalObsTime = station.getTotalObservingTime();
+    state.available = station.getPARA().available;
+    state.tagalong = station.getPARA().tagalong;
+    state.firstScan = station.getPARA().firstScan;
+    return state;
+}
+
+
+CandidatePool::SourceState CandidatePool::sourceState( const AbstractSource &source ) {
+    SourceState state;
+    state.nTotalScans = source.getNTotalScans();
+    state.lastScan = source.lastScanTime();
+    state.available = source.getPARA().available && source.getPARA().globalAvailable;
+    return state;
+}
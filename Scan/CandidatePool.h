@@ -0,0 +1,268 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CandidatePool.h
+ * @brief class CandidatePool
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+
+#ifndef CANDIDATEPOOL_H
+#define CANDIDATEPOOL_H
+
+
+#include <boost/format.hpp>
+#include <boost/optional.hpp>
+#include <fstream>
+#include <vector>
+
+#include "../ObservingMode/Mode.h"
+#include "../Source/SourceList.h"
+#include "../Station/Network.h"
+#include "Scan.h"
+
+
+namespace VieVS {
+
+/**
+ * @class CandidatePool
+ * @brief pool of candidate scans which is carried over between consecutive scan selections
+ *
+ * Every candidate scan is stored together with the pointing vectors of the visible scan it was derived from and the
+ * state versions of these stations and of the source. A station or source version is increased whenever its state
+ * changes (new pointing vector, number of scans, availability, parameter events). A stored candidate is only reused
+ * if the newly created visible scan has the same pointing vectors (station, time, azimuth and elevation) and neither
+ * these stations nor the source changed since the candidate was calculated. Otherwise start times, observations and
+ * scan durations are calculated again.
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+class CandidatePool : public VieVS_Object {
+   public:
+    /**
+     * @brief empty default constructor
+     * @author Matthias Schartner
+     */
+    CandidatePool();
+
+
+    /**
+     * @brief remove all stored candidates and initialize state for a new schedule
+     * @author Matthias Schartner
+     *
+     * @param nsta number of stations
+     * @param nsrc number of sources
+     */
+    void reset( unsigned long nsta, unsigned long nsrc );
+
+
+    /**
+     * @brief remove all stored candidates
+     * @author Matthias Schartner
+     */
+    void clear();
+
+
+    /**
+     * @brief compare current station and source state with the state of the previous scan selection
+     * @author Matthias Schartner
+     *
+     * @param network station network
+     * @param sourceList list of all sources
+     * @param mode observing mode
+     */
+    void checkForChanges( const Network &network, const SourceList &sourceList,
+                          const std::shared_ptr<const Mode> &mode );
+
+
+    /**
+     * @brief invalidate all candidates including this station (e.g. due to a parameter change)
+     * @author Matthias Schartner
+     *
+     * @param staid station id
+     */
+    void invalidateStation( unsigned long staid );
+
+
+    /**
+     * @brief invalidate candidate of this source (e.g. due to a parameter change)
+     * @author Matthias Schartner
+     *
+     * @param srcid source id
+     */
+    void invalidateSource( unsigned long srcid );
+
+
+    /**
+     * @brief look for a reusable candidate
+     * @author Matthias Schartner
+     *
+     * @param visibleScan newly created visible scan
+     * @param candidate stored candidate (boost::none if the candidate turned out to be invalid)
+     * @return true if a stored candidate can be reused
+     */
+    bool lookup( const Scan &visibleScan, boost::optional<Scan> &candidate ) const;
+
+
+    /**
+     * @brief store a newly calculated candidate
+     * @author Matthias Schartner
+     *
+     * @param srcid source id
+     * @param type scan type
+     * @param pointingVectors pointing vectors of the visible scan from which the candidate was derived
+     * @param candidate calculated candidate (boost::none if invalid)
+     */
+    void store( unsigned long srcid, Scan::ScanType type, std::vector<PointingVector> pointingVectors,
+                const boost::optional<Scan> &candidate );
+
+
+    /**
+     * @brief save statistics of the current scan selection
+     * @author Matthias Schartner
+     *
+     * @param nReused number of reused candidates
+     * @param nRecomputed number of recalculated candidates
+     * @param usecRecomputed time spent to recalculate candidates in microseconds
+     */
+    void addStatistics( unsigned long nReused, unsigned long nRecomputed, long long int usecRecomputed );
+
+
+    /**
+     * @brief write statistics of the last scan selection to iteration log
+     * @author Matthias Schartner
+     *
+     * @param of outstream to log file
+     */
+    void output( std::ofstream &of ) const;
+
+
+    /**
+     * @brief getter for estimated total time saved in microseconds
+     * @author Matthias Schartner
+     *
+     * @return estimated total time saved in microseconds
+     */
+    double getTotalTimeSaved() const noexcept { return totalUsecSaved_; }
+
+   private:
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
+
+    /**
+     * @brief state of a station relevant for candidate calculation
+     * @author Matthias Schartner
+     */
+    struct StationState {
+        unsigned long srcid = 0;        ///< current source id
+        unsigned int time = 0;          ///< current time
+        double az = 0;                  ///< current azimuth
+        double el = 0;                  ///< current elevation
+        int nTotalScans = 0;            ///< number of scans
+        unsigned int totalObsTime = 0;  ///< total observing time
+        bool available = false;         ///< available flag
+        bool tagalong = false;          ///< tagalong flag
+        bool firstScan = false;         ///< first scan flag
+
+        /**
+         * @brief compare two station states
+         * @author Matthias Schartner
+         *
+         * @param other other station state
+         * @return true if states are equal
+         */
+        bool operator==( const StationState &other ) const noexcept {
+            return srcid == other.srcid && time == other.time && az == other.az && el == other.el &&
+                   nTotalScans == other.nTotalScans && totalObsTime == other.totalObsTime &&
+                   available == other.available && tagalong == other.tagalong && firstScan == other.firstScan;
+        }
+    };
+
+    /**
+     * @brief state of a source relevant for candidate calculation
+     * @author Matthias Schartner
+     */
+    struct SourceState {
+        unsigned int nTotalScans = 0;  ///< number of scans
+        unsigned int lastScan = 0;     ///< time of last scan
+        bool available = false;        ///< available flag
+
+        /**
+         * @brief compare two source states
+         * @author Matthias Schartner
+         *
+         * @param other other source state
+         * @return true if states are equal
+         */
+        bool operator==( const SourceState &other ) const noexcept {
+            return nTotalScans == other.nTotalScans && lastScan == other.lastScan && available == other.available;
+        }
+    };
+
+    /**
+     * @brief stored candidate
+     * @author Matthias Schartner
+     */
+    struct Entry {
+        bool initialized = false;                        ///< flag if entry is initialized
+        Scan::ScanType type = Scan::ScanType::standard;  ///< scan type
+        std::vector<PointingVector> pointingVectors;     ///< pointing vectors of visible scan
+        std::vector<unsigned long> stationVersions;      ///< versions of these stations
+        unsigned long sourceVersion = 0;                 ///< version of source
+        boost::optional<Scan> candidate;                 ///< candidate scan
+    };
+
+    std::vector<StationState> stationStates_;     ///< station state of previous scan selection
+    std::vector<unsigned long> stationVersions_;  ///< current station versions
+    std::vector<SourceState> sourceStates_;       ///< source state of previous scan selection
+    std::vector<unsigned long> sourceVersions_;   ///< current source versions
+    std::vector<Entry> entries_;                  ///< stored candidate per source
+    std::shared_ptr<const Mode> mode_ = nullptr;  ///< observing mode used to calculate candidates
+
+    unsigned long nReused_ = 0;           ///< number of reused candidates during last scan selection
+    unsigned long nRecomputed_ = 0;       ///< number of recalculated candidates during last scan selection
+    double usecSaved_ = 0;                ///< estimated time saved during last scan selection
+    double totalUsecSaved_ = 0;           ///< estimated total time saved
+    long long int usecPerCandidate_ = 0;  ///< total time spent to calculate candidates
+    unsigned long nPerCandidate_ = 0;     ///< total number of calculated candidates
+
+
+    /**
+     * @brief current state of a station
+     * @author Matthias Schartner
+     *
+     * @param station station
+     * @return station state
+     */
+    static StationState stationState( const Station &station );
+
+
+    /**
+     * @brief current state of a source
+     * @author Matthias Schartner
+     *
+     * @param source source
+     * @return source state
+     */
+    static SourceState sourceState( const AbstractSource &source );
+};
+}  // namespace VieVS
+
+#endif  // CANDIDATEPOOL_H
@@ -22,7 +22,7 @@
 using namespace VieVS;
 using namespace std;
 
-unsigned long VieVS::Observation::nextId = 0;
+std::atomic<unsigned long> VieVS::Observation::nextId{ 0 };
 
 
 Observation::Observation( unsigned long blid, unsigned long staid1, unsigned long staid2, unsigned long srcid,
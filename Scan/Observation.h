@@ -28,6 +28,8 @@
 #define OBSERVATION_H
 
 
+#include <atomic>
+
 #include "../Misc/VieVS_Object.h"
 
 
@@ -156,6 +158,13 @@ class Observation : public VieVS_Object {
      */
     static unsigned long numberOfCreatedObjects() { return nextId; }
 
+
+    /**
+     * @brief set new id
+     * @author Matthias Schartner
+     */
+    void giveNewId() { setId( nextId++ ); }
+
     /**
      * @brief add noise to observed minus computed
      * @author Matthias Schartner
@@ -165,7 +174,7 @@ class Observation : public VieVS_Object {
     void addNoise( double noise ) { o_c += noise; }
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     unsigned long blid_;    ///< baseline id
     unsigned long staid1_;  ///< first station id
@@ -28,7 +28,7 @@
 
 using namespace std;
 using namespace VieVS;
-unsigned long PointingVector::nextId = 0;
+std::atomic<unsigned long> PointingVector::nextId{ 0 };
 
 // PointingVector::PointingVector():VieVS_Object(nextId++), staid_{-1}, srcid_{-1}{
 //}
@@ -28,6 +28,7 @@
 #define VLBI_POINTINGVECTOR_H
 
 
+#include <atomic>
 #include <boost/date_time.hpp>
 #include <iostream>
 #include <limits>
@@ -237,8 +238,15 @@ class PointingVector : public VieVS_Object {
     static unsigned long numberOfCreatedObjects() { return nextId - 1; }
 
 
+    /**
+     * @brief set new id
+     * @author Matthias Schartner
+     */
+    void giveNewId() { setId( nextId++ ); }
+
+
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     unsigned long staid_;  ///< station id
     unsigned long srcid_;  ///< source id
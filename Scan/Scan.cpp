@@ -29,15 +29,12 @@
 using namespace std;
 using namespace VieVS;
 
-unsigned int Scan::nScanSelections{ 0 };
-
-bool Scan::scanSequence_flag = false;                     ///< true if you have a custom scan sequence
-unsigned int Scan::scanSequence_cadence = 0;              ///< scanSequence_cadence of source sequence rule
-thread_local unsigned int Scan::scanSequence_modulo = 0;  ///< modulo of scan selection scanSequence_cadence
+bool Scan::scanSequence_flag = false;         ///< true if you have a custom scan sequence
+unsigned int Scan::scanSequence_cadence = 0;  ///< scanSequence_cadence of source sequence rule
 std::map<unsigned int, std::vector<unsigned long>>
     Scan::scanSequence_target;  ///< map with modulo number as key and list of target source ids as value
 
-unsigned long Scan::nextId = 0;
+std::atomic<unsigned long> Scan::nextId{ 0 };
 
 
 Scan::Scan( vector<PointingVector> &pointingVectors, vector<unsigned int> &endOfLastScan, ScanType type )
@@ -184,9 +181,7 @@ bool Scan::constructObservations( const Network &network,
                 { times_.getObservingTime( i, Timestamp::start ), times_.getObservingTime( j, Timestamp::start ) } );
 
             if ( source->checkJetAngle() ) {
-                double date1 = 2400000.5;
-                double date2 = TimeSystem::mjdStart + static_cast<double>( startTime ) / 86400.0;
-                double gmst = iauGmst82( date1, date2 );
+                double gmst = TimeSystem::internalTime2gmst82( startTime );
                 if ( !source->jet_angle_valid(startTime, gmst, network.getDxyz( staid1, staid2 ) ) ){
                     continue;
                 }
@@ -410,6 +405,57 @@ vector<double> Scan::getSNRs( const Network &network, const std::shared_ptr<cons
 }
 
 
+void Scan::observedFlux( const Network &network, const std::shared_ptr<const AbstractSource> &source,
+                         const std::shared_ptr<const Mode> &mode, const Observation *obs, unsigned long n,
+                         std::vector<double> &flux ) {
+    const vector<unsigned long> &bandIds = mode->getAllBandIds();
+    flux.resize( bandIds.size() * n );
+
+    // projected baselines are only calculated once per observation if needed
+    static thread_local vector<double> u;
+    static thread_local vector<double> v;
+    bool uvCalculated = false;
+    auto calcUV = [&]() {
+        if ( uvCalculated ) {
+            return;
+        }
+        u.resize( n );
+        v.resize( n );
+        for ( unsigned long i = 0; i < n; ++i ) {
+            unsigned long staid1 = obs[i].getStaid1();
+            unsigned long staid2 = obs[i].getStaid2();
+            unsigned int startTime = obs[i].getStartTime();
+            double gmst = TimeSystem::internalTime2gmst82( startTime );
+            tie( u[i], v[i] ) = source->calcUV( startTime, gmst, network.getDxyz( staid1, staid2 ) );
+        }
+        uvCalculated = true;
+    };
+
+    for ( unsigned long iband = 0; iband < bandIds.size(); ++iband ) {
+        unsigned long bandId = bandIds[iband];
+        double *thisFlux = flux.data() + iband * n;
+        if ( source->hasFluxInformation( bandId ) ) {
+            // calculate observed flux density for each band
+            calcUV();
+            source->observedFlux( bandId, n, u.data(), v.data(), thisFlux );
+        } else if ( ObservingMode::sourceBackupPerBand[bandId] == ObservingMode::Backup::internalModel ) {
+            // calculate observed flux density based on model
+            calcUV();
+            double wavelength = ObservingMode::wavelengthPerBand[bandId];
+            source->observedFlux_model( wavelength, n, u.data(), v.data(), thisFlux );
+        } else {
+            fill( thisFlux, thisFlux + n, 1e-3 );
+        }
+
+        for ( unsigned long i = 0; i < n; ++i ) {
+            if ( thisFlux[i] == 0 ) {
+                thisFlux[i] = 1e-3;
+            }
+        }
+    }
+}
+
+
 unordered_map<string, double> Scan::calcSNR( const Network &network,
                                              const std::shared_ptr<const AbstractSource> &source,
                                              const std::shared_ptr<const Mode> &mode,
@@ -424,42 +470,30 @@ unordered_map<string, double> Scan::calcSNR( const Network &network,
     const Baseline &bl = network.getBaseline( staid1, staid2 );
     unsigned int duration = thisObservation.getObservingTime();
 
-    // get baseline scan start time
-    unsigned int startTime = thisObservation.getStartTime();
+    // indices of both stations and recording rates of this baseline
+    unsigned long idx1 = *findIdxOfStationId( staid1 );
+    unsigned long idx2 = *findIdxOfStationId( staid2 );
+    const vector<double> &recordingRates = mode->recordingRates( staid1, staid2 );
 
-    // calculate greenwhich meridian sedirial time
-    double date1 = 2400000.5;
-    double date2 = TimeSystem::mjdStart + static_cast<double>( startTime ) / 86400.0;
-    double gmst = iauGmst82( date1, date2 );
+    // observed flux density per band
+    static thread_local vector<double> flux;
+    observedFlux( network, source, mode, &thisObservation, 1, flux );
 
     // loop over each band
-    bool flag_observationRemoved = false;
-    for ( auto &band : mode->getAllBands() ) {
-        double SEFD_src;
-        if ( source->hasFluxInformation( band ) ) {
-            // calculate observed flux density for each band
-            SEFD_src = source->observedFlux( band, startTime, gmst, network.getDxyz( staid1, staid2 ) );
-        } else if ( ObservingMode::sourceBackup[band] == ObservingMode::Backup::internalModel ) {
-            // calculate observed flux density based on model
-            double wavelength = ObservingMode::wavelengths[band];
-            SEFD_src = source->observedFlux_model( wavelength, startTime, gmst, network.getDxyz( staid1, staid2 ) );
-        } else {
-            SEFD_src = 1e-3;
-        }
-
-
-        if ( SEFD_src == 0 ) {
-            SEFD_src = 1e-3;
-        }
+    const vector<unsigned long> &bandIds = mode->getAllBandIds();
+    for ( unsigned long iband = 0; iband < bandIds.size(); ++iband ) {
+        unsigned long bandId = bandIds[iband];
+        const string &band = BandRegistry::getName( bandId );
+        double SEFD_src = flux[iband];
 
         // calculate system equivalent flux density for each station
-        double el1 = pointingVectorsStart_[*findIdxOfStationId( staid1 )].getEl();
-        double SEFD_sta1 = sta1.getEquip().getSEFD( band, el1 );
-        double el2 = pointingVectorsStart_[*findIdxOfStationId( staid2 )].getEl();
-        double SEFD_sta2 = sta2.getEquip().getSEFD( band, el2 );
+        double el1 = pointingVectorsStart_[idx1].getEl();
+        double SEFD_sta1 = sta1.getSEFD( bandId, el1 );
+        double el2 = pointingVectorsStart_[idx2].getEl();
+        double SEFD_sta2 = sta2.getSEFD( bandId, el2 );
 
         double efficiency = mode->efficiency( sta1.getId(), sta2.getId() );
-        double rec = mode->recordingRate( staid1, staid2, band );
+        double rec = bandId < recordingRates.size() ? recordingRates[bandId] : 0;
         double SNR = efficiency * SEFD_src / sqrt( SEFD_sta1 * SEFD_sta2 ) * sqrt( rec * duration );
         band2snr[band] = SNR;
     }
@@ -498,8 +532,16 @@ bool Scan::calcObservationDuration( const Network &network, const std::shared_pt
         return true;
     }
 
+    // observed flux density of all observations per band
+    static thread_local vector<double> flux;
+    unsigned long nobs = observations_.size();
+    observedFlux( network, source, mode, observations_.data(), nobs, flux );
+    const vector<unsigned long> &bandIds = mode->getAllBandIds();
+
     // loop over all observed baselines
     int idxObs = 0;
+    // index of observation before any observation got removed
+    unsigned long iobs = 0;
     while ( idxObs < observations_.size() ) {
         auto &thisObservation = observations_[idxObs];
 
@@ -510,47 +552,30 @@ bool Scan::calcObservationDuration( const Network &network, const std::shared_pt
         const Station &sta2 = network.getStation( staid2 );
         const Baseline &bl = network.getBaseline( staid1, staid2 );
 
-        // get baseline scan start time
-        unsigned int startTime = thisObservation.getStartTime();
-
-        // calculate greenwhich meridian sedirial time
-        double date1 = 2400000.5;
-        double date2 = TimeSystem::mjdStart + static_cast<double>( startTime ) / 86400.0;
-        double gmst = iauGmst82( date1, date2 );
-
         unsigned int maxDuration = 0;
 
+        // indices of both stations and recording rates of this baseline
+        unsigned long idx1 = *findIdxOfStationId( staid1 );
+        unsigned long idx2 = *findIdxOfStationId( staid2 );
+        const vector<double> &recordingRates = mode->recordingRates( staid1, staid2 );
+
         // loop over each band
         bool flag_observationRemoved = false;
-        for ( auto &band : mode->getAllBands() ) {
-            double SEFD_src;
-            if ( source->hasFluxInformation( band ) ) {
-                // calculate observed flux density for each band
-                SEFD_src = source->observedFlux( band, startTime, gmst, network.getDxyz( staid1, staid2 ) );
-            } else if ( ObservingMode::sourceBackup[band] == ObservingMode::Backup::internalModel ) {
-                // calculate observed flux density based on model
-                double wavelength = ObservingMode::wavelengths[band];
-                SEFD_src = source->observedFlux_model( wavelength, startTime, gmst, network.getDxyz( staid1, staid2 ) );
-            } else {
-                SEFD_src = 1e-3;
-            }
-
-
-            if ( SEFD_src == 0 ) {
-                SEFD_src = 1e-3;
-            }
+        for ( unsigned long iband = 0; iband < bandIds.size(); ++iband ) {
+            unsigned long bandId = bandIds[iband];
+            double SEFD_src = flux[iband * nobs + iobs];
 
             // calculate system equivalent flux density for each station
-            double el1 = pointingVectorsStart_[*findIdxOfStationId( staid1 )].getEl();
-            double SEFD_sta1 = sta1.getEquip().getSEFD( band, el1 );
-            double el2 = pointingVectorsStart_[*findIdxOfStationId( staid2 )].getEl();
-            double SEFD_sta2 = sta2.getEquip().getSEFD( band, el2 );
+            double el1 = pointingVectorsStart_[idx1].getEl();
+            double SEFD_sta1 = sta1.getSEFD( bandId, el1 );
+            double el2 = pointingVectorsStart_[idx2].getEl();
+            double SEFD_sta2 = sta2.getSEFD( bandId, el2 );
 
             // get minimum required SNR for each station, baseline and source
-            double minSNR_sta1 = sta1.getPARA().minSNR.at( band );
-            double minSNR_sta2 = sta2.getPARA().minSNR.at( band );
-            double minSNR_bl = bl.getParameters().minSNR.at( band );
-            double minSNR_src = source->getPARA().minSNR.at( band );
+            double minSNR_sta1 = sta1.getPARA().getMinSNR( bandId );
+            double minSNR_sta2 = sta2.getPARA().getMinSNR( bandId );
+            double minSNR_bl = bl.getParameters().getMinSNR( bandId );
+            double minSNR_src = source->getPARA().getMinSNR( bandId );
 
             // maximum required minSNR
             double maxminSNR = max( { minSNR_src, minSNR_bl, minSNR_sta1, minSNR_sta2 } );
@@ -564,7 +589,7 @@ bool Scan::calcObservationDuration( const Network &network, const std::shared_pt
             double efficiency = mode->efficiency( sta1.getId(), sta2.getId() );
             double anum = ( maxminSNR / ( SEFD_src * efficiency ) );
             double anu1 = SEFD_sta1 * SEFD_sta2;
-            double anu2 = mode->recordingRate( staid1, staid2, band );
+            double anu2 = bandId < recordingRates.size() ? recordingRates[bandId] : 0;
             if ( anu2 == 0 ) {
                 return false;
             }
@@ -598,6 +623,7 @@ bool Scan::calcObservationDuration( const Network &network, const std::shared_pt
             ++idxObs;
             thisObservation.setObservingTime( maxDuration );
         }
+        ++iobs;
     }
 
     if ( source->getPARA().forceSameObservingDuration ) {
@@ -805,10 +831,11 @@ double Scan::calcScore_idleTime( const std::vector<double> &idleScore ) const no
     return score;
 }
 
-double Scan::calcScore_closures( unsigned long nclosures_max, const std::shared_ptr<const AbstractSource> &source) const noexcept{
+double Scan::calcScore_closures( unsigned long nclosures_max, const std::shared_ptr<const AbstractSource> &source,
+                                 const WeightFactors &weightFactors ) const noexcept{
     double score = 0;
     unsigned long nClosures = source->getNClosures();
-    if (nClosures >= WeightFactors::maxClosures){
+    if (nClosures >= weightFactors.maxClosures){
         return score;
     }
 
@@ -872,18 +899,18 @@ double Scan::calcScore_duration( unsigned long nMaxSta, unsigned int minTime, un
 }
 
 
-double Scan::calcScore_lowElevation( unsigned long nmaxsta ) {
+double Scan::calcScore_lowElevation( unsigned long nmaxsta, const WeightFactors &weightFactors ) {
     double score = 0;
     for ( const auto &pv : pointingVectorsStart_ ) {
         double el = pv.getEl();
         double f = 0;
-        if ( el > WeightFactors::lowElevationStartWeight ) {
+        if ( el > weightFactors.lowElevationStartWeight ) {
             f = 0;
-        } else if ( el < WeightFactors::lowElevationFullWeight ) {
+        } else if ( el < weightFactors.lowElevationFullWeight ) {
             f = 1;
         } else {
-            f = ( el - WeightFactors::lowElevationStartWeight ) /
-                ( WeightFactors::lowElevationFullWeight - WeightFactors::lowElevationStartWeight );
+            f = ( el - weightFactors.lowElevationStartWeight ) /
+                ( weightFactors.lowElevationFullWeight - weightFactors.lowElevationStartWeight );
         }
         score += f;
     }
@@ -891,16 +918,16 @@ double Scan::calcScore_lowElevation( unsigned long nmaxsta ) {
 }
 
 
-double Scan::calcScore_lowDeclination( unsigned long nMaxObs ) {
+double Scan::calcScore_lowDeclination( unsigned long nMaxObs, const WeightFactors &weightFactors ) {
     double dec = pointingVectorsStart_[0].getDc();
     double score = 0;
-    if ( dec > WeightFactors::declinationStartWeight ) {
+    if ( dec > weightFactors.declinationStartWeight ) {
         score = 0;
-    } else if ( dec < WeightFactors::declinationFullWeight ) {
+    } else if ( dec < weightFactors.declinationFullWeight ) {
         score = 1;
     } else {
-        score = ( dec - WeightFactors::declinationStartWeight ) /
-                ( WeightFactors::declinationFullWeight - WeightFactors::declinationStartWeight );
+        score = ( dec - weightFactors.declinationStartWeight ) /
+                ( weightFactors.declinationFullWeight - weightFactors.declinationStartWeight );
     }
     return score * static_cast<double>( observations_.size() ) / static_cast<double>( nMaxObs );
 }
@@ -1279,21 +1306,20 @@ bool Scan::rigorousSatelliteAvoidance( Network &network, const std::shared_ptr<c
         Station &sta = network.refStation( staid );
         for ( auto tt : times ) {
             pair<double, double> rade_src = source->getRaDe( tt, sta.getPosition() );
-            for ( const auto &sat : AvoidSatellites::satellitesToAvoid ) {
-                const vector<pair<int, int>> &precalc = AvoidSatellites::visible_[staid][sat->getId()];
-                bool calc = false;
-                for ( const auto &any : precalc ) {
-                    unsigned int start = any.first;
-                    unsigned int end = any.second;
-                    if ( tt >= start && tt <= end ) {
-                        calc = true;
-                        break;
-                    }
+            double x = cos( rade_src.second ) * cos( rade_src.first );
+            double y = cos( rade_src.second ) * sin( rade_src.first );
+            double z = sin( rade_src.second );
+
+            auto candidates = AvoidSatellites::candidates( staid, tt );
+            for ( const auto *any = candidates.first; any != candidates.second; ++any ) {
+                if ( tt < any->start || tt > any->end ) {
+                    continue;
                 }
-                if ( !calc ) {
+                if ( x * any->x + y * any->y + z * any->z < any->cosRadius ) {
                     continue;
                 }
 
+                const auto &sat = AvoidSatellites::satellitesToAvoid[any->satIdx];
                 auto rade_sat = sat->calcRaDeDistTime( tt, sta.getPosition() );
                 double tmp =
                     sin( rade_src.second ) * sin( get<1>( rade_sat ) ) +
@@ -1565,48 +1591,49 @@ void Scan::addTagalongStation( const PointingVector &pv_start, const PointingVec
 double Scan::calcScore_firstPart( const std::vector<double> &astas, const std::vector<double> &asrcs,
                                   const std::vector<double> &abls, unsigned int minTime, unsigned int maxTime,
                                   const Network &network, const std::shared_ptr<const AbstractSource> &source,
-                                  bool subnetting, const std::vector<double> &idleScore ) {
+                                  bool subnetting, const std::vector<double> &idleScore,
+                                  const WeightFactors &weightFactors ) {
     unsigned long nmaxsta = network.getNSta();
     unsigned long nmaxbl = network.getNBls();
     double this_score = 0;
 
-    double weight_numberOfObservations = WeightFactors::weightNumberOfObservations;
+    double weight_numberOfObservations = weightFactors.weightNumberOfObservations;
     if ( weight_numberOfObservations != 0 ) {
         this_score += calcScore_numberOfObservations( nmaxbl ) * weight_numberOfObservations;
     }
-    double weight_averageSources = WeightFactors::weightAverageSources;
+    double weight_averageSources = weightFactors.weightAverageSources;
     if ( weight_averageSources != 0 && !asrcs.empty() ) {
         this_score += calcScore_averageSources( asrcs, nmaxbl ) * weight_averageSources;
     }
-    double weight_averageStations = WeightFactors::weightAverageStations;
+    double weight_averageStations = weightFactors.weightAverageStations;
     if ( weight_averageStations != 0 && !astas.empty() ) {
         this_score += calcScore_averageStations( astas, nmaxsta ) * weight_averageStations;
     }
-    double weight_averageBaselines = WeightFactors::weightAverageBaselines;
+    double weight_averageBaselines = weightFactors.weightAverageBaselines;
     if ( weight_averageBaselines != 0 && !abls.empty() ) {
         this_score += calcScore_averageBaselines( abls ) * weight_averageBaselines;
     }
-    double weight_duration = WeightFactors::weightDuration;
+    double weight_duration = weightFactors.weightDuration;
     if ( weight_duration != 0 ) {
         this_score += calcScore_duration( nmaxsta, minTime, maxTime ) * weight_duration;
     }
-    double weight_idle = WeightFactors::weightIdleTime;
+    double weight_idle = weightFactors.weightIdleTime;
     if ( weight_idle != 0 ) {
         this_score += calcScore_idleTime( idleScore ) * weight_idle;
     }
-    double weight_closures = WeightFactors::weightClosures;
+    double weight_closures = weightFactors.weightClosures;
     if ( weight_closures != 0 ) {
-        this_score += calcScore_closures( network.getNClosures_max(), source ) * weight_closures;
+        this_score += calcScore_closures( network.getNClosures_max(), source, weightFactors ) * weight_closures;
     }
 
-    double weightDeclination = WeightFactors::weightDeclination;
+    double weightDeclination = weightFactors.weightDeclination;
     if ( weightDeclination != 0 ) {
-        this_score += calcScore_lowDeclination( nmaxbl ) * weightDeclination;
+        this_score += calcScore_lowDeclination( nmaxbl, weightFactors ) * weightDeclination;
     }
 
-    double weightLowElevation = WeightFactors::weightLowElevation;
+    double weightLowElevation = weightFactors.weightLowElevation;
     if ( weightLowElevation != 0 ) {
-        this_score += calcScore_lowElevation( nmaxsta ) * weightLowElevation;
+        this_score += calcScore_lowElevation( nmaxsta, weightFactors ) * weightLowElevation;
     }
 
     return this_score;
@@ -1614,7 +1641,8 @@ double Scan::calcScore_firstPart( const std::vector<double> &astas, const std::v
 
 
 double Scan::calcScore_secondPart( double this_score, const Network &network,
-                                   const std::shared_ptr<const AbstractSource> &source, bool ignoreScanSequence ) {
+                                   const std::shared_ptr<const AbstractSource> &source,
+                                   const SchedulingContext *context ) {
     if ( source->getPARA().tryToFocusIfObservedOnce ) {
         unsigned int nscans = source->getNscans();
         if ( nscans > 0 ) {
@@ -1641,10 +1669,10 @@ double Scan::calcScore_secondPart( double this_score, const Network &network,
 //        this_score *= .1;
 //    }
 
-    if ( !ignoreScanSequence ) {
+    if ( context != nullptr ) {
         if ( scanSequence_flag && type_ == ScanType::standard ) {
-            if ( scanSequence_target.find( scanSequence_modulo ) != scanSequence_target.end() ) {
-                const vector<unsigned long> &target = scanSequence_target[scanSequence_modulo];
+            if ( scanSequence_target.find( context->scanSequenceModulo ) != scanSequence_target.end() ) {
+                const vector<unsigned long> &target = scanSequence_target[context->scanSequenceModulo];
                 if ( find( target.begin(), target.end(), source->getId() ) != target.end() ) {
                     this_score *= 1e8;
                 } else {
@@ -1677,16 +1705,17 @@ double Scan::calcScore_secondPart( double this_score, const Network &network,
 void Scan::calcScore( const std::vector<double> &astas, const std::vector<double> &asrcs,
                       const std::vector<double> &abls, unsigned int minTime, unsigned int maxTime,
                       const Network &network, const std::shared_ptr<const AbstractSource> &source, bool subnetting,
-                      const std::vector<double> &idleScore ) noexcept {
+                      const std::vector<double> &idleScore, const SchedulingContext &context ) noexcept {
     double this_score =
-        calcScore_firstPart( astas, asrcs, abls, minTime, maxTime, network, source, subnetting, idleScore );
+        calcScore_firstPart( astas, asrcs, abls, minTime, maxTime, network, source, subnetting, idleScore,
+                             context.weightFactors );
 
-    double weight_skyCoverage = WeightFactors::weightSkyCoverage;
+    double weight_skyCoverage = context.weightFactors.weightSkyCoverage;
     if ( weight_skyCoverage != 0 ) {
         this_score += network.calcScore_skyCoverage( pointingVectorsStart_ ) * weight_skyCoverage;
     }
 
-    score_ = calcScore_secondPart( this_score, network, source );
+    score_ = calcScore_secondPart( this_score, network, source, &context );
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logTrace ) BOOST_LOG_TRIVIAL( trace ) << "scan " << this->printId() << " score " << score_;
 #endif
@@ -1697,16 +1726,26 @@ void Scan::calcScore( const std::vector<double> &astas, const std::vector<double
                       const std::vector<double> &abls, unsigned int minTime, unsigned int maxTime,
                       const Network &network, const std::shared_ptr<const AbstractSource> &source,
                       unordered_map<unsigned long, double> &staids2skyCoverageScore,
-                      const std::vector<double> &idleScore ) noexcept {
-    double this_score = calcScore_firstPart( astas, asrcs, abls, minTime, maxTime, network, source, false, idleScore );
+                      const std::vector<double> &idleScore, const SchedulingContext &context ) noexcept {
+    double this_score = calcScore_firstPart( astas, asrcs, abls, minTime, maxTime, network, source, false, idleScore,
+                                             context.weightFactors );
+    calcScore( this_score, network, source, staids2skyCoverageScore, context );
+}
 
-    double weight_skyCoverage = WeightFactors::weightSkyCoverage;
+
+void Scan::calcScore( double firstPartScore, const Network &network,
+                      const std::shared_ptr<const AbstractSource> &source,
+                      unordered_map<unsigned long, double> &staids2skyCoverageScore,
+                      const SchedulingContext &context ) noexcept {
+    double this_score = firstPartScore;
+
+    double weight_skyCoverage = context.weightFactors.weightSkyCoverage;
     if ( weight_skyCoverage != 0 ) {
         this_score +=
             network.calcScore_skyCoverage( pointingVectorsStart_, staids2skyCoverageScore ) * weight_skyCoverage;
     }
 
-    score_ = calcScore_secondPart( this_score, network, source );
+    score_ = calcScore_secondPart( this_score, network, source, &context );
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logTrace ) BOOST_LOG_TRIVIAL( trace ) << "scan " << this->printId() << " score " << score_;
 #endif
@@ -1717,16 +1756,26 @@ void Scan::calcScore_subnetting( const std::vector<double> &astas, const std::ve
                                  const std::vector<double> &abls, unsigned int minTime, unsigned int maxTime,
                                  const Network &network, const std::shared_ptr<const AbstractSource> &source,
                                  const unordered_map<unsigned long, double> &staids2skyCoverageScore,
-                                 const std::vector<double> &idleScore ) noexcept {
-    double this_score = calcScore_firstPart( astas, asrcs, abls, minTime, maxTime, network, source, true, idleScore );
+                                 const std::vector<double> &idleScore, const SchedulingContext &context ) noexcept {
+    double this_score = calcScore_firstPart( astas, asrcs, abls, minTime, maxTime, network, source, true, idleScore,
+                                             context.weightFactors );
+    calcScore_subnetting( this_score, network, source, staids2skyCoverageScore, context );
+}
+
+
+void Scan::calcScore_subnetting( double firstPartScore, const Network &network,
+                                 const std::shared_ptr<const AbstractSource> &source,
+                                 const unordered_map<unsigned long, double> &staids2skyCoverageScore,
+                                 const SchedulingContext &context ) noexcept {
+    double this_score = firstPartScore;
 
-    double weight_skyCoverage = WeightFactors::weightSkyCoverage;
+    double weight_skyCoverage = context.weightFactors.weightSkyCoverage;
     if ( weight_skyCoverage != 0 ) {
         this_score += network.calcScore_skyCoverage_subnetting( pointingVectorsStart_, staids2skyCoverageScore ) *
                       weight_skyCoverage;
     }
 
-    score_ = calcScore_secondPart( this_score, network, source );
+    score_ = calcScore_secondPart( this_score, network, source, &context );
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logTrace ) BOOST_LOG_TRIVIAL( trace ) << "scan " << this->printId() << " score " << score_;
 #endif
@@ -1734,11 +1783,13 @@ void Scan::calcScore_subnetting( const std::vector<double> &astas, const std::ve
 
 
 void Scan::calcScore( unsigned int minTime, unsigned int maxTime, const Network &network,
-                      const std::shared_ptr<const AbstractSource> &source, double hiscore, bool subnetting ) {
+                      const std::shared_ptr<const AbstractSource> &source, double hiscore, bool subnetting,
+                      const SchedulingContext &context ) {
     double this_score = calcScore_firstPart( vector<double>(), vector<double>(), vector<double>(), minTime, maxTime,
-                                             network, source, subnetting, vector<double>( network.getNSta(), 0 ) );
+                                             network, source, subnetting, vector<double>( network.getNSta(), 0 ),
+                                             context.weightFactors );
 
-    score_ = calcScore_secondPart( this_score, network, source ) * hiscore;
+    score_ = calcScore_secondPart( this_score, network, source, &context ) * hiscore;
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logTrace ) BOOST_LOG_TRIVIAL( trace ) << "scan " << this->printId() << " score " << score_;
 #endif
@@ -1748,7 +1799,8 @@ void Scan::calcScore( unsigned int minTime, unsigned int maxTime, const Network
 bool Scan::calcScore( const std::vector<double> &prevLowElevationScores,
                       const std::vector<double> &prevHighElevationScores, const Network &network,
                       unsigned int minRequiredTime, unsigned int maxRequiredTime,
-                      const std::shared_ptr<const AbstractSource> &source, bool subnetting ) {
+                      const std::shared_ptr<const AbstractSource> &source, bool subnetting,
+                      const SchedulingContext &context ) {
     double lowElevationSlopeStart = AstrometricCalibratorBlock::lowElevationStartWeight;
     double lowElevationSlopeEnd = AstrometricCalibratorBlock::lowElevationFullWeight;
 
@@ -1804,7 +1856,7 @@ bool Scan::calcScore( const std::vector<double> &prevLowElevationScores,
         this_score =
             improvementLowElevation / nMaxSta + improvementHighElevation / nMaxSta + scoreDuration + scoreBaselines;
 
-        score_ = calcScore_secondPart( this_score, network, source );
+        score_ = calcScore_secondPart( this_score, network, source, &context );
 
 #ifdef VIESCHEDPP_LOG
         if ( Flags::logTrace ) BOOST_LOG_TRIVIAL( trace ) << "scan " << this->printId() << " score " << score_;
@@ -1836,7 +1888,7 @@ void Scan::calcScoreCalibrator( const Network &network, const std::shared_ptr<co
     //                 + CalibratorBlock::averageBaseline_offset;
 
     double this_score = meanSNR * ( scoreBaselines + asta + dur + abl );
-    score_ = calcScore_secondPart( this_score, network, source, true );
+    score_ = calcScore_secondPart( this_score, network, source );
 
     if ( !CalibratorBlock::tryToIncludeAllStationFlag && nsta_ < network.getNSta() * 0.7 ) {
         score_ *= 0.1;
@@ -1844,7 +1896,7 @@ void Scan::calcScoreCalibrator( const Network &network, const std::shared_ptr<co
 }
 
 void Scan::calcScoreDPar( const Network &network, const std::shared_ptr<const AbstractSource> &source,
-                          vector<double> meanSNRs ) {
+                          vector<double> meanSNRs, const SchedulingContext &context ) {
     auto parallacticAngle = []( const Station &sta, const shared_ptr<const AbstractSource> &src,
                                 const PointingVector &pv, unsigned int startTime ) {
         double ha = pv.getHa();
@@ -1854,7 +1906,7 @@ void Scan::calcScoreDPar( const Network &network, const std::shared_ptr<const Ab
         return p;
     };
 
-    double angle = DifferentialParallacticAngleBlock::angles[DifferentialParallacticAngleBlock::iScan];
+    double angle = DifferentialParallacticAngleBlock::angles[context.iDifferentialParallacticAngleScan];
     double thisScore = 0;
     int n = 0;
     for ( int iobs = 0; iobs < observations_.size(); ++iobs ) {
@@ -1887,7 +1939,7 @@ void Scan::calcScoreDPar( const Network &network, const std::shared_ptr<const Ab
     }
     thisScore /= n;
 
-    score_ = calcScore_secondPart( thisScore, network, source, true );
+    score_ = calcScore_secondPart( thisScore, network, source );
 }
 
 
@@ -1928,12 +1980,13 @@ void Scan::calcScorePar( const Network &network, const std::shared_ptr<const Abs
     double factor = pow( 0.5 + 0.5 * cos( pi + 2 * maxEl ), ParallacticAngleBlock::distanceScaling );
 
     double this_score = meanSNR * factor;
-    score_ = calcScore_secondPart( this_score, network, source, true );
+    score_ = calcScore_secondPart( this_score, network, source );
 }
 
 
 void Scan::output( unsigned long observed_scan_nr, const Network &network,
-                   const std::shared_ptr<const AbstractSource> &source, ofstream &of ) const noexcept {
+                   const std::shared_ptr<const AbstractSource> &source, ofstream &of,
+                   const SchedulingContext *context ) const noexcept {
     string type = toString( type_ );
     string type2 = toString( constellation_ );
 
@@ -1942,11 +1995,12 @@ void Scan::output( unsigned long observed_scan_nr, const Network &network,
                           TimeSystem::time2timeOfDay( times_.getObservingTime( Timestamp::end ) ) )
                             .str();
 
-    if ( scanSequence_flag && type_ == ScanType::standard ) {
-        if ( scanSequence_target.find( scanSequence_modulo ) != scanSequence_target.end() ) {
-            const vector<unsigned long> &target = scanSequence_target[scanSequence_modulo];
+    if ( context != nullptr && scanSequence_flag && type_ == ScanType::standard ) {
+        unsigned int modulo = context->scanSequenceModulo;
+        if ( scanSequence_target.find( modulo ) != scanSequence_target.end() ) {
+            const vector<unsigned long> &target = scanSequence_target[modulo];
             int n = target.size();
-            of << boost::format( "| custom scan sequence %d with %d target scans\n" ) % scanSequence_modulo % n;
+            of << boost::format( "| custom scan sequence %d with %d target scans\n" ) % modulo % n;
         }
     }
 
@@ -2178,6 +2232,21 @@ unsigned long Scan::getNObs( unsigned long staid ) const noexcept {
 }
 
 
+void Scan::giveNewIds() {
+    setId( nextId++ );
+    times_.giveNewId();
+    for ( auto &obs : observations_ ) {
+        obs.giveNewId();
+    }
+    for ( auto &pv : pointingVectorsStart_ ) {
+        pv.giveNewId();
+    }
+    for ( auto &pv : pointingVectorsEnd_ ) {
+        pv.giveNewId();
+    }
+}
+
+
 void Scan::setPointingVector( int idx, PointingVector pv, Timestamp ts ) {
     times_.setObservingTime( idx, pv.getTime(), ts );
     switch ( ts ) {
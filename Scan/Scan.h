@@ -28,6 +28,7 @@
 #define SCAN_H
 
 
+#include <atomic>
 #include <boost/date_time.hpp>
 #include <boost/format.hpp>
 #include <boost/optional.hpp>
@@ -41,6 +42,7 @@
 #include "../Misc/CalibratorBlock.h"
 #include "../Misc/DifferentialParallacticAngleBlock.h"
 #include "../Misc/ParallacticAngleBlock.h"
+#include "../Misc/SchedulingContext.h"
 #include "../Misc/StationEndposition.h"
 #include "../Misc/TimeSystem.h"
 #include "../Misc/WeightFactors.h"
@@ -64,8 +66,6 @@ namespace VieVS {
  */
 class Scan : public VieVS_Object {
    public:
-    static unsigned int nScanSelections;  ///< number of selected main scans
-
     /**
      * @brief scan constellation type
      * @author Matthias Schartner
@@ -138,21 +138,22 @@ class Scan : public VieVS_Object {
      * @brief specify custom scan sequence rules
      * @author Matthias Schartner
      */
-    static bool scanSequence_flag;                         ///< true if you have a custom scan sequence
-    static unsigned int scanSequence_cadence;              ///< scanSequence_cadence of source sequence rule
-    static thread_local unsigned int scanSequence_modulo;  ///< modulo of scan selection scanSequence_cadence
+    static bool scanSequence_flag;             ///< true if you have a custom scan sequence
+    static unsigned int scanSequence_cadence;  ///< scanSequence_cadence of source sequence rule
     static std::map<unsigned int, std::vector<unsigned long>>
         scanSequence_target;  ///< map with modulo number as key and list of target source ids as value
 
     /**
      * @brief increases the modulo value for this ScanSequence
      * @author Matthias Schartner
+     *
+     * @param context scheduling context
      */
-    static void newScan() {
-        if ( scanSequence_modulo == scanSequence_cadence - 1 ) {
-            scanSequence_modulo = 0;
+    static void newScan( SchedulingContext &context ) {
+        if ( context.scanSequenceModulo == scanSequence_cadence - 1 ) {
+            context.scanSequenceModulo = 0;
         } else {
-            ++scanSequence_modulo;
+            ++context.scanSequenceModulo;
         }
     }
     /**
@@ -535,11 +536,12 @@ class Scan : public VieVS_Object {
      * @param source observed source
      * @param subnetting subnetting flag
      * @param idleScore precalculated vector of extra scores due to long idle time
+     * @param context scheduling context
      */
     void calcScore( const std::vector<double> &astas, const std::vector<double> &asrcs, const std::vector<double> &abls,
                     unsigned int minTime, unsigned int maxTime, const Network &network,
                     const std::shared_ptr<const AbstractSource> &source, bool subnetting,
-                    const std::vector<double> &idleScore ) noexcept;
+                    const std::vector<double> &idleScore, const SchedulingContext &context ) noexcept;
 
 
     /**
@@ -557,12 +559,13 @@ class Scan : public VieVS_Object {
      * @param source observed source
      * @param staids2skyCoverageScore stores the score of each pointing vector
      * @param idleScore precalculated vector of extra scores due to long idle time
+     * @param context scheduling context
      */
     void calcScore( const std::vector<double> &astas, const std::vector<double> &asrcs, const std::vector<double> &abls,
                     unsigned int minTime, unsigned int maxTime, const Network &network,
                     const std::shared_ptr<const AbstractSource> &source,
                     std::unordered_map<unsigned long, double> &staids2skyCoverageScore,
-                    const std::vector<double> &idleScore ) noexcept;
+                    const std::vector<double> &idleScore, const SchedulingContext &context ) noexcept;
 
 
     /**
@@ -581,12 +584,48 @@ class Scan : public VieVS_Object {
      * @param source observed source
      * @param staids2skyCoverageScore stored score for each pointing vector
      * @param idleScore precalculated vector of extra scores due to long idle time
+     * @param context scheduling context
      */
     void calcScore_subnetting( const std::vector<double> &astas, const std::vector<double> &asrcs,
                                const std::vector<double> &abls, unsigned int minTime, unsigned int maxTime,
                                const Network &network, const std::shared_ptr<const AbstractSource> &source,
                                const std::unordered_map<unsigned long, double> &staids2skyCoverageScore,
-                               const std::vector<double> &idleScore ) noexcept;
+                               const std::vector<double> &idleScore, const SchedulingContext &context ) noexcept;
+
+
+    /**
+     * @brief calculates the score of a scan based on precalculated additive score terms
+     * @author Matthias Schartner
+     *
+     * usually used for single scan sources. The additive score terms are calculated by ScoreKernel.
+     *
+     * @param firstPartScore precalculated additive score terms (see calcScore_firstPart)
+     * @param network station network
+     * @param source observed source
+     * @param staids2skyCoverageScore stores the score of each pointing vector
+     * @param context scheduling context
+     */
+    void calcScore( double firstPartScore, const Network &network, const std::shared_ptr<const AbstractSource> &source,
+                    std::unordered_map<unsigned long, double> &staids2skyCoverageScore,
+                    const SchedulingContext &context ) noexcept;
+
+
+    /**
+     * @brief calculates the score of a subnetting scan based on precalculated additive score terms
+     * @author Matthias Schartner
+     *
+     * The additive score terms are calculated by ScoreKernel.
+     *
+     * @param firstPartScore precalculated additive score terms (see calcScore_firstPart)
+     * @param network station network
+     * @param source observed source
+     * @param staids2skyCoverageScore stored score for each pointing vector
+     * @param context scheduling context
+     */
+    void calcScore_subnetting( double firstPartScore, const Network &network,
+                               const std::shared_ptr<const AbstractSource> &source,
+                               const std::unordered_map<unsigned long, double> &staids2skyCoverageScore,
+                               const SchedulingContext &context ) noexcept;
 
 
     /**
@@ -599,9 +638,11 @@ class Scan : public VieVS_Object {
      * @param source observed source
      * @param hiscore high impact score
      * @param subnetting subnetting flag
+     * @param context scheduling context
      */
     void calcScore( unsigned int minTime, unsigned int maxTime, const Network &network,
-                    const std::shared_ptr<const AbstractSource> &source, double hiscore, bool subnetting );
+                    const std::shared_ptr<const AbstractSource> &source, double hiscore, bool subnetting,
+                    const SchedulingContext &context );
 
 
     /**
@@ -615,11 +656,13 @@ class Scan : public VieVS_Object {
      * @param maxRequiredTime maximum time required for a scan in seconds
      * @param source observed source
      * @param subnetting subnetting flag
+     * @param context scheduling context
      */
     bool calcScore( const std::vector<double> &prevLowElevationScores,
                     const std::vector<double> &prevHighElevationScores, const Network &network,
                     unsigned int minRequiredTime, unsigned int maxRequiredTime,
-                    const std::shared_ptr<const AbstractSource> &source, bool subnetting );
+                    const std::shared_ptr<const AbstractSource> &source, bool subnetting,
+                    const SchedulingContext &context );
 
 
     /**
@@ -645,9 +688,10 @@ class Scan : public VieVS_Object {
      * @param network station network
      * @param source observed source
      * @param meanSNRs vector of SNRs per observation
+     * @param context scheduling context
      */
     void calcScoreDPar( const Network &network, const std::shared_ptr<const AbstractSource> &source,
-                        std::vector<double> meanSNRs );
+                        std::vector<double> meanSNRs, const SchedulingContext &context );
 
 
     /**
@@ -741,9 +785,11 @@ class Scan : public VieVS_Object {
      * @param network station network
      * @param source observed source
      * @param of outstream file object
+     * @param context scheduling context (used to write custom scan sequence information)
      */
     void output( unsigned long observed_scan_nr, const Network &network,
-                 const std::shared_ptr<const AbstractSource> &source, std::ofstream &of ) const noexcept;
+                 const std::shared_ptr<const AbstractSource> &source, std::ofstream &of,
+                 const SchedulingContext *context = nullptr ) const noexcept;
 
 
     /**
@@ -814,6 +860,16 @@ class Scan : public VieVS_Object {
     static unsigned long numberOfCreatedObjects() { return nextId - 1; }
 
 
+    /**
+     * @brief set new ids of scan, scan times, observations and pointing vectors
+     * @author Matthias Schartner
+     *
+     * Scans created inside an OpenMP loop draw their ids in thread order. Calling this function serially in
+     * candidate order afterwards makes the ids reproducible between runs with the same input.
+     */
+    void giveNewIds();
+
+
     /**
      * @brief set pointing vector
      * @author Matthias Schartner
@@ -946,7 +1002,7 @@ class Scan : public VieVS_Object {
                                  std::ofstream &of );
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     unsigned long nsta_;   ///< number of stations in this scan
     unsigned long srcid_;  ///< observed source id
@@ -1020,6 +1076,25 @@ class Scan : public VieVS_Object {
                                      bool &stationRemoved ) noexcept;
 
 
+    /**
+     * @brief observed source flux density of several observations
+     * @author Matthias Schartner
+     *
+     * The uv projection of each observation is calculated once and the flux density of each band is evaluated for
+     * all observations in one call. Missing or zero flux densities are replaced by 1e-3 jansky.
+     *
+     * @param network station network
+     * @param source observed source
+     * @param mode observing mode
+     * @param obs first observation
+     * @param n number of observations
+     * @param flux flux density per band (in order of mode band ids) and observation: flux[iband * n + iobs] (output)
+     */
+    static void observedFlux( const Network &network, const std::shared_ptr<const AbstractSource> &source,
+                              const std::shared_ptr<const Mode> &mode, const Observation *obs, unsigned long n,
+                              std::vector<double> &flux );
+
+
     /**
      * @brief rigorous check if scan can reach required endposition
      * @author Matthias Schartner
@@ -1126,9 +1201,11 @@ class Scan : public VieVS_Object {
      *
      * @param nclosures_max number of theoretically possible independent closure phases and amplitudes
      * @param source observed source
+     * @param weightFactors weight factors of this schedule
      * @return score based on number of independent closure phases and amplitudes
      */
-    double calcScore_closures(unsigned long nclosures_max, const std::shared_ptr<const AbstractSource> &source) const noexcept;
+    double calcScore_closures(unsigned long nclosures_max, const std::shared_ptr<const AbstractSource> &source,
+                              const WeightFactors &weightFactors) const noexcept;
 
 
     /**
@@ -1155,9 +1232,10 @@ class Scan : public VieVS_Object {
      * @author Matthias Schartner
      *
      * @param nmaxsta number of stations in network
+     * @param weightFactors weight factors of this schedule
      * @return score for low elevation scans
      */
-    double calcScore_lowElevation( unsigned long nmaxsta );
+    double calcScore_lowElevation( unsigned long nmaxsta, const WeightFactors &weightFactors );
 
 
     /**
@@ -1165,9 +1243,10 @@ class Scan : public VieVS_Object {
      * @author Matthias Schartner
      *
      * @param nMaxObs maximum number of possible observations in network
+     * @param weightFactors weight factors of this schedule
      * @return score for low declination scans
      */
-    double calcScore_lowDeclination( unsigned long nMaxObs );
+    double calcScore_lowDeclination( unsigned long nMaxObs, const WeightFactors &weightFactors );
 
 
     /**
@@ -1185,12 +1264,14 @@ class Scan : public VieVS_Object {
      * @param source observed source
      * @param subnetting subnetting flag
      * @param idleScore precalculated vector of extra scores due to long idle time
+     * @param weightFactors weight factors of this schedule
      * @return score
      */
     double calcScore_firstPart( const std::vector<double> &astas, const std::vector<double> &asrcs,
                                 const std::vector<double> &abls, unsigned int minTime, unsigned int maxTime,
                                 const Network &network, const std::shared_ptr<const AbstractSource> &source,
-                                bool subnetting, const std::vector<double> &idleScore );
+                                bool subnetting, const std::vector<double> &idleScore,
+                                const WeightFactors &weightFactors );
 
 
     /**
@@ -1202,11 +1283,12 @@ class Scan : public VieVS_Object {
      * @param this_score current score
      * @param network station network
      * @param source observed source
-     * @param ignoreScanSequence ignore scan sequence in score calculation
+     * @param context scheduling context (scan sequence is ignored if nullptr)
      * @return total score
      */
     double calcScore_secondPart( double this_score, const Network &network,
-                                 const std::shared_ptr<const AbstractSource> &source, bool ignoreScanSequence = false );
+                                 const std::shared_ptr<const AbstractSource> &source,
+                                 const SchedulingContext *context = nullptr );
 };
 }  // namespace VieVS
 #endif /* SCAN_H */
@@ -21,7 +21,7 @@
 
 using namespace std;
 using namespace VieVS;
-unsigned long ScanTimes::nextId = 0;
+std::atomic<unsigned long> ScanTimes::nextId{ 0 };
 ScanTimes::AlignmentAnchor ScanTimes::anchor = ScanTimes::AlignmentAnchor::start;
 
 
@@ -28,6 +28,7 @@
 #define SCANTIMES_H
 
 
+#include <atomic>
 #include <limits>
 #include <vector>
 
@@ -564,7 +565,7 @@ class ScanTimes : public VieVS_Object {
 
 
    private:
-    static unsigned long nextId;    ///< next id for this object type
+    static std::atomic<unsigned long> nextId;    ///< next id for this object type
     static AlignmentAnchor anchor;  ///< scan alignment anchor
 
     std::vector<unsigned int> endOfLastScan_;         ///< end of last scan
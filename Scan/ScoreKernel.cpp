@@ -0,0 +1,230 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ScoreKernel.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+ScoreKernel::ScoreKernel( const Network &network, const std::vector<double> &astas, const std::vector<double> &asrcs,
+                          const std::vector<double> &abls, const std::vector<double> &idleScore, unsigned int minTime,
+                          unsigned int maxTime, const WeightFactors &weightFactors )
+    : astas_{ astas },
+      asrcs_{ asrcs },
+      abls_{ abls },
+      idleScore_{ idleScore },
+      minTime_{ minTime },
+      maxTime_{ maxTime },
+      nmaxsta_{ network.getNSta() },
+      nmaxbl_{ network.getNBls() },
+      nclosuresMax_{ network.getNClosures_max() },
+      weightNumberOfObservations_{ weightFactors.weightNumberOfObservations },
+      weightAverageSources_{ weightFactors.weightAverageSources },
+      weightAverageStations_{ weightFactors.weightAverageStations },
+      weightAverageBaselines_{ weightFactors.weightAverageBaselines },
+      weightDuration_{ weightFactors.weightDuration },
+      weightIdleTime_{ weightFactors.weightIdleTime },
+      weightClosures_{ weightFactors.weightClosures },
+      maxClosures_{ weightFactors.maxClosures },
+      weightDeclination_{ weightFactors.weightDeclination },
+      declinationStartWeight_{ weightFactors.declinationStartWeight },
+      declinationFullWeight_{ weightFactors.declinationFullWeight },
+      weightLowElevation_{ weightFactors.weightLowElevation },
+      lowElevationStartWeight_{ weightFactors.lowElevationStartWeight },
+      lowElevationFullWeight_{ weightFactors.lowElevationFullWeight } {
+    staOffset_.push_back( 0 );
+    obsOffset_.push_back( 0 );
+}
+
+
+void ScoreKernel::reserve( unsigned long nscans ) {
+    nsta_.reserve( nscans );
+    nobs_.reserve( nscans );
+    duration_.reserve( nscans );
+    srcid_.reserve( nscans );
+    dec_.reserve( nscans );
+    closuresAllowed_.reserve( nscans );
+    staOffset_.reserve( nscans + 1 );
+    obsOffset_.reserve( nscans + 1 );
+    staid_.reserve( nscans * nmaxsta_ );
+    el_.reserve( nscans * nmaxsta_ );
+    blid_.reserve( nscans * nmaxbl_ );
+}
+
+
+void ScoreKernel::add( const Scan &scan, const std::shared_ptr<const AbstractSource> &source ) {
+    unsigned long nsta = scan.getNSta();
+    nsta_.push_back( nsta );
+    nobs_.push_back( scan.getNObs() );
+    duration_.push_back( scan.getTimes().getScanDuration() );
+    srcid_.push_back( scan.getSourceId() );
+    dec_.push_back( scan.getPointingVector( 0 ).getDc() );
+    closuresAllowed_.push_back( source->getNClosures() < maxClosures_ );
+
+    for ( unsigned long idx = 0; idx < nsta; ++idx ) {
+        const PointingVector &pv = scan.getPointingVector( idx );
+        staid_.push_back( pv.getStaid() );
+        el_.push_back( pv.getEl() );
+    }
+    staOffset_.push_back( staid_.size() );
+
+    for ( const auto &obs : scan.getObservations() ) {
+        blid_.push_back( obs.getBlid() );
+    }
+    obsOffset_.push_back( blid_.size() );
+}
+
+
+std::vector<double> ScoreKernel::evaluate() const {
+    unsigned long n = size();
+    vector<double> score( n, 0.0 );
+    vector<double> term( n );
+
+    // terms are added in the same order as in Scan::calcScore_firstPart to get identical results
+    if ( weightNumberOfObservations_ != 0 ) {
+        for ( unsigned long i = 0; i < n; ++i ) {
+            term[i] = static_cast<double>( nobs_[i] ) / static_cast<double>( nmaxbl_ );
+        }
+        for ( unsigned long i = 0; i < n; ++i ) {
+            score[i] += term[i] * weightNumberOfObservations_;
+        }
+    }
+
+    if ( weightAverageSources_ != 0 && !asrcs_.empty() ) {
+        for ( unsigned long i = 0; i < n; ++i ) {
+            term[i] = asrcs_[srcid_[i]] * static_cast<double>( nobs_[i] ) / static_cast<double>( nmaxbl_ );
+        }
+        for ( unsigned long i = 0; i < n; ++i ) {
+            score[i] += term[i] * weightAverageSources_;
+        }
+    }
+
+    if ( weightAverageStations_ != 0 && !astas_.empty() ) {
+        double max = accumulate( astas_.begin(), astas_.end(), 0.0 );
+        for ( unsigned long i = 0; i < n; ++i ) {
+            double sum = 0;
+            if ( max >= 1e-4 ) {
+                for ( unsigned long j = staOffset_[i]; j < staOffset_[i + 1]; ++j ) {
+                    sum += astas_[staid_[j]];
+                }
+                sum /= max;
+            }
+            term[i] = sum;
+        }
+        for ( unsigned long i = 0; i < n; ++i ) {
+            score[i] += term[i] * weightAverageStations_;
+        }
+    }
+
+    if ( weightAverageBaselines_ != 0 && !abls_.empty() ) {
+        for ( unsigned long i = 0; i < n; ++i ) {
+            double sum = 0;
+            for ( unsigned long j = obsOffset_[i]; j < obsOffset_[i + 1]; ++j ) {
+                sum += abls_[blid_[j]];
+            }
+            term[i] = sum;
+        }
+        for ( unsigned long i = 0; i < n; ++i ) {
+            score[i] += term[i] * weightAverageBaselines_;
+        }
+    }
+
+    if ( weightDuration_ != 0 ) {
+        for ( unsigned long i = 0; i < n; ++i ) {
+            double thisScore;
+            if ( maxTime_ - minTime_ == 0 ) {
+                thisScore = 1;
+            } else {
+                thisScore = 1 - static_cast<double>( duration_[i] - minTime_ ) /
+                                    static_cast<double>( maxTime_ - minTime_ );
+            }
+            term[i] = thisScore * ( static_cast<double>( nsta_[i] ) / static_cast<double>( nmaxsta_ ) );
+        }
+        for ( unsigned long i = 0; i < n; ++i ) {
+            score[i] += term[i] * weightDuration_;
+        }
+    }
+
+    if ( weightIdleTime_ != 0 ) {
+        for ( unsigned long i = 0; i < n; ++i ) {
+            double sum = 0;
+            for ( unsigned long j = staOffset_[i]; j < staOffset_[i + 1]; ++j ) {
+                sum += idleScore_[staid_[j]];
+            }
+            term[i] = sum;
+        }
+        for ( unsigned long i = 0; i < n; ++i ) {
+            score[i] += term[i] * weightIdleTime_;
+        }
+    }
+
+    if ( weightClosures_ != 0 ) {
+        for ( unsigned long i = 0; i < n; ++i ) {
+            unsigned long nsta = nsta_[i];
+            unsigned long closures = nsta <= 2 ? 0 : ( nsta - 1 ) * ( nsta - 2 ) / 2 + nsta * ( nsta - 3 ) / 2;
+            term[i] = closuresAllowed_[i] ? static_cast<double>( closures ) / static_cast<double>( nclosuresMax_ ) : 0;
+        }
+        for ( unsigned long i = 0; i < n; ++i ) {
+            score[i] += term[i] * weightClosures_;
+        }
+    }
+
+    if ( weightDeclination_ != 0 ) {
+        for ( unsigned long i = 0; i < n; ++i ) {
+            double dec = dec_[i];
+            double f;
+            if ( dec > declinationStartWeight_ ) {
+                f = 0;
+            } else if ( dec < declinationFullWeight_ ) {
+                f = 1;
+            } else {
+                f = ( dec - declinationStartWeight_ ) / ( declinationFullWeight_ - declinationStartWeight_ );
+            }
+            term[i] = f * static_cast<double>( nobs_[i] ) / static_cast<double>( nmaxbl_ );
+        }
+        for ( unsigned long i = 0; i < n; ++i ) {
+            score[i] += term[i] * weightDeclination_;
+        }
+    }
+
+    if ( weightLowElevation_ != 0 ) {
+        for ( unsigned long i = 0; i < n; ++i ) {
+            double sum = 0;
+            for ( unsigned long j = staOffset_[i]; j < staOffset_[i + 1]; ++j ) {
+                double el = el_[j];
+                double f;
+                if ( el > lowElevationStartWeight_ ) {
+                    f = 0;
+                } else if ( el < lowElevationFullWeight_ ) {
+                    f = 1;
+                } else {
+                    f = ( el - lowElevationStartWeight_ ) / ( lowElevationFullWeight_ - lowElevationStartWeight_ );
+                }
+                sum += f;
+            }
+            term[i] = sum / nmaxsta_;
+        }
+        for ( unsigned long i = 0; i < n; ++i ) {
+            score[i] += term[i] * weightLowElevation_;
+        }
+    }
+
+    return score;
+}
@@ -0,0 +1,156 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ScoreKernel.h
+ * @brief class ScoreKernel
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+
+#ifndef SCOREKERNEL_H
+#define SCOREKERNEL_H
+
+
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "../Misc/WeightFactors.h"
+#include "../Source/AbstractSource.h"
+#include "../Station/Network.h"
+#include "Scan.h"
+
+
+namespace VieVS {
+
+/**
+ * @class ScoreKernel
+ * @brief batched calculation of the additive score terms of many candidate scans
+ *
+ * All candidate scans are stored in contiguous arrays (one entry per scan for number of stations, observations,
+ * duration, source and declination, one entry per station for station id and elevation and one entry per observation
+ * for baseline id). Each score term is then calculated for all scans in one loop. The weight factors are read once.
+ *
+ * The result is identical to Scan::calcScore_firstPart (same terms, same order of summation).
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+class ScoreKernel {
+   public:
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     *
+     * @param network station network
+     * @param astas precalculated vector of average station score
+     * @param asrcs precalculated vector of average source score
+     * @param abls precalculated vector of average baseline score
+     * @param idleScore precalculated vector of extra scores due to long idle time
+     * @param minTime minimum time required for a scan in seconds
+     * @param maxTime maximum time required for a scan in seconds
+     * @param weightFactors weight factors of this schedule
+     */
+    ScoreKernel( const Network &network, const std::vector<double> &astas, const std::vector<double> &asrcs,
+                 const std::vector<double> &abls, const std::vector<double> &idleScore, unsigned int minTime,
+                 unsigned int maxTime, const WeightFactors &weightFactors );
+
+
+    /**
+     * @brief reserve memory
+     * @author Matthias Schartner
+     *
+     * Per station and per observation arrays are reserved for scans with all stations of the network.
+     *
+     * @param nscans expected number of scans
+     */
+    void reserve( unsigned long nscans );
+
+
+    /**
+     * @brief add a candidate scan
+     * @author Matthias Schartner
+     *
+     * @param scan candidate scan
+     * @param source observed source
+     */
+    void add( const Scan &scan, const std::shared_ptr<const AbstractSource> &source );
+
+
+    /**
+     * @brief getter for number of added scans
+     * @author Matthias Schartner
+     *
+     * @return number of added scans
+     */
+    unsigned long size() const noexcept { return nsta_.size(); }
+
+
+    /**
+     * @brief calculate the additive score terms of all added scans
+     * @author Matthias Schartner
+     *
+     * @return score of each scan (in order of add) equal to Scan::calcScore_firstPart
+     */
+    std::vector<double> evaluate() const;
+
+   private:
+    const std::vector<double> &astas_;      ///< precalculated vector of average station score
+    const std::vector<double> &asrcs_;      ///< precalculated vector of average source score
+    const std::vector<double> &abls_;       ///< precalculated vector of average baseline score
+    const std::vector<double> &idleScore_;  ///< precalculated vector of extra scores due to long idle time
+    unsigned int minTime_;                  ///< minimum time required for a scan in seconds
+    unsigned int maxTime_;                  ///< maximum time required for a scan in seconds
+
+    unsigned long nmaxsta_;       ///< number of stations
+    unsigned long nmaxbl_;        ///< number of baselines
+    unsigned long nclosuresMax_;  ///< maximum number of closures
+
+    double weightNumberOfObservations_;  ///< weight factor for number of observations
+    double weightAverageSources_;        ///< weight factor for average out sources
+    double weightAverageStations_;       ///< weight factor for average out stations
+    double weightAverageBaselines_;      ///< weight factor for average out baselines
+    double weightDuration_;              ///< weight factor for duration
+    double weightIdleTime_;              ///< weight factor for extra weight after long idle time
+    double weightClosures_;              ///< weight factor for closure delays
+    unsigned int maxClosures_;           ///< maximum number of closure delays
+    double weightDeclination_;           ///< weight factor for declination
+    double declinationStartWeight_;      ///< start declination of additional weight
+    double declinationFullWeight_;       ///< end declination of additional declination weight slope
+    double weightLowElevation_;          ///< weight factor for low elevation scans
+    double lowElevationStartWeight_;     ///< start elevation of additional weight
+    double lowElevationFullWeight_;      ///< end elevation of additional elevation weight slope
+
+    std::vector<unsigned long> nsta_;       ///< number of stations per scan
+    std::vector<unsigned long> nobs_;       ///< number of observations per scan
+    std::vector<unsigned int> duration_;    ///< scan duration per scan
+    std::vector<unsigned long> srcid_;      ///< source id per scan
+    std::vector<double> dec_;               ///< declination per scan
+    std::vector<char> closuresAllowed_;     ///< flag if source still requires closures per scan
+    std::vector<unsigned long> staOffset_;  ///< index of first station per scan (size + 1 entries)
+    std::vector<unsigned long> obsOffset_;  ///< index of first observation per scan (size + 1 entries)
+
+    std::vector<unsigned long> staid_;  ///< station id per station of all scans
+    std::vector<double> el_;            ///< elevation per station of all scans
+    std::vector<unsigned long> blid_;   ///< baseline id per observation of all scans
+};
+}  // namespace VieVS
+
+#endif  // SCOREKERNEL_H
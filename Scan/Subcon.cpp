@@ -28,7 +28,7 @@
 
 using namespace std;
 using namespace VieVS;
-unsigned long Subcon::nextId = 0;
+std::atomic<unsigned long> Subcon::nextId{ 0 };
 
 
 Subcon::Subcon() : VieVS_Object( nextId++ ), nSingleScans_{ 0 }, nSubnettingScans_{ 0 } {}
@@ -55,93 +55,99 @@ void Subcon::calcStartTimes( const Network &network, const SourceList &sourceLis
     int i = 0;
     // loop through all scans
     while ( i < nSingleScans_ ) {
-        bool scanValid_slew = true;
-        bool scanValid_idle = true;
-        bool scanValid_endposition = true;
-
-        // save maximum idle times
-        vector<unsigned int> maxIdleTimes;
-
         // current scan
         Scan &thisScan = singleScans_[i];
-
         const auto &thisSource = sourceList.getSource( thisScan.getSourceId() );
 
-        // loop through all stations
-        int j = 0;
-        while ( j < thisScan.getNSta() ) {
-            unsigned long staid = thisScan.getStationId( j );
+        if ( calcStartTimes( thisScan, network, thisSource, endposition ) ) {
+            ++i;
+        } else {
+#ifdef VIESCHEDPP_LOG
+            if ( Flags::logDebug )
+                BOOST_LOG_TRIVIAL( debug ) << "scan " << thisScan.printId() << " no longer valid -> removed";
+#endif
+            singleScans_.erase( next( singleScans_.begin(), i ) );
+            --nSingleScans_;
+        }
+    }
+}
 
-            // current station
-            const Station &thisSta = network.getStation( staid );
 
-            // first scan means no field system, slew and preob time
-            if ( thisSta.getPARA().firstScan ) {
-                thisScan.addTimes( j, 0, 0, 0 );
-                ++j;
-                maxIdleTimes.push_back( thisSta.getPARA().maxWait );
-                continue;
-            }
+bool Subcon::calcStartTimes( Scan &thisScan, const Network &network,
+                             const std::shared_ptr<const AbstractSource> &thisSource,
+                             const boost::optional<StationEndposition> &endposition ) const noexcept {
+    bool scanValid_slew = true;
+    bool scanValid_idle = true;
+    bool scanValid_endposition = true;
 
-            // unwrap azimuth and calculate slewtime
-            thisSta.getCableWrap().calcUnwrappedAz( thisSta.getCurrentPointingVector(),
-                                                    thisScan.referencePointingVector( j ) );
-            auto slewtime = thisSta.slewTime( thisScan.getPointingVector( j ) );
+    // save maximum idle times
+    vector<unsigned int> maxIdleTimes;
 
-            // look if slewtime is valid, if yes add field system, slew and preob times
-            if ( slewtime.is_initialized() ) {
-                maxIdleTimes.push_back( thisSta.getPARA().maxWait );
-                thisScan.addTimes( j, thisSta.getPARA().systemDelay, *slewtime, thisSta.getPARA().preob );
+    // loop through all stations
+    int j = 0;
+    while ( j < thisScan.getNSta() ) {
+        unsigned long staid = thisScan.getStationId( j );
+
+        // current station
+        const Station &thisSta = network.getStation( staid );
+
+        // first scan means no field system, slew and preob time
+        if ( thisSta.getPARA().firstScan ) {
+            thisScan.addTimes( j, 0, 0, 0 );
+            ++j;
+            maxIdleTimes.push_back( thisSta.getPARA().maxWait );
+            continue;
+        }
+
+        // unwrap azimuth and calculate slewtime
+        thisSta.getCableWrap().calcUnwrappedAz( thisSta.getCurrentPointingVector(),
+                                                thisScan.referencePointingVector( j ) );
+        auto slewtime = thisSta.slewTime( thisScan.getPointingVector( j ) );
+
+        // look if slewtime is valid, if yes add field system, slew and preob times
+        if ( slewtime.is_initialized() ) {
+            maxIdleTimes.push_back( thisSta.getPARA().maxWait );
+            thisScan.addTimes( j, thisSta.getPARA().systemDelay, *slewtime, thisSta.getPARA().preob );
+        } else {
+            scanValid_slew = thisScan.removeStation( j, thisSource );
+            if ( !scanValid_slew ) {
+                break;  // scan is no longer valid
             } else {
-                scanValid_slew = thisScan.removeStation( j, thisSource );
-                if ( !scanValid_slew ) {
-                    break;  // scan is no longer valid
-                } else {
-                    continue;  // station was removed, continue with next station (do not increment counter!)
-                }
+                continue;  // station was removed, continue with next station (do not increment counter!)
             }
+        }
 
-            // look if there is enough time to reach endposition (if there is any) under perfect circumstances
-            if ( endposition.is_initialized() ) {
-                const auto &times = thisScan.getTimes();
+        // look if there is enough time to reach endposition (if there is any) under perfect circumstances
+        if ( endposition.is_initialized() ) {
+            const auto &times = thisScan.getTimes();
 
-                unsigned int minimumScanTime = max( thisSta.getPARA().minScan, thisSource->getPARA().minScan );
+            unsigned int minimumScanTime = max( thisSta.getPARA().minScan, thisSource->getPARA().minScan );
 
-                // calc possible endposition time. Assumtion: 5sec slew time, no idle time and minimum scan time
-                int possibleEndpositionTime = times.getObservingTime( j, Timestamp::start ) + minimumScanTime + 5 +
-                                              thisSta.getPARA().systemDelay + thisSta.getPARA().preob;
+            // calc possible endposition time. Assumtion: 5sec slew time, no idle time and minimum scan time
+            int possibleEndpositionTime = times.getObservingTime( j, Timestamp::start ) + minimumScanTime + 5 +
+                                          thisSta.getPARA().systemDelay + thisSta.getPARA().preob;
 
-                // get minimum required endpositon time
-                int requiredEndpositionTime = endposition->requiredEndpositionTime( staid, false );
+            // get minimum required endpositon time
+            int requiredEndpositionTime = endposition->requiredEndpositionTime( staid, false );
 
-                // check if there is enough time left
-                if ( possibleEndpositionTime - 5 > requiredEndpositionTime ) {
-                    scanValid_endposition = thisScan.removeStation( j, thisSource );
-                    if ( !scanValid_endposition ) {
-                        break;  // scan is no longer valid
-                    } else {
-                        continue;  // station was removed, continue with next station (do not increment counter!)
-                    }
+            // check if there is enough time left
+            if ( possibleEndpositionTime - 5 > requiredEndpositionTime ) {
+                scanValid_endposition = thisScan.removeStation( j, thisSource );
+                if ( !scanValid_endposition ) {
+                    break;  // scan is no longer valid
+                } else {
+                    continue;  // station was removed, continue with next station (do not increment counter!)
                 }
             }
-            ++j;
-        }
-
-        if ( scanValid_slew && scanValid_endposition ) {
-            scanValid_idle = thisScan.checkIdleTimes( maxIdleTimes, thisSource );
         }
+        ++j;
+    }
 
-        if ( scanValid_slew && scanValid_endposition && scanValid_idle ) {
-            ++i;
-        } else {
-#ifdef VIESCHEDPP_LOG
-            if ( Flags::logDebug )
-                BOOST_LOG_TRIVIAL( debug ) << "scan " << thisScan.printId() << " no longer valid -> removed";
-#endif
-            singleScans_.erase( next( singleScans_.begin(), i ) );
-            --nSingleScans_;
-        }
+    if ( scanValid_slew && scanValid_endposition ) {
+        scanValid_idle = thisScan.checkIdleTimes( maxIdleTimes, thisSource );
     }
+
+    return scanValid_slew && scanValid_endposition && scanValid_idle;
 }
 
 
@@ -178,47 +184,9 @@ void Subcon::updateAzEl( const Network &network, const SourceList &sourceList )
     int i = 0;
     while ( i < nSingleScans_ ) {
         auto &thisScan = singleScans_[i];
-
         const auto &thisSource = sourceList.getSource( thisScan.getSourceId() );
-        bool scanValid_slew = true;
-        bool scanValid_idle = true;
-        vector<unsigned int> maxIdleTimes;
-
-        int staidx = 0;
-        while ( staidx < thisScan.getNSta() ) {
-            unsigned long staid = thisScan.getStationId( staidx );
-            PointingVector &thisPointingVector = thisScan.referencePointingVector( staidx );
-            const Station &thisStation = network.getStation( staid );
-            thisPointingVector.setTime( thisScan.getTimes().getObservingTime( staidx, Timestamp::start ) );
-            thisStation.calcAzEl_simple( thisSource, thisPointingVector );
-            bool visible = thisStation.isVisible(
-                thisPointingVector, sourceList.getSource( thisScan.getSourceId() )->getPARA().minElevation );
-
-            boost::optional<unsigned int> slewtime;
-
-            if ( visible ) {
-                thisStation.getCableWrap().calcUnwrappedAz( thisStation.getCurrentPointingVector(),
-                                                            thisPointingVector );
-                slewtime = thisStation.slewTime( thisPointingVector );
-            }
-
-            if ( !visible || !slewtime.is_initialized() ) {
-                scanValid_slew = thisScan.removeStation( staidx, sourceList.getSource( thisScan.getSourceId() ) );
-                if ( !scanValid_slew ) {
-                    break;
-                }
-            } else {
-                maxIdleTimes.push_back( thisStation.getPARA().maxWait );
-                thisScan.referenceTime().setSlewTime( staidx, *slewtime );
-                ++staidx;
-            }
-        }
 
-        if ( scanValid_slew ) {
-            scanValid_idle = thisScan.checkIdleTimes( maxIdleTimes, sourceList.getSource( thisScan.getSourceId() ) );
-        }
-
-        if ( !scanValid_slew || !scanValid_idle ) {
+        if ( !updateAzEl( thisScan, network, thisSource ) ) {
 #ifdef VIESCHEDPP_LOG
             if ( Flags::logDebug )
                 BOOST_LOG_TRIVIAL( debug )
@@ -233,6 +201,48 @@ void Subcon::updateAzEl( const Network &network, const SourceList &sourceList )
 }
 
 
+bool Subcon::updateAzEl( Scan &thisScan, const Network &network,
+                         const std::shared_ptr<const AbstractSource> &thisSource ) const noexcept {
+    bool scanValid_slew = true;
+    bool scanValid_idle = true;
+    vector<unsigned int> maxIdleTimes;
+
+    int staidx = 0;
+    while ( staidx < thisScan.getNSta() ) {
+        unsigned long staid = thisScan.getStationId( staidx );
+        PointingVector &thisPointingVector = thisScan.referencePointingVector( staidx );
+        const Station &thisStation = network.getStation( staid );
+        thisPointingVector.setTime( thisScan.getTimes().getObservingTime( staidx, Timestamp::start ) );
+        thisStation.calcAzEl_simple( thisSource, thisPointingVector );
+        bool visible = thisStation.isVisible( thisPointingVector, thisSource->getPARA().minElevation );
+
+        boost::optional<unsigned int> slewtime;
+
+        if ( visible ) {
+            thisStation.getCableWrap().calcUnwrappedAz( thisStation.getCurrentPointingVector(), thisPointingVector );
+            slewtime = thisStation.slewTime( thisPointingVector );
+        }
+
+        if ( !visible || !slewtime.is_initialized() ) {
+            scanValid_slew = thisScan.removeStation( staidx, thisSource );
+            if ( !scanValid_slew ) {
+                break;
+            }
+        } else {
+            maxIdleTimes.push_back( thisStation.getPARA().maxWait );
+            thisScan.referenceTime().setSlewTime( staidx, *slewtime );
+            ++staidx;
+        }
+    }
+
+    if ( scanValid_slew ) {
+        scanValid_idle = thisScan.checkIdleTimes( maxIdleTimes, thisSource );
+    }
+
+    return scanValid_slew && scanValid_idle;
+}
+
+
 void Subcon::calcAllBaselineDurations( const Network &network, const SourceList &sourceList,
                                        const std::shared_ptr<const Mode> &mode ) noexcept {
 #ifdef VIESCHEDPP_LOG
@@ -271,41 +281,7 @@ void Subcon::calcAllScanDurations( const Network &network, const SourceList &sou
         Scan &thisScan = singleScans_[i];
         const auto &thisSource = sourceList.getSource( thisScan.getSourceId() );
 
-        // calculate scan durations and check if they are valid
-        bool scanValid_scanDuration = thisScan.scanDuration( network, thisSource );
-
-        // check if there is enough time to slew to endposition under perfect circumstances
-        bool scanValid_endposition = true;
-        if ( endposition.is_initialized() ) {
-            const auto &times = thisScan.getTimes();
-
-            // loop through all stations
-            int staidx = 0;
-            while ( staidx < thisScan.getNSta() ) {
-                unsigned long staid = thisScan.getStationId( staidx );
-                const Station &thisSta = network.getStation( staid );
-
-                // calc possible endposition time. Assumtion: 5sec slew time, no idle time
-                int possibleEndpositionTime = times.getObservingTime( staidx, Timestamp::end ) +
-                                              thisSta.getPARA().systemDelay + thisSta.getPARA().preob + 5;
-
-                // get minimum required endpositon time
-                int requiredEndpositionTime = endposition->requiredEndpositionTime( staid, false );
-
-                // check if there is enough time left
-                if ( possibleEndpositionTime - 5 > requiredEndpositionTime ) {
-                    scanValid_endposition = thisScan.removeStation( staidx, thisSource );
-                    if ( !scanValid_endposition ) {
-                        break;  // scan is no longer valid
-                    } else {
-                        continue;  // station was removed, continue with next station (do not increment counter!)
-                    }
-                }
-                ++staidx;
-            }
-        }
-
-        if ( scanValid_scanDuration && scanValid_endposition ) {
+        if ( calcScanDuration( thisScan, network, thisSource, endposition ) ) {
             ++i;
         } else {
 #ifdef VIESCHEDPP_LOG
@@ -320,6 +296,47 @@ void Subcon::calcAllScanDurations( const Network &network, const SourceList &sou
 }
 
 
+bool Subcon::calcScanDuration( Scan &thisScan, const Network &network,
+                               const std::shared_ptr<const AbstractSource> &thisSource,
+                               const boost::optional<StationEndposition> &endposition ) const noexcept {
+    // calculate scan durations and check if they are valid
+    bool scanValid_scanDuration = thisScan.scanDuration( network, thisSource );
+
+    // check if there is enough time to slew to endposition under perfect circumstances
+    bool scanValid_endposition = true;
+    if ( endposition.is_initialized() ) {
+        const auto &times = thisScan.getTimes();
+
+        // loop through all stations
+        int staidx = 0;
+        while ( staidx < thisScan.getNSta() ) {
+            unsigned long staid = thisScan.getStationId( staidx );
+            const Station &thisSta = network.getStation( staid );
+
+            // calc possible endposition time. Assumtion: 5sec slew time, no idle time
+            int possibleEndpositionTime = times.getObservingTime( staidx, Timestamp::end ) +
+                                          thisSta.getPARA().systemDelay + thisSta.getPARA().preob + 5;
+
+            // get minimum required endpositon time
+            int requiredEndpositionTime = endposition->requiredEndpositionTime( staid, false );
+
+            // check if there is enough time left
+            if ( possibleEndpositionTime - 5 > requiredEndpositionTime ) {
+                scanValid_endposition = thisScan.removeStation( staidx, thisSource );
+                if ( !scanValid_endposition ) {
+                    break;  // scan is no longer valid
+                } else {
+                    continue;  // station was removed, continue with next station (do not increment counter!)
+                }
+            }
+            ++staidx;
+        }
+    }
+
+    return scanValid_scanDuration && scanValid_endposition;
+}
+
+
 void Subcon::calcCalibratorScanDuration( const vector<Station> &stations, const SourceList & ) {
     for ( auto &thisScan : singleScans_ ) {
         thisScan.setFixedScanDuration( AstrometricCalibratorBlock::scanLength );
@@ -328,175 +345,298 @@ void Subcon::calcCalibratorScanDuration( const vector<Station> &stations, const
 
 
 void Subcon::createSubnettingScans( const std::shared_ptr<Subnetting> &subnetting, const Network &network,
-                                    const SourceList &sourceList ) noexcept {
+                                    const SourceList &sourceList, int nThreads ) noexcept {
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " create subnetting scans";
 #endif
 
     subnettingScans_.clear();
-    vector<unsigned long> sourceIds( nSingleScans_ );
-    for ( int i = 0; i < nSingleScans_; ++i ) {
-        sourceIds[i] = singleScans_[i].getSourceId();
+
+    SubnettingLookup lookup;
+
+    // index of single source scan per source id
+    lookup.srcid2scan = vector<long>( sourceList.getNSrc(), -1 );
+    for ( long i = static_cast<long>( nSingleScans_ ) - 1; i >= 0; --i ) {
+        lookup.srcid2scan[singleScans_[i].getSourceId()] = i;
+    }
+
+    // station bitmask per single source scan
+    unsigned long nsta = network.getNSta();
+    lookup.nWords = ( nsta + 63 ) / 64;
+    lookup.stationMasks = vector<uint64_t>( nSingleScans_ * lookup.nWords, 0 );
+    for ( unsigned long i = 0; i < nSingleScans_; ++i ) {
+        uint64_t *mask = &lookup.stationMasks[i * lookup.nWords];
+        const Scan &thisScan = singleScans_[i];
+        for ( int idx = 0; idx < thisScan.getNSta(); ++idx ) {
+            unsigned long staid = thisScan.getStationId( idx );
+            mask[staid / 64] |= uint64_t{ 1 } << ( staid % 64 );
+        }
+    }
+
+    // site id per station id (stations without site share site 0, same as Network::stationIdsToNSites)
+    lookup.station2site = vector<int>( nsta, 0 );
+    for ( const auto &any : Network::stations2sites() ) {
+        if ( any.first < nsta ) {
+            lookup.station2site[any.first] = any.second;
+        }
+    }
+    for ( int site : lookup.station2site ) {
+        lookup.nSites = max( lookup.nSites, site + 1 );
     }
 
-    unsigned long availableSta = 0;
     for ( const auto &any : network.getStations() ) {
         if ( any.getPARA().available && !any.getPARA().tagalong ) {
-            ++availableSta;
+            ++lookup.availableSta;
         }
     }
 
-    for ( int i = 0; i < nSingleScans_; ++i ) {
-        unsigned long firstSrcId = sourceIds[i];
-        Scan &first = singleScans_[i];
-        const vector<unsigned long> &secondSrcIds = subnetting->getSubnettingSrcIds().at( firstSrcId );
-        for ( unsigned long secondSrcId : secondSrcIds ) {
-            auto it = find( sourceIds.begin(), sourceIds.end(), secondSrcId );
-            if ( it != sourceIds.end() ) {
-                long srcid = distance( sourceIds.begin(), it );
-                Scan &second = singleScans_[srcid];
+    // each first scan is processed independently, concatenating the results in scan order afterwards results in the
+    // same ordering as the serial version. Ids are assigned again during concatenation so that they do not depend on
+    // the thread scheduling
+    auto nscans = static_cast<long>( nSingleScans_ );
+    vector<vector<pair<Scan, Scan>>> subnettingScansPerScan( nSingleScans_ );
+#ifdef _OPENMP
+#pragma omp parallel for num_threads( nThreads ) schedule( dynamic )
+#endif
+    for ( long i = 0; i < nscans; ++i ) {
+        subnettingScansPerScan[i] = createSubnettingScans( i, subnetting, sourceList, lookup );
+    }
 
-                vector<unsigned long> uniqueSta1;
-                vector<unsigned long> uniqueSta2;
-                vector<unsigned long> intersection;
+    for ( auto &thisScans : subnettingScansPerScan ) {
+        for ( auto &any : thisScans ) {
+            any.first.giveNewIds();
+            any.second.giveNewIds();
+            subnettingScans_.push_back( std::move( any ) );
+        }
+    }
+    nSubnettingScans_ = subnettingScans_.size();
+}
 
-                for ( int idx = 0; idx < first.getNSta(); ++idx ) {
-                    const PointingVector &pv = first.getPointingVector( idx );
-                    unsigned long staid = pv.getStaid();
 
-                    if ( !second.findIdxOfStationId( staid ) ) {
-                        uniqueSta1.push_back( staid );
-                    } else {
-                        intersection.push_back( staid );
-                    }
+std::vector<std::pair<Scan, Scan>> Subcon::createSubnettingScans( unsigned long idx1,
+                                                                  const std::shared_ptr<Subnetting> &subnetting,
+                                                                  const SourceList &sourceList,
+                                                                  const SubnettingLookup &lookup ) const noexcept {
+    vector<pair<Scan, Scan>> scans;
+
+    const Scan &first = singleScans_[idx1];
+    unsigned long firstSrcId = first.getSourceId();
+    const auto &firstSource = sourceList.getSource( firstSrcId );
+    const uint64_t *mask1 = &lookup.stationMasks[idx1 * lookup.nWords];
+    unsigned int firstTime = first.getTimes().getScanTime( Timestamp::end );
+
+    auto hasStation = []( const uint64_t *mask, unsigned long staid ) {
+        return ( mask[staid / 64] >> ( staid % 64 ) & 1 ) != 0;
+    };
+
+    // buffers are reused for all source pairs
+    vector<unsigned long> uniqueSta1;
+    vector<unsigned long> uniqueSta2;
+    vector<unsigned long> intersection;
+    vector<unsigned long> scan1sta;
+    vector<unsigned long> scan2sta;
+    vector<uint64_t> siteBits1;
+    vector<uint64_t> siteBits2;
+    vector<unsigned long> siteStamp( lookup.nSites, 0 );
+    vector<int> siteSlot( lookup.nSites, 0 );
+    unsigned long stamp = 0;
+
+    // number of sites of unique stations. For each shared station, siteBits holds a bit of its site if this site is not
+    // already covered by the unique stations (sites of one split = nBase + bitcount of all selected siteBits)
+    auto siteBitmasks = [&]( const vector<unsigned long> &unique, vector<uint64_t> &siteBits ) {
+        ++stamp;
+        unsigned long nBase = 0;
+        for ( unsigned long staid : unique ) {
+            int site = lookup.station2site[staid];
+            if ( siteStamp[site] != stamp ) {
+                siteStamp[site] = stamp;
+                siteSlot[site] = -1;
+                ++nBase;
+            }
+        }
+        int nextSlot = 0;
+        siteBits.resize( intersection.size() );
+        for ( unsigned long ii = 0; ii < intersection.size(); ++ii ) {
+            int site = lookup.station2site[intersection[ii]];
+            if ( siteStamp[site] != stamp ) {
+                siteStamp[site] = stamp;
+                siteSlot[site] = nextSlot++;
+            }
+            siteBits[ii] = siteSlot[site] < 0 ? 0 : uint64_t{ 1 } << siteSlot[site];
+        }
+        return nBase;
+    };
+
+    // bit of shared stations which have to be part of a scan (if required station is not part of the scan at all
+    // no valid split exists)
+    auto requiredBits = [&]( const std::shared_ptr<const AbstractSource> &source, const uint64_t *mask,
+                             uint64_t &bits ) {
+        bits = 0;
+        unsigned long nint = intersection.size();
+        for ( unsigned long staid : source->getPARA().requiredStations ) {
+            if ( staid >= lookup.station2site.size() || !hasStation( mask, staid ) ) {
+                return false;
+            }
+            auto it = find( intersection.begin(), intersection.end(), staid );
+            if ( it != intersection.end() ) {
+                bits |= uint64_t{ 1 } << ( nint - 1 - distance( intersection.begin(), it ) );
+            }
+        }
+        return true;
+    };
+
+    auto secondSrcIds = subnetting->getSubnettingSrcIds().get( firstSrcId );
+    for ( const unsigned int *it = secondSrcIds.first; it != secondSrcIds.second; ++it ) {
+        unsigned long secondSrcId = *it;
+        long idx2 = lookup.srcid2scan[secondSrcId];
+        if ( idx2 < 0 ) {
+            continue;
+        }
+        const Scan &second = singleScans_[idx2];
+        const auto &secondSource = sourceList.getSource( secondSrcId );
+        const uint64_t *mask2 = &lookup.stationMasks[idx2 * lookup.nWords];
+
+        // scans must end within 600 seconds (independent of station split)
+        unsigned int secondTime = second.getTimes().getScanTime( Timestamp::end );
+        if ( util::absDiff( firstTime, secondTime ) > 600 ) {
+            continue;
+        }
+
+        uniqueSta1.clear();
+        uniqueSta2.clear();
+        intersection.clear();
+        for ( int idx = 0; idx < first.getNSta(); ++idx ) {
+            unsigned long staid = first.getStationId( idx );
+            if ( hasStation( mask2, staid ) ) {
+                intersection.push_back( staid );
+            } else {
+                uniqueSta1.push_back( staid );
+            }
+        }
+        for ( int idx = 0; idx < second.getNSta(); ++idx ) {
+            unsigned long staid = second.getStationId( idx );
+            if ( !hasStation( mask1, staid ) ) {
+                uniqueSta2.push_back( staid );
+            }
+        }
+
+        unsigned long scheduledSta = uniqueSta1.size() + uniqueSta2.size() + intersection.size();
+        if ( !subnetting->isAllowed( scheduledSta, lookup.availableSta ) ) {
+            continue;
+        }
+
+        // more than 2^63 splits could never be enumerated anyway
+        unsigned long nint = intersection.size();
+        if ( nint >= 64 ) {
+            continue;
+        }
+
+        uint64_t required1;
+        uint64_t required2;
+        if ( !requiredBits( firstSource, mask1, required1 ) || !requiredBits( secondSource, mask2, required2 ) ) {
+            continue;
+        }
+
+        unsigned long nBase1 = siteBitmasks( uniqueSta1, siteBits1 );
+        unsigned long nBase2 = siteBitmasks( uniqueSta2, siteBits2 );
+        unsigned int minSites1 = firstSource->getPARA().minNumberOfSites;
+        unsigned int minSites2 = secondSource->getPARA().minNumberOfSites;
+
+        // a set bit (nint-1-ii) moves shared station ii to the second scan. Splits are enumerated by number of
+        // stations in the second scan and ascending bitmask (same order as next_permutation over station groups)
+        uint64_t limit = uint64_t{ 1 } << nint;
+        auto nextSplit = [limit]( uint64_t split ) {
+            if ( split == 0 ) {
+                return limit;
+            }
+            uint64_t c = split & ( ~split + 1 );
+            uint64_t r = split + c;
+            return ( ( ( r ^ split ) >> 2 ) / c ) | r;
+        };
+
+        for ( unsigned long igroup = 0; igroup <= nint; ++igroup ) {
+            for ( uint64_t split = ( uint64_t{ 1 } << igroup ) - 1; split < limit; split = nextSplit( split ) ) {
+                if ( ( split & required1 ) != 0 || ( split & required2 ) != required2 ) {
+                    continue;
                 }
-                for ( int idx = 0; idx < second.getNSta(); ++idx ) {
-                    const PointingVector &pv = second.getPointingVector( idx );
-                    unsigned long staid = pv.getStaid();
 
-                    if ( !first.findIdxOfStationId( staid ) ) {
-                        uniqueSta2.push_back( staid );
+                uint64_t sites1 = 0;
+                uint64_t sites2 = 0;
+                for ( unsigned long ii = 0; ii < nint; ++ii ) {
+                    if ( split >> ( nint - 1 - ii ) & 1 ) {
+                        sites2 |= siteBits2[ii];
+                    } else {
+                        sites1 |= siteBits1[ii];
                     }
                 }
-                //                === VR2302 ===
-                //                unsigned long staid_oe = network.getStation("ONSA13NE").getId();
-                //                unsigned long staid_ow = network.getStation("ONSA13SW").getId();
-                //                if ( find(intersection.begin(), intersection.end(), staid_oe) != intersection.end() &&
-                //                     find(intersection.begin(), intersection.end(), staid_ow) != intersection.end()) {
-                //                    intersection.erase(find(intersection.begin(), intersection.end(), staid_oe));
-                //                    intersection.erase(find(intersection.begin(), intersection.end(), staid_ow));
-                //                    uniqueSta1.push_back(staid_oe);
-                //                    uniqueSta2.push_back(staid_ow);
-                //                }
-
-                unsigned long scheduledSta = uniqueSta1.size() + uniqueSta2.size() + intersection.size();
-                if ( !subnetting->isAllowed( scheduledSta, availableSta ) ) {
+                if ( nBase1 + bitset<64>( sites1 ).count() < minSites1 ||
+                     nBase2 + bitset<64>( sites2 ).count() < minSites2 ) {
                     continue;
                 }
 
-                unsigned long nint = intersection.size();
-
-                for ( int igroup = 0; igroup <= nint; ++igroup ) {
-                    vector<int> data( nint, 1 );
-                    for ( unsigned long ii = nint - igroup; ii < nint; ++ii ) {
-                        data.at( ii ) = 2;
+                scan1sta = uniqueSta1;
+                scan2sta = uniqueSta2;
+                for ( unsigned long ii = 0; ii < nint; ++ii ) {
+                    if ( split >> ( nint - 1 - ii ) & 1 ) {
+                        scan2sta.push_back( intersection[ii] );
+                    } else {
+                        scan1sta.push_back( intersection[ii] );
                     }
+                }
 
-                    do {
-                        vector<unsigned long> scan1sta{ uniqueSta1 };
-                        vector<unsigned long> scan2sta{ uniqueSta2 };
-                        for ( unsigned long ii = 0; ii < nint; ++ii ) {
-                            if ( data.at( ii ) == 1 ) {
-                                scan1sta.push_back( intersection[ii] );
-                            } else {
-                                scan2sta.push_back( intersection[ii] );
-                            }
-                        }
-
-                        //                                                === VR2301 ===
-                        //                        unsigned long independent_sta1 = scan1sta.size();
-                        //                        unsigned long independent_sta2 = scan2sta.size();
-                        //                        unsigned long staid_oe = network.getStation("ONSA13NE").getId();
-                        //                        unsigned long staid_ow = network.getStation("ONSA13SW").getId();
-                        //
-                        //                        if ( find_if(scan1sta.begin(), scan1sta.end(), [staid_oe](unsigned
-                        //                        long staid){return staid == staid_oe;}) != scan1sta.end() &&
-                        //                             find_if(scan1sta.begin(), scan1sta.end(), [staid_ow](unsigned
-                        //                             long staid){return staid == staid_ow;}) != scan1sta.end()){
-                        //                            --independent_sta1;
-                        //                        }
-                        //                        if ( find_if(scan2sta.begin(), scan2sta.end(), [staid_oe](unsigned
-                        //                        long staid){return staid == staid_oe;}) != scan2sta.end() &&
-                        //                             find_if(scan2sta.begin(), scan2sta.end(), [staid_ow](unsigned
-                        //                             long staid){return staid == staid_ow;}) != scan2sta.end()){
-                        //                            --independent_sta2;
-                        //                        }
-                        //
-                        //
-                        //                        if ( independent_sta1 >= sourceList.getSource( firstSrcId
-                        //                        )->getPARA().minNumberOfSites &&
-                        //                             independent_sta2 >= sourceList.getSource( secondSrcId
-                        //                             )->getPARA().minNumberOfSites ) {
-                        //                          === INSTEAD OF ===
-                        if ( Network::stationIdsToNSites( scan1sta ) >=
-                                 sourceList.getSource( firstSrcId )->getPARA().minNumberOfSites &&
-                             Network::stationIdsToNSites( scan2sta ) >=
-                                 sourceList.getSource( secondSrcId )->getPARA().minNumberOfSites ) {
-                            //                          === END OF VR2301 ===
-                            unsigned int firstTime = first.getTimes().getScanTime( Timestamp::end );
-                            unsigned int secondTime = second.getTimes().getScanTime( Timestamp::end );
-
-                            if ( util::absDiff( firstTime, secondTime ) > 600 ) {
-                                continue;
-                            }
-
-                            boost::optional<Scan> new_first =
-                                first.copyScan( scan1sta, sourceList.getSource( firstSrcId ) );
-                            if ( !new_first ) {
-                                continue;
-                            }
-
-                            boost::optional<Scan> new_second =
-                                second.copyScan( scan2sta, sourceList.getSource( secondSrcId ) );
-                            if ( !new_second ) {
-                                continue;
-                            }
+                boost::optional<Scan> new_first = first.copyScan( scan1sta, firstSource );
+                if ( !new_first ) {
+                    continue;
+                }
+
+                boost::optional<Scan> new_second = second.copyScan( scan2sta, secondSource );
+                if ( !new_second ) {
+                    continue;
+                }
 
 #ifdef VIESCHEDPP_LOG
-                            if ( Flags::logDebug )
-                                BOOST_LOG_TRIVIAL( debug )
-                                    << "subcon " << this->printId() << " add subnetting scans with "
-                                    << new_first->printId() << " and " << new_second->printId();
+                if ( Flags::logDebug )
+                    BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " add subnetting scans with "
+                                               << new_first->printId() << " and " << new_second->printId();
 #endif
 
-                            ++nSubnettingScans_;
-                            pair<Scan, Scan> tmp = make_pair( move( *new_first ), move( *new_second ) );
-                            //                            tmp.first = ;
-                            //                            tmp.second = ;
-                            subnettingScans_.push_back( move( tmp ) );
-                        }
-                    } while ( next_permutation( std::begin( data ), std::end( data ) ) );
-                }
+                scans.emplace_back( std::move( *new_first ), std::move( *new_second ) );
             }
         }
     }
+
+    return scans;
 }
 
 
-void Subcon::generateScore( const Network &network, const SourceList &sourceList ) noexcept {
+void Subcon::generateScore( const Network &network, const SourceList &sourceList,
+                            const SchedulingContext &context ) noexcept {
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " generate scores ";
 #endif
 
-    precalcScore( network, sourceList );
-    //    unsigned long nmaxsta = stations.size();
+    precalcScore( network, sourceList, context.weightFactors );
+
+    // additive score terms of all scans are calculated at once
+    ScoreKernel kernel( network, astas_, asrcs_, abls_, idle_, minRequiredTime_, maxRequiredTime_,
+                        context.weightFactors );
+    kernel.reserve( nSingleScans_ + 2 * nSubnettingScans_ );
+    for ( const auto &thisScan : singleScans_ ) {
+        kernel.add( thisScan, sourceList.getSource( thisScan.getSourceId() ) );
+    }
+    for ( const auto &thisScans : subnettingScans_ ) {
+        kernel.add( thisScans.first, sourceList.getSource( thisScans.first.getSourceId() ) );
+        kernel.add( thisScans.second, sourceList.getSource( thisScans.second.getSourceId() ) );
+    }
+    vector<double> firstPartScores = kernel.evaluate();
+
+    unsigned long iscan = 0;
     vector<unordered_map<unsigned long, double>> staids2skyCoverageScores( sourceList.getNSrc() );
     for ( auto &thisScan : singleScans_ ) {
         unsigned long srcid = thisScan.getSourceId();
         unordered_map<unsigned long, double> &staids2skyCoverageScore = staids2skyCoverageScores[srcid];
         const auto &thisSource = sourceList.getSource( srcid );
-        thisScan.calcScore( astas_, asrcs_, abls_, minRequiredTime_, maxRequiredTime_, network, thisSource,
-                            staids2skyCoverageScore, idle_ );
+        thisScan.calcScore( firstPartScores[iscan++], network, thisSource, staids2skyCoverageScore, context );
     }
 
     for ( auto &thisScans : subnettingScans_ ) {
@@ -504,28 +644,27 @@ void Subcon::generateScore( const Network &network, const SourceList &sourceList
         unsigned long srcid1 = thisScan1.getSourceId();
         const auto &thisSource1 = sourceList.getSource( srcid1 );
         const unordered_map<unsigned long, double> &staids2skyCoverageScore1 = staids2skyCoverageScores[srcid1];
-        thisScan1.calcScore_subnetting( astas_, asrcs_, abls_, minRequiredTime_, maxRequiredTime_, network, thisSource1,
-                                        staids2skyCoverageScore1, idle_ );
-        //        double score1 = thisScan1.getScore();
+        thisScan1.calcScore_subnetting( firstPartScores[iscan++], network, thisSource1, staids2skyCoverageScore1,
+                                        context );
 
         Scan &thisScan2 = thisScans.second;
         unsigned long srcid2 = thisScan2.getSourceId();
         const auto &thisSource2 = sourceList.getSource( srcid2 );
         const unordered_map<unsigned long, double> &staids2skyCoverageScore2 = staids2skyCoverageScores[srcid2];
-        thisScan2.calcScore_subnetting( astas_, asrcs_, abls_, minRequiredTime_, maxRequiredTime_, network, thisSource2,
-                                        staids2skyCoverageScore2, idle_ );
-        //        double score2 = thisScan2.getScore();
+        thisScan2.calcScore_subnetting( firstPartScores[iscan++], network, thisSource2, staids2skyCoverageScore2,
+                                        context );
     }
 }
 
 
 void Subcon::generateScore( const Network &network, const SourceList &sourceList,
-                            const std::vector<std::map<unsigned long, double>> &hiscores, unsigned int interval ) {
+                            const std::vector<std::map<unsigned long, double>> &hiscores, unsigned int interval,
+                            const SchedulingContext &context ) {
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " generate scores ";
 #endif
 
-    precalcScore( network, sourceList );
+    precalcScore( network, sourceList, context.weightFactors );
     //    unsigned long nmaxsta = stations.size();
     for ( auto &thisScan : singleScans_ ) {
         vector<double> firstScorePerPv( thisScan.getNSta(), 0 );
@@ -533,7 +672,7 @@ void Subcon::generateScore( const Network &network, const SourceList &sourceList
         unsigned int iTime = thisScan.getTimes().getObservingTime( Timestamp::start ) / interval;
         const map<unsigned long, double> &thisMap = hiscores[iTime];
         double hiscore = thisMap.at( thisSource->getId() );
-        thisScan.calcScore( minRequiredTime_, maxRequiredTime_, network, thisSource, hiscore, false );
+        thisScan.calcScore( minRequiredTime_, maxRequiredTime_, network, thisSource, hiscore, false, context );
     }
 
     for ( auto &thisScans : subnettingScans_ ) {
@@ -543,7 +682,7 @@ void Subcon::generateScore( const Network &network, const SourceList &sourceList
         unsigned int iTime1 = thisScan1.getTimes().getObservingTime( Timestamp::start ) / interval;
         const map<unsigned long, double> &thisMap1 = hiscores[iTime1];
         double hiscore1 = thisMap1.at( thisSource1->getId() );
-        thisScan1.calcScore( minRequiredTime_, maxRequiredTime_, network, thisSource1, hiscore1, true );
+        thisScan1.calcScore( minRequiredTime_, maxRequiredTime_, network, thisSource1, hiscore1, true, context );
         //        double score1 = thisScan1.getScore();
 
         Scan &thisScan2 = thisScans.second;
@@ -552,7 +691,7 @@ void Subcon::generateScore( const Network &network, const SourceList &sourceList
         unsigned int iTime2 = thisScan2.getTimes().getObservingTime( Timestamp::start ) / interval;
         const map<unsigned long, double> &thisMap2 = hiscores[iTime2];
         double hiscore2 = thisMap2.at( thisSource2->getId() );
-        thisScan2.calcScore( minRequiredTime_, maxRequiredTime_, network, thisSource2, hiscore2, true );
+        thisScan2.calcScore( minRequiredTime_, maxRequiredTime_, network, thisSource2, hiscore2, true, context );
         //        double score2 = thisScan2.getScore();
     }
 }
@@ -560,7 +699,7 @@ void Subcon::generateScore( const Network &network, const SourceList &sourceList
 
 void Subcon::generateScore( const std::vector<double> &lowElevatrionScore,
                             const std::vector<double> &highElevationScore, const Network &network,
-                            const SourceList &sourceList ) {
+                            const SourceList &sourceList, const SchedulingContext &context ) {
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " generate scores ";
 #endif
@@ -574,7 +713,8 @@ void Subcon::generateScore( const std::vector<double> &lowElevatrionScore,
         Scan &thisScan = singleScans_[i];
 
         bool valid = thisScan.calcScore( lowElevatrionScore, highElevationScore, network, minRequiredTime_,
-                                         maxRequiredTime_, sourceList.getSource( thisScan.getSourceId() ), false );
+                                         maxRequiredTime_, sourceList.getSource( thisScan.getSourceId() ), false,
+                                         context );
         if ( valid ) {
             ++i;
         } else {
@@ -588,13 +728,15 @@ void Subcon::generateScore( const std::vector<double> &lowElevatrionScore,
         Scan &thisScan1 = subnettingScans_[i].first;
 
         bool valid1 = thisScan1.calcScore( lowElevatrionScore, highElevationScore, network, minRequiredTime_,
-                                           maxRequiredTime_, sourceList.getSource( thisScan1.getSourceId() ), true );
+                                           maxRequiredTime_, sourceList.getSource( thisScan1.getSourceId() ), true,
+                                           context );
         //        double score1 = thisScan1.getScore();
 
         Scan &thisScan2 = subnettingScans_[i].second;
 
         bool valid2 = thisScan2.calcScore( lowElevatrionScore, highElevationScore, network, minRequiredTime_,
-                                           maxRequiredTime_, sourceList.getSource( thisScan2.getSourceId() ), true );
+                                           maxRequiredTime_, sourceList.getSource( thisScan2.getSourceId() ), true,
+                                           context );
         //        double score2 = thisScan2.getScore();
 
         if ( valid1 && valid2 ) {
@@ -607,7 +749,7 @@ void Subcon::generateScore( const std::vector<double> &lowElevatrionScore,
 }
 
 void Subcon::generateCalibratorScore( const Network &network, const SourceList &sourceList,
-                                      const std::shared_ptr<const Mode> &mode ) {
+                                      const std::shared_ptr<const Mode> &mode, const SchedulingContext &context ) {
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " generate scores ";
 #endif
@@ -628,7 +770,7 @@ void Subcon::generateCalibratorScore( const Network &network, const SourceList &
             double meanSNR = thisScan.getAverageSNR( network, source, mode );
             thisScan.calcScoreCalibrator( network, source, astas_, abls_, meanSNR, minRequiredTime_, maxRequiredTime_ );
             if ( CalibratorBlock::tryToIncludeAllStationFlag ) {
-                checkCalibratorScores( thisScan );
+                checkCalibratorScores( thisScan, context );
             }
         } else if ( type == Scan::ScanType::parallacticAngle ) {
             double meanSNR = thisScan.getAverageSNR( network, source, mode );
@@ -636,7 +778,7 @@ void Subcon::generateCalibratorScore( const Network &network, const SourceList &
 
         } else if ( type == Scan::ScanType::diffParallacticAngle ) {
             vector<double> snrs = thisScan.getSNRs( network, source, mode );
-            thisScan.calcScoreDPar( network, source, snrs );
+            thisScan.calcScoreDPar( network, source, snrs, context );
         } else {
             terminate();
         }
@@ -657,7 +799,7 @@ void Subcon::generateCalibratorScore( const Network &network, const SourceList &
                                            maxRequiredTime_ );
 
             if ( CalibratorBlock::tryToIncludeAllStationFlag ) {
-                checkCalibratorScores( thisScan1, thisScan2 );
+                checkCalibratorScores( thisScan1, thisScan2, context );
             }
 
         } else if ( type == Scan::ScanType::parallacticAngle ) {
@@ -669,10 +811,10 @@ void Subcon::generateCalibratorScore( const Network &network, const SourceList &
 
         } else if ( type == Scan::ScanType::diffParallacticAngle ) {
             vector<double> snrs1 = thisScan1.getSNRs( network, source1, mode );
-            thisScan1.calcScoreDPar( network, source1, snrs1 );
+            thisScan1.calcScoreDPar( network, source1, snrs1, context );
 
             vector<double> snrs2 = thisScan2.getSNRs( network, source2, mode );
-            thisScan2.calcScoreDPar( network, source2, snrs2 );
+            thisScan2.calcScoreDPar( network, source2, snrs2, context );
 
         } else {
             terminate();
@@ -743,7 +885,7 @@ void Subcon::prepareAverageScore( const SourceList &sourceList ) noexcept {
 }
 
 
-void Subcon::prepareIdleTimeScore( const std::vector<Station> &stations ) noexcept {
+void Subcon::prepareIdleTimeScore( const std::vector<Station> &stations, unsigned int interval ) noexcept {
     unsigned int maxTime = 0;
     for ( const auto &thisStation : stations ) {
         if ( thisStation.getCurrentTime() > maxTime ) {
@@ -751,10 +893,9 @@ void Subcon::prepareIdleTimeScore( const std::vector<Station> &stations ) noexce
         }
     }
 
-    double interval = WeightFactors::idleTimeInterval;
     for ( const auto &thisStation : stations ) {
         unsigned int thisIdleTime = maxTime - thisStation.getCurrentTime();
-        double thisScore = static_cast<double>( thisIdleTime ) / interval;
+        double thisScore = static_cast<double>( thisIdleTime ) / static_cast<double>( interval );
         idle_.push_back( thisScore );
     }
 }
@@ -787,29 +928,30 @@ std::vector<double> Subcon::prepareAverageScore_base( const std::vector<unsigned
 }
 
 
-void Subcon::precalcScore( const Network &network, const SourceList &sourceList ) noexcept {
-    if ( WeightFactors::weightDuration != 0 ) {
+void Subcon::precalcScore( const Network &network, const SourceList &sourceList,
+                           const WeightFactors &weightFactors ) noexcept {
+    if ( weightFactors.weightDuration != 0 ) {
         minMaxTime();
     }
-    if ( WeightFactors::weightAverageStations != 0 ) {
+    if ( weightFactors.weightAverageStations != 0 ) {
         prepareAverageScore( network.getStations() );
     }
-    if ( WeightFactors::weightAverageBaselines != 0 ) {
+    if ( weightFactors.weightAverageBaselines != 0 ) {
         prepareAverageScore( network.getBaselines() );
     }
-    if ( WeightFactors::weightAverageSources != 0 ) {
+    if ( weightFactors.weightAverageSources != 0 ) {
         prepareAverageScore( sourceList );
     }
-    if ( WeightFactors::weightIdleTime != 0 ) {
-        prepareIdleTimeScore( network.getStations() );
+    if ( weightFactors.weightIdleTime != 0 ) {
+        prepareIdleTimeScore( network.getStations(), weightFactors.idleTimeInterval );
     }
 }
 
 
 vector<Scan> Subcon::selectBest( Network &network, const SourceList &sourceList,
-                                 const std::shared_ptr<const Mode> &mode,
+                                 const std::shared_ptr<const Mode> &mode, const SchedulingContext &context,
                                  const boost::optional<StationEndposition> &endposition ) noexcept {
-    return selectBest( network, sourceList, mode, vector<double>(), vector<double>(), endposition );
+    return selectBest( network, sourceList, mode, vector<double>(), vector<double>(), context, endposition );
 }
 
 
@@ -817,6 +959,7 @@ vector<Scan> Subcon::selectBest( Network &network, const SourceList &sourceList,
                                  const std::shared_ptr<const Mode> &mode,
                                  const std::vector<double> &prevLowElevationScores,
                                  const std::vector<double> &prevHighElevationScores,
+                                 const SchedulingContext &context,
                                  const boost::optional<StationEndposition> &endposition ) noexcept {
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " select best scan ";
@@ -886,17 +1029,17 @@ vector<Scan> Subcon::selectBest( Network &network, const SourceList &sourceList,
     }
     vector<unsigned long> scansToRemove;
 
-    // loop through queue
-    unsigned long idx;
-    while ( true ) {
-        if ( q.empty() ) {
-            return bestScans;
-        }
-
-        // get index of scan(s) with highest score and remove it from list
-        idx = q.top().second;
-        q.pop();
+    // lazy evaluation: the queue holds the score before the rigorous update for all candidates which were not yet
+    // updated and the updated score for all rigorously updated candidates. The score before the rigorous update is
+    // only an estimate used for ordering, it is no upper bound of the updated score
+    vector<char> verified;
+    if ( lazyEvaluation_ ) {
+        verified = vector<char>( scores.size(), false );
+    }
 
+    // rigorous update and new score of the scan(s) with index idx. Returns false if the scan(s) are no longer valid,
+    // remove is set if they have to be removed from the subcon
+    auto updateCandidate = [&]( unsigned long idx, double &score, bool &remove ) -> bool {
         // distinguish between single source scan and subnetting scans
         if ( idx < nSingleScans_ ) {
             unsigned long thisIdx = idx;
@@ -911,38 +1054,39 @@ vector<Scan> Subcon::selectBest( Network &network, const SourceList &sourceList,
 
             const auto &thisSource = sourceList.getSource( thisScan.getSourceId() );
             // make rigorous update
+            ++nRigorousUpdates_;
             bool flag = thisScan.rigorousUpdate( network, thisSource, mode, endposition );
             if ( !flag ) {
-                scansToRemove.push_back( idx );
+                remove = true;
 #ifdef VIESCHEDPP_LOG
                 if ( Flags::logDebug )
                     BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan.printId()
                                                << " no longer valid -> removed";
 #endif
-                continue;
+                return false;
             }
 
             // calculate score again
             if ( thisScan.getType() == Scan::ScanType::astroCalibrator ) {
                 // special case for calibrator block
                 bool valid = thisScan.calcScore( prevLowElevationScores, prevHighElevationScores, network,
-                                                 minRequiredTime_, maxRequiredTime_, thisSource, false );
+                                                 minRequiredTime_, maxRequiredTime_, thisSource, false, context );
 
                 if ( !valid ) {
-                    scansToRemove.push_back( idx );
+                    remove = true;
 #ifdef VIESCHEDPP_LOG
                     if ( Flags::logDebug )
                         BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan.printId()
                                                    << " no longer valid -> removed";
 #endif
-                    continue;
+                    return false;
                 }
             } else if ( thisScan.getType() == Scan::ScanType::fringeFinder ) {
                 double meanSNR = thisScan.getAverageSNR( network, thisSource, mode );
                 thisScan.calcScoreCalibrator( network, thisSource, astas_, abls_, meanSNR, minRequiredTime_,
                                               maxRequiredTime_ );
                 if ( CalibratorBlock::tryToIncludeAllStationFlag ) {
-                    checkCalibratorScores( thisScan );
+                    checkCalibratorScores( thisScan, context );
                 }
 
             } else if ( thisScan.getType() == Scan::ScanType::parallacticAngle ) {
@@ -951,16 +1095,15 @@ vector<Scan> Subcon::selectBest( Network &network, const SourceList &sourceList,
 
             } else if ( thisScan.getType() == Scan::ScanType::diffParallacticAngle ) {
                 vector<double> snrs = thisScan.getSNRs( network, thisSource, mode );
-                thisScan.calcScoreDPar( network, thisSource, snrs );
+                thisScan.calcScoreDPar( network, thisSource, snrs, context );
 
             } else {
                 // standard case
                 thisScan.calcScore( astas_, asrcs_, abls_, minRequiredTime_, maxRequiredTime_, network, thisSource,
-                                    false, idle_ );
+                                    false, idle_, context );
             }
 
-            // push score in queue
-            q.push( make_pair( thisScan.getScore(), idx ) );
+            score = thisScan.getScore();
 
         } else {
             unsigned long thisIdx = idx - nSingleScans_;
@@ -979,26 +1122,28 @@ vector<Scan> Subcon::selectBest( Network &network, const SourceList &sourceList,
 #endif
 
             // make rigorous update
+            ++nRigorousUpdates_;
             bool flag1 = thisScan1.rigorousUpdate( network, thisSource1, mode, endposition );
             if ( !flag1 ) {
-                scansToRemove.push_back( idx );
+                remove = true;
 #ifdef VIESCHEDPP_LOG
                 if ( Flags::logDebug )
                     BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan1.printId()
                                                << " no longer valid -> removed";
 #endif
 
-                continue;
+                return false;
             }
+            ++nRigorousUpdates_;
             bool flag2 = thisScan2.rigorousUpdate( network, thisSource2, mode, endposition );
             if ( !flag2 ) {
-                scansToRemove.push_back( idx );
+                remove = true;
 #ifdef VIESCHEDPP_LOG
                 if ( Flags::logDebug )
                     BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan2.printId()
                                                << " no longer valid -> removed";
 #endif
-                continue;
+                return false;
             }
 
             // check time differences between subnetting scans
@@ -1011,26 +1156,26 @@ vector<Scan> Subcon::selectBest( Network &network, const SourceList &sourceList,
                     BOOST_LOG_TRIVIAL( debug )
                         << "subcon " << this->printId() << " too much time between subnetting scans -> removed";
 #endif
-                continue;
+                return false;
             }
 
             // calculate score again
             if ( thisScan1.getType() == Scan::ScanType::astroCalibrator ) {
                 // special case for calibrator block
                 bool valid1 = thisScan1.calcScore( prevLowElevationScores, prevHighElevationScores, network,
-                                                   minRequiredTime_, maxRequiredTime_, thisSource1, true );
+                                                   minRequiredTime_, maxRequiredTime_, thisSource1, true, context );
 
                 bool valid2 = thisScan2.calcScore( prevLowElevationScores, prevHighElevationScores, network,
-                                                   minRequiredTime_, maxRequiredTime_, thisSource2, true );
+                                                   minRequiredTime_, maxRequiredTime_, thisSource2, true, context );
 
                 if ( !valid1 || !valid2 ) {
-                    scansToRemove.push_back( idx );
+                    remove = true;
 #ifdef VIESCHEDPP_LOG
                     if ( Flags::logDebug )
                         BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan1.printId()
                                                    << " and " << thisScan2.printId() << " no longer valid -> removed";
 #endif
-                    continue;
+                    return false;
                 }
             } else if ( thisScan1.getType() == Scan::ScanType::fringeFinder ) {
                 double meanSNR1 = thisScan1.getAverageSNR( network, thisSource1, mode );
@@ -1042,7 +1187,7 @@ vector<Scan> Subcon::selectBest( Network &network, const SourceList &sourceList,
                                                maxRequiredTime_ );
 
                 if ( CalibratorBlock::tryToIncludeAllStationFlag ) {
-                    checkCalibratorScores( thisScan1, thisScan2 );
+                    checkCalibratorScores( thisScan1, thisScan2, context );
                 }
             } else if ( thisScan1.getType() == Scan::ScanType::parallacticAngle ) {
                 double meanSNR1 = thisScan1.getAverageSNR( network, thisSource1, mode );
@@ -1053,20 +1198,19 @@ vector<Scan> Subcon::selectBest( Network &network, const SourceList &sourceList,
 
             } else if ( thisScan1.getType() == Scan::ScanType::diffParallacticAngle ) {
                 vector<double> snrs1 = thisScan1.getSNRs( network, thisSource1, mode );
-                thisScan1.calcScoreDPar( network, thisSource1, snrs1 );
+                thisScan1.calcScoreDPar( network, thisSource1, snrs1, context );
 
                 vector<double> snrs2 = thisScan1.getSNRs( network, thisSource2, mode );
-                thisScan2.calcScoreDPar( network, thisSource2, snrs2 );
+                thisScan2.calcScoreDPar( network, thisSource2, snrs2, context );
 
             } else {
                 // standard case
                 thisScan1.calcScore( astas_, asrcs_, abls_, minRequiredTime_, maxRequiredTime_, network, thisSource1,
-                                     true, idle_ );
+                                     true, idle_, context );
                 thisScan2.calcScore( astas_, asrcs_, abls_, minRequiredTime_, maxRequiredTime_, network, thisSource2,
-                                     true, idle_ );
+                                     true, idle_, context );
             }
 
-            // push score in queue
             //            === VR2302 ===
             //            unsigned long staid_oe = network.getStation("ONSA13NE").getId();
             //            unsigned long staid_ow = network.getStation("ONSA13SW").getId();
@@ -1079,9 +1223,51 @@ vector<Scan> Subcon::selectBest( Network &network, const SourceList &sourceList,
             //            }
             //            q.push( make_pair( (thisScan1.getScore() + thisScan2.getScore()) * factor, idx ) );
             //            === instead of ===
-            q.push( make_pair( thisScan1.getScore() + thisScan2.getScore(), idx ) );
+            score = thisScan1.getScore() + thisScan2.getScore();
             //            === end of VR2302 ===
         }
+        return true;
+    };
+
+    // loop through queue
+    unsigned long idx;
+    while ( true ) {
+        if ( q.empty() ) {
+            return bestScans;
+        }
+
+        // get index of scan(s) with highest score and remove it from list
+        idx = q.top().second;
+        q.pop();
+
+        // an already updated candidate has the highest score. The eager selection would update it again and select
+        // it if its score does not change, lazy evaluation selects it directly without repeating the update. This is
+        // a heuristic shortcut, the repeated update could change the score or invalidate the candidate
+        if ( lazyEvaluation_ && verified[idx] ) {
+            nSkippedReupdates_ += idx < nSingleScans_ ? 1 : 2;
+#ifdef VIESCHEDPP_LOG
+            if ( Flags::logDebug )
+                BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " already updated scan(s) with index "
+                                           << idx << " have highest score";
+#endif
+            break;
+        }
+
+        double score = 0;
+        bool remove = false;
+        if ( !updateCandidate( idx, score, remove ) ) {
+            if ( remove ) {
+                scansToRemove.push_back( idx );
+            }
+            continue;
+        }
+
+        // push score in queue
+        q.push( make_pair( score, idx ) );
+
+        if ( lazyEvaluation_ ) {
+            verified[idx] = true;
+        }
 
         // check if newly added score is again the highest score in the queue. If yes this is/are our selected
         // scan/scans
@@ -1310,6 +1496,133 @@ void Subcon::changeType( const SourceList &sourceList, Scan::ScanType type ) {
 void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const Network &network,
                           shared_ptr<const AbstractSource> thisSource, std::set<unsigned long> observedSources,
                           bool doNotObserveSourcesWithinMinRepeat ) {
+    boost::optional<Scan> scan =
+        createVisibleScan( currentTime, type, network, thisSource, observedSources, doNotObserveSourcesWithinMinRepeat );
+    if ( scan.is_initialized() ) {
+        addScan( std::move( *scan ) );
+    }
+}
+
+
+void Subcon::createCandidates( unsigned int currentTime, Scan::ScanType type, const Network &network,
+                               const SourceList &sourceList, const std::set<unsigned long> &observedSources,
+                               bool doNotObserveSourcesWithinMinRepeat, const std::shared_ptr<const Mode> &mode,
+                               const boost::optional<StationEndposition> &endposition, int nThreads,
+                               CandidatePool *pool ) {
+#ifdef VIESCHEDPP_LOG
+    if ( Flags::logDebug )
+        BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " create candidate scans using " << nThreads
+                                   << " threads";
+#endif
+
+    // one slot per source, filled independently by each thread. Concatenating the slots in source order afterwards
+    // results in the same scans (and ordering) as the serial calcStartTimes, updateAzEl, ... sequence
+    const auto &sources = sourceList.getSources();
+    auto nsrc = static_cast<long>( sources.size() );
+    vector<boost::optional<Scan>> candidates( sources.size() );
+
+    // pointing vectors of visible scans which had to be recalculated (only required for candidate pool)
+    vector<boost::optional<vector<PointingVector>>> recalculated( pool != nullptr ? sources.size() : 0 );
+    unsigned long nReused = 0;
+    unsigned long nRecalculated = 0;
+    long long int usecRecalculated = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads( nThreads ) schedule( dynamic, 16 ) \
+    reduction( + : nReused, nRecalculated, usecRecalculated )
+#endif
+    for ( long isrc = 0; isrc < nsrc; ++isrc ) {
+        const auto &thisSource = sources[isrc];
+        if ( pool == nullptr ) {
+            candidates[isrc] = createCandidate( currentTime, type, network, thisSource, observedSources,
+                                                doNotObserveSourcesWithinMinRepeat, mode, endposition );
+            continue;
+        }
+
+        // visibility, minimum repeat time and number of scans are always checked again. Only the remaining steps
+        // are skipped if the candidate pool still holds a valid candidate for the same stations
+        boost::optional<Scan> scan = createVisibleScan( currentTime, type, network, thisSource, observedSources,
+                                                        doNotObserveSourcesWithinMinRepeat );
+        if ( !scan.is_initialized() ) {
+            continue;
+        }
+        if ( pool->lookup( *scan, candidates[isrc] ) ) {
+            ++nReused;
+            continue;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        recalculated[isrc] = vector<PointingVector>();
+        for ( int i = 0; i < static_cast<int>( scan->getNSta() ); ++i ) {
+            recalculated[isrc]->push_back( scan->getPointingVector( i ) );
+        }
+        if ( processCandidate( *scan, network, thisSource, mode, endposition ) ) {
+            candidates[isrc] = std::move( scan );
+        }
+        auto finish = std::chrono::steady_clock::now();
+        usecRecalculated += std::chrono::duration_cast<std::chrono::microseconds>( finish - start ).count();
+        ++nRecalculated;
+    }
+
+    if ( pool != nullptr ) {
+        for ( long isrc = 0; isrc < nsrc; ++isrc ) {
+            if ( recalculated[isrc].is_initialized() ) {
+                pool->store( sources[isrc]->getId(), type, std::move( *recalculated[isrc] ), candidates[isrc] );
+            }
+        }
+        pool->addStatistics( nReused, nRecalculated, usecRecalculated );
+    }
+
+    // ids are drawn in thread order inside the loop, renumber in source order to get reproducible ids
+    for ( auto &candidate : candidates ) {
+        if ( candidate.is_initialized() ) {
+            candidate->giveNewIds();
+            addScan( std::move( *candidate ) );
+        }
+    }
+}
+
+
+boost::optional<Scan> Subcon::createCandidate( unsigned int currentTime, Scan::ScanType type, const Network &network,
+                                               const std::shared_ptr<const AbstractSource> &thisSource,
+                                               const std::set<unsigned long> &observedSources,
+                                               bool doNotObserveSourcesWithinMinRepeat,
+                                               const std::shared_ptr<const Mode> &mode,
+                                               const boost::optional<StationEndposition> &endposition ) const {
+    boost::optional<Scan> scan =
+        createVisibleScan( currentTime, type, network, thisSource, observedSources, doNotObserveSourcesWithinMinRepeat );
+    if ( !scan.is_initialized() || !processCandidate( *scan, network, thisSource, mode, endposition ) ) {
+        return boost::none;
+    }
+    return scan;
+}
+
+
+bool Subcon::processCandidate( Scan &thisScan, const Network &network,
+                               const std::shared_ptr<const AbstractSource> &thisSource,
+                               const std::shared_ptr<const Mode> &mode,
+                               const boost::optional<StationEndposition> &endposition ) const {
+    // same sequence of steps as in Scheduler::createSubcon
+    if ( !calcStartTimes( thisScan, network, thisSource, endposition ) ||
+         !updateAzEl( thisScan, network, thisSource ) || !thisScan.constructObservations( network, thisSource ) ||
+         !thisScan.calcObservationDuration( network, thisSource, mode ) ||
+         !calcScanDuration( thisScan, network, thisSource, endposition ) ) {
+#ifdef VIESCHEDPP_LOG
+        if ( Flags::logDebug )
+            BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan.printId()
+                                       << " no longer valid -> removed";
+#endif
+        return false;
+    }
+    return true;
+}
+
+
+boost::optional<Scan> Subcon::createVisibleScan( unsigned int currentTime, Scan::ScanType type,
+                                                 const Network &network,
+                                                 const std::shared_ptr<const AbstractSource> &thisSource,
+                                                 const std::set<unsigned long> &observedSources,
+                                                 bool doNotObserveSourcesWithinMinRepeat ) const {
     unsigned long srcid = thisSource->getId();
 
     if ( !thisSource->getPARA().available || !thisSource->getPARA().globalAvailable ) {
@@ -1318,7 +1631,7 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
             BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " source " << thisSource->getName()
                                        << " not available";
 #endif
-        return;
+        return boost::none;
     }
 
     if ( type == Scan::ScanType::fillin && !thisSource->getPARA().availableForFillinmode ) {
@@ -1327,7 +1640,7 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
             BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " source " << thisSource->getName()
                                        << " not available for fillin mode";
 #endif
-        return;
+        return boost::none;
     }
 
     if ( type == Scan::ScanType::astroCalibrator &&
@@ -1339,7 +1652,7 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
             BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " source " << thisSource->getName()
                                        << " not available as calibrator";
 #endif
-        return;
+        return boost::none;
     }
 
     if ( observedSources.find( srcid ) != observedSources.end() ) {
@@ -1348,7 +1661,7 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
             BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " source " << thisSource->getName()
                                        << " not available - already observed in next scans";
 #endif
-        return;
+        return boost::none;
     }
 
     if ( thisSource->getNscans() > 0 && doNotObserveSourcesWithinMinRepeat &&
@@ -1358,7 +1671,7 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
             BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " source " << thisSource->getName()
                                        << " not available - observed recently";
 #endif
-        return;
+        return boost::none;
     }
 
     if ( thisSource->getNscans() > 0 &&
@@ -1368,7 +1681,7 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
             BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " source " << thisSource->getName()
                                        << " not available - observed recently";
 #endif
-        return;
+        return boost::none;
     }
 
     if ( thisSource->getNscans() >= thisSource->getPARA().maxNumberOfScans ) {
@@ -1377,7 +1690,7 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
             BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " source " << thisSource->getName()
                                        << " not available - max number of scans reached";
 #endif
-        return;
+        return boost::none;
     }
 
 #ifdef VIESCHEDPP_LOG
@@ -1498,33 +1811,34 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
                 }
             }
             if ( !found ) {
-                return;
+                return boost::none;
             }
         }
     }
 
     if ( Network::stationIdsToNSites( visibleSites ) >= thisSource->getPARA().minNumberOfSites ) {
-        addScan( Scan( pointingVectors, endOfLastScans, type ) );
+        return Scan( pointingVectors, endOfLastScans, type );
     } else if ( visibleSta == availableSta && availableSta >= 2 ) {
-        addScan( Scan( pointingVectors, endOfLastScans, type ) );
+        return Scan( pointingVectors, endOfLastScans, type );
     }
+    return boost::none;
 }
 
 
-void Subcon::checkCalibratorScores( Scan &scan1, Scan &scan2 ) {
-    double maxMultiplier = CalibratorBlock::stationFlag.size() -
-                           accumulate( CalibratorBlock::stationFlag.begin(), CalibratorBlock::stationFlag.end(), .0 );
+void Subcon::checkCalibratorScores( Scan &scan1, Scan &scan2, const SchedulingContext &context ) {
+    const vector<char> &stationFlag = context.calibratorStationFlag;
+    double maxMultiplier = stationFlag.size() - accumulate( stationFlag.begin(), stationFlag.end(), .0 );
 
     double multiplier = 0;
     for ( int i = 0; i < scan1.getNSta(); ++i ) {
         unsigned long staid = scan1.getStationId( i );
-        if ( CalibratorBlock::stationFlag[staid] == false ) {
+        if ( stationFlag[staid] == false ) {
             ++multiplier;
         }
     }
     for ( int i = 0; i < scan2.getNSta(); ++i ) {
         unsigned long staid = scan2.getStationId( i );
-        if ( CalibratorBlock::stationFlag[staid] == false ) {
+        if ( stationFlag[staid] == false ) {
             ++multiplier;
         }
     }
@@ -1534,14 +1848,14 @@ void Subcon::checkCalibratorScores( Scan &scan1, Scan &scan2 ) {
     scan2.scaleScore( factor );
 }
 
-void Subcon::checkCalibratorScores( Scan &scan1 ) {
-    double maxMultiplier = CalibratorBlock::stationFlag.size() -
-                           accumulate( CalibratorBlock::stationFlag.begin(), CalibratorBlock::stationFlag.end(), .0 );
+void Subcon::checkCalibratorScores( Scan &scan1, const SchedulingContext &context ) {
+    const vector<char> &stationFlag = context.calibratorStationFlag;
+    double maxMultiplier = stationFlag.size() - accumulate( stationFlag.begin(), stationFlag.end(), .0 );
 
     double multiplier = 0;
     for ( int i = 0; i < scan1.getNSta(); ++i ) {
         unsigned long staid = scan1.getStationId( i );
-        if ( CalibratorBlock::stationFlag[staid] == false ) {
+        if ( stationFlag[staid] == false ) {
             ++multiplier;
         }
     }
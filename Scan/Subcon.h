@@ -28,7 +28,10 @@
 #define SUBCON_H
 
 
+#include <bitset>
 #include <boost/optional.hpp>
+#include <chrono>
+#include <cstdint>
 #include <limits>
 #include <numeric>
 #include <queue>
@@ -40,7 +43,9 @@
 #include "../Source/AbstractSource.h"
 #include "../Source/SourceList.h"
 #include "../Station/Network.h"
+#include "CandidatePool.h"
 #include "Scan.h"
+#include "ScoreKernel.h"
 
 
 namespace VieVS {
@@ -189,12 +194,18 @@ class Subcon : public VieVS_Object {
      * @brief create all subnetting scans from possible single source scans
      * @author Matthias Schartner
      *
+     * Partner scans are found via a source id to scan index table and the stations of each scan are stored as
+     * bitmask. Splits of the shared stations are enumerated as bitmasks and splits that violate the minimum number of
+     * sites or required stations are rejected before any scan is copied. Source pairs are processed independently
+     * (using nThreads OpenMP threads) and the resulting scans are added in the same order as in the serial version.
+     *
      * @param subnetting subnetting parameters
      * @param network station network
      * @param sourceList list of all sources
+     * @param nThreads number of threads
      */
     void createSubnettingScans( const std::shared_ptr<Subnetting> &subnetting, const Network &network,
-                                const SourceList &sourceList ) noexcept;
+                                const SourceList &sourceList, int nThreads = 1 ) noexcept;
 
 
     /**
@@ -203,8 +214,10 @@ class Subcon : public VieVS_Object {
      *
      * @param network station network
      * @param sourceList list of all sources
+     * @param context scheduling context
      */
-    void generateScore( const Network &network, const SourceList &sourceList ) noexcept;
+    void generateScore( const Network &network, const SourceList &sourceList,
+                        const SchedulingContext &context ) noexcept;
 
 
     /**
@@ -215,9 +228,10 @@ class Subcon : public VieVS_Object {
      * @param highElevationScore high elevation score
      * @param network station network
      * @param sourceList list of all sources
+     * @param context scheduling context
      */
     void generateScore( const std::vector<double> &lowElevatrionScore, const std::vector<double> &highElevationScore,
-                        const Network &network, const SourceList &sourceList );
+                        const Network &network, const SourceList &sourceList, const SchedulingContext &context );
 
 
     /**
@@ -228,9 +242,11 @@ class Subcon : public VieVS_Object {
      * @param sourceList list of all sources
      * @param hiscores high impact scores
      * @param interval high impact search interval index
+     * @param context scheduling context
      */
     void generateScore( const Network &network, const SourceList &sourceList,
-                        const std::vector<std::map<unsigned long, double>> &hiscores, unsigned int interval );
+                        const std::vector<std::map<unsigned long, double>> &hiscores, unsigned int interval,
+                        const SchedulingContext &context );
 
 
     /**
@@ -240,9 +256,10 @@ class Subcon : public VieVS_Object {
      * @param network station network
      * @param sourceList list of all sources
      * @param mode current observing mode
+     * @param context scheduling context
      */
     void generateCalibratorScore( const Network &network, const SourceList &sourceList,
-                                  const std::shared_ptr<const Mode> &mode );
+                                  const std::shared_ptr<const Mode> &mode, const SchedulingContext &context );
 
 
     /**
@@ -284,11 +301,12 @@ class Subcon : public VieVS_Object {
      * @param network station network
      * @param sourceList list of all sources
      * @param mode observing mode
+     * @param context scheduling context
      * @param endposition required endposition
      * @return scan(s) with highest score
      */
     std::vector<Scan> selectBest( Network &network, const SourceList &sourceList,
-                                  const std::shared_ptr<const Mode> &mode,
+                                  const std::shared_ptr<const Mode> &mode, const SchedulingContext &context,
                                   const boost::optional<StationEndposition> &endposition = boost::none ) noexcept;
 
 
@@ -304,6 +322,7 @@ class Subcon : public VieVS_Object {
      * @param mode observing mode
      * @param prevLowElevationScores low elevation scores
      * @param prevHighElevationScores high elevation scores
+     * @param context scheduling context
      * @param endposition required endposition
      * @return scan(s) with highest score
      */
@@ -311,6 +330,7 @@ class Subcon : public VieVS_Object {
                                   const std::shared_ptr<const Mode> &mode,
                                   const std::vector<double> &prevLowElevationScores,
                                   const std::vector<double> &prevHighElevationScores,
+                                  const SchedulingContext &context,
                                   const boost::optional<StationEndposition> &endposition = boost::none ) noexcept;
 
 
@@ -357,6 +377,57 @@ class Subcon : public VieVS_Object {
                       bool doNotObserveSourcesWithinMinRepeat = true );
 
 
+    /**
+     * @brief create all candidate scans (visible scans including start times, observations and scan durations)
+     * @author Matthias Schartner
+     *
+     * Equivalent to visibleScan for each source followed by calcStartTimes, updateAzEl, constructAllBaselines,
+     * calcAllBaselineDurations and calcAllScanDurations. Each source is processed independently (using nThreads
+     * OpenMP threads) and the resulting scans are added in source order.
+     *
+     * @param currentTime current start time
+     * @param type scan type
+     * @param network station network
+     * @param sourceList list of all sources
+     * @param observedSources list of priviously observed sources
+     * @param doNotObserveSourcesWithinMinRepeat consider scans (with reduced weight) if they are within min repeat time
+     * @param mode observing mode
+     * If a candidate pool is passed, candidates of unchanged stations and sources are taken from the pool instead
+     * of being recalculated and all recalculated candidates are stored in the pool.
+     *
+     * @param endposition required endposition
+     * @param nThreads number of threads
+     * @param pool candidate pool of previous scan selections (optional)
+     */
+    void createCandidates( unsigned int currentTime, Scan::ScanType type, const Network &network,
+                           const SourceList &sourceList, const std::set<unsigned long> &observedSources,
+                           bool doNotObserveSourcesWithinMinRepeat, const std::shared_ptr<const Mode> &mode,
+                           const boost::optional<StationEndposition> &endposition, int nThreads,
+                           CandidatePool *pool = nullptr );
+
+
+    /**
+     * @brief create a single candidate scan to a source
+     * @author Matthias Schartner
+     *
+     * @param currentTime current start time
+     * @param type scan type
+     * @param network station network
+     * @param thisSource target source
+     * @param observedSources list of priviously observed sources
+     * @param doNotObserveSourcesWithinMinRepeat consider scans (with reduced weight) if they are within min repeat time
+     * @param mode observing mode
+     * @param endposition required endposition
+     * @return candidate scan if source can be observed
+     */
+    boost::optional<Scan> createCandidate( unsigned int currentTime, Scan::ScanType type, const Network &network,
+                                           const std::shared_ptr<const AbstractSource> &thisSource,
+                                           const std::set<unsigned long> &observedSources,
+                                           bool doNotObserveSourcesWithinMinRepeat,
+                                           const std::shared_ptr<const Mode> &mode,
+                                           const boost::optional<StationEndposition> &endposition ) const;
+
+
     /**
      * @brief Matthias Schartner
      * @author Matthias Schartner
@@ -365,8 +436,48 @@ class Subcon : public VieVS_Object {
      */
     const std::vector<Scan> &getSingleSourceScans() const { return singleScans_; }
 
+
+    /**
+     * @brief enable or disable lazy evaluation in selectBest
+     * @author Matthias Schartner
+     *
+     * In lazy evaluation mode each candidate is rigorously updated at most once. As soon as an already updated
+     * candidate has the highest score in the queue it is selected without repeating its rigorous update.
+     *
+     * The score before the rigorous update is no upper bound of the updated score (e.g. a shorter slew or scan
+     * duration can increase it). The default (eager) selection therefore is a heuristic as well and differs only in
+     * repeating the rigorous update of this candidate. If this repeated update changes its score or invalidates it,
+     * the eager selection can continue with a different candidate while the lazy selection keeps the first one.
+     * Thus, lazy and eager selection can choose different scans and enabling lazy evaluation can change the
+     * resulting schedule (see scanSelection benchmark scenario).
+     *
+     * @param flag lazy evaluation flag
+     */
+    void setLazyEvaluation( bool flag ) noexcept { lazyEvaluation_ = flag; }
+
+
+    /**
+     * @brief getter for number of rigorous updates in selectBest
+     * @author Matthias Schartner
+     *
+     * @return number of rigorous updates
+     */
+    unsigned long getNumberRigorousUpdates() const noexcept { return nRigorousUpdates_; }
+
+
+    /**
+     * @brief getter for number of skipped repeated rigorous updates in selectBest
+     * @author Matthias Schartner
+     *
+     * Counts the scans of selected candidates which were already rigorously updated and therefore selected without a
+     * second update in lazy evaluation mode. No candidate is discarded based on a bound.
+     *
+     * @return number of skipped repeated rigorous updates of selected candidates
+     */
+    unsigned long getNumberSkippedReupdates() const noexcept { return nSkippedReupdates_; }
+
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     unsigned long nSingleScans_ = 0;  ///< number of single source scans
     std::vector<Scan> singleScans_;   ///< all single source scans
@@ -382,14 +493,127 @@ class Subcon : public VieVS_Object {
     std::vector<double> abls_;   ///< average baseline score for each baseline
     std::vector<double> idle_;   ///< extra score for long idle time
 
+    /**
+     * @brief lookup tables required to create subnetting scans
+     * @author Matthias Schartner
+     */
+    struct SubnettingLookup {
+        std::vector<long> srcid2scan;        ///< index of single source scan per source id (-1 if not available)
+        unsigned long nWords = 0;            ///< number of 64 bit words per station mask
+        std::vector<uint64_t> stationMasks;  ///< station bitmask per single source scan (nWords each)
+        std::vector<int> station2site;       ///< site id per station id
+        int nSites = 0;                      ///< number of sites
+        unsigned long availableSta = 0;      ///< number of available stations
+    };
+
+    bool lazyEvaluation_ = false;          ///< rigorously update each candidate at most once in selectBest
+    unsigned long nRigorousUpdates_ = 0;   ///< number of rigorous updates in selectBest
+    unsigned long nSkippedReupdates_ = 0;  ///< number of skipped repeated rigorous updates of selected candidates
+
+    /**
+     * @brief create possible visible scan to a source
+     * @author Matthias Schartner
+     *
+     * @param currentTime current start time
+     * @param type scan type
+     * @param network station network
+     * @param thisSource target source
+     * @param observedSources list of priviously observed sources
+     * @param doNotObserveSourcesWithinMinRepeat consider scans (with reduced weight) if they are within min repeat time
+     * @return scan if source is visible
+     */
+    boost::optional<Scan> createVisibleScan( unsigned int currentTime, Scan::ScanType type, const Network &network,
+                                             const std::shared_ptr<const AbstractSource> &thisSource,
+                                             const std::set<unsigned long> &observedSources,
+                                             bool doNotObserveSourcesWithinMinRepeat ) const;
+
+
+    /**
+     * @brief create all subnetting scans with a given single source scan as first scan
+     * @author Matthias Schartner
+     *
+     * @param idx1 index of first single source scan
+     * @param subnetting subnetting parameters
+     * @param sourceList list of all sources
+     * @param lookup subnetting lookup tables
+     * @return all valid subnetting scans
+     */
+    std::vector<std::pair<Scan, Scan>> createSubnettingScans( unsigned long idx1,
+                                                              const std::shared_ptr<Subnetting> &subnetting,
+                                                              const SourceList &sourceList,
+                                                              const SubnettingLookup &lookup ) const noexcept;
+
+
+    /**
+     * @brief calculates start times, observations and scan duration of a visible scan
+     * @author Matthias Schartner
+     *
+     * @param thisScan visible scan
+     * @param network station network
+     * @param thisSource observed source
+     * @param mode observing mode
+     * @param endposition required endposition
+     * @return true if scan is still valid
+     */
+    bool processCandidate( Scan &thisScan, const Network &network,
+                           const std::shared_ptr<const AbstractSource> &thisSource,
+                           const std::shared_ptr<const Mode> &mode,
+                           const boost::optional<StationEndposition> &endposition ) const;
+
+
+    /**
+     * @brief calculates the earliest possible start time of a single scan
+     * @author Matthias Schartner
+     *
+     * @param thisScan target scan
+     * @param network station network
+     * @param thisSource observed source
+     * @param endposition required endposition
+     * @return true if scan is still valid
+     */
+    bool calcStartTimes( Scan &thisScan, const Network &network,
+                         const std::shared_ptr<const AbstractSource> &thisSource,
+                         const boost::optional<StationEndposition> &endposition ) const noexcept;
+
+
+    /**
+     * @brief updates all azimuths and elevations of all pointing vectors of a single scan
+     * @author Matthias Schartner
+     *
+     * @param thisScan target scan
+     * @param network station network
+     * @param thisSource observed source
+     * @return true if scan is still valid
+     */
+    bool updateAzEl( Scan &thisScan, const Network &network,
+                     const std::shared_ptr<const AbstractSource> &thisSource ) const noexcept;
+
+
+    /**
+     * @brief calculates the scan duration of a single scan
+     * @author Matthias Schartner
+     *
+     * @param thisScan target scan
+     * @param network station network
+     * @param thisSource observed source
+     * @param endposition required endposition
+     * @return true if scan is still valid
+     */
+    bool calcScanDuration( Scan &thisScan, const Network &network,
+                           const std::shared_ptr<const AbstractSource> &thisSource,
+                           const boost::optional<StationEndposition> &endposition ) const noexcept;
+
+
     /**
      * @brief precalculate all necessary parameters to generate scores
      * @author Matthias Schartner
      *
      * @param network station network
      * @param sourceList list of all sources
+     * @param weightFactors weight factors of this schedule
      */
-    void precalcScore( const Network &network, const SourceList &sourceList ) noexcept;
+    void precalcScore( const Network &network, const SourceList &sourceList,
+                       const WeightFactors &weightFactors ) noexcept;
 
 
     /**
@@ -424,8 +648,9 @@ class Subcon : public VieVS_Object {
      * @author Matthias Scharnter
      *
      * @param stations list of all stations
+     * @param interval long idle time interval
      */
-    void prepareIdleTimeScore( const std::vector<Station> &stations ) noexcept;
+    void prepareIdleTimeScore( const std::vector<Station> &stations, unsigned int interval ) noexcept;
 
 
     /**
@@ -437,9 +662,9 @@ class Subcon : public VieVS_Object {
      */
     std::vector<double> prepareAverageScore_base( const std::vector<unsigned long> &nobs ) noexcept;
 
-    static void checkCalibratorScores( Scan &scan1 );
+    static void checkCalibratorScores( Scan &scan1, const SchedulingContext &context );
 
-    static void checkCalibratorScores( Scan &scan1, Scan &scan2 );
+    static void checkCalibratorScores( Scan &scan1, Scan &scan2, const SchedulingContext &context );
 };
 }  // namespace VieVS
 #endif /* SUBCON_H */
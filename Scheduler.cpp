@@ -29,7 +29,7 @@
 
 using namespace std;
 using namespace VieVS;
-unsigned long Scheduler::nextId = 0;
+std::atomic<unsigned long> Scheduler::nextId{ 0 };
 
 Scheduler::Scheduler( const Scheduler* other ) : VieVS_NamedObject(*other),
     version_(other->version_),
@@ -45,6 +45,9 @@ Scheduler::Scheduler( const Scheduler* other ) : VieVS_NamedObject(*other),
     nSingleScansConsidered(other->nSingleScansConsidered),
     nSubnettingScansConsidered(other->nSubnettingScansConsidered),
     nObservationsConsidered(other->nObservationsConsidered),
+    nRigorousUpdates(other->nRigorousUpdates),
+    nSkippedReupdates(other->nSkippedReupdates),
+    context_(other->context_),
     himp_(other->himp_),
     calib_(other->calib_),
     multiSchedulingParameters_(other->multiSchedulingParameters_) { /* STUB */ }
@@ -93,6 +96,13 @@ Scheduler::Scheduler( Initializer &init, string path, string fname )
     parameters_.writeSkyCoverageData = false;
     parameters_.doNotObserveSourcesWithinMinRepeat = init.parameters_.doNotObserveSourcesWithinMinRepeat;
     parameters_.ignoreSuccessiveScansSameSrc = init.parameters_.ignoreSuccessiveScansSameSrc;
+    parameters_.nThreadsScanSelection = init.parameters_.nThreadsScanSelection;
+    parameters_.incrementalScanSelection = init.parameters_.incrementalScanSelection;
+    parameters_.lazyScanSelection = init.parameters_.lazyScanSelection;
+
+    context_.nextAstrometricCalibratorBlock = AstrometricCalibratorBlock::cadence;
+    context_.focusCornerInterval = init.parameters_.focusCornerInterval;
+    context_.weightFactors = init.parameters_.weightFactors;
 }
 
 
@@ -152,11 +162,15 @@ void Scheduler::startScanSelection( unsigned int endTime, std::ofstream &of, Sca
             subcon.checkIfEnoughTimeToReachEndposition( network_, sourceList_, opt_endposition );
             subcon.clearSubnettingScans();
             if ( parameters_.subnetting != nullptr ) {
-                subcon.createSubnettingScans( parameters_.subnetting, network_, sourceList_ );
+                subcon.createSubnettingScans( parameters_.subnetting, network_, sourceList_,
+                                              parameters_.nThreadsScanSelection );
             }
         } else {
             // otherwise calculate new subcon
             subcon = createSubcon( parameters_.subnetting, type, opt_endposition );
+            if ( useIncrementalScanSelection( type, opt_endposition ) ) {
+                candidatePool_.output( of );
+            }
 
             //            string fileName = path_ + getName();
             //            for ( const auto &sky : network_.getSkyCoverages() ) {
@@ -173,21 +187,21 @@ void Scheduler::startScanSelection( unsigned int endTime, std::ofstream &of, Sca
         }
 
         // check algorithm focus corners for intensive sessions
-        if ( FocusCorners::startFocusCorner && depth == 0 ) {
+        if ( context_.focusCornerStart && depth == 0 ) {
             of << boost::format( "| %=140s |\n" ) % "reweight sources to focus observation at corner";
-            FocusCorners::reweight( subcon, sourceList_, of );
-            ++FocusCorners::iscan;
-            of << boost::format( "| %=140s |\n" ) %
-                      ( boost::format( "Focus corner scan %d of %d" ) % FocusCorners::iscan % FocusCorners::nscans )
-                          .str();
+            FocusCorners::reweight( subcon, sourceList_, context_, of );
+            ++context_.focusCornerScan;
+            of << boost::format( "| %=140s |\n" ) % ( boost::format( "Focus corner scan %d of %d" ) %
+                                                        context_.focusCornerScan % FocusCorners::nscans )
+                                                          .str();
         }
 
         if ( type != Scan::ScanType::astroCalibrator ) {
             // standard case
-            subcon.generateScore( network_, sourceList_ );
+            subcon.generateScore( network_, sourceList_, context_ );
         } else {
             // special case for calibrator scans
-            subcon.generateScore( prevLowElevationScores, prevHighElevationScores, network_, sourceList_ );
+            subcon.generateScore( prevLowElevationScores, prevHighElevationScores, network_, sourceList_, context_ );
         }
 
         unsigned long nSingleScans = subcon.getNumberSingleScans();
@@ -195,17 +209,20 @@ void Scheduler::startScanSelection( unsigned int endTime, std::ofstream &of, Sca
 
         // select the best possible next scan(s) and save them under 'bestScans'
         vector<Scan> bestScans;
+        subcon.setLazyEvaluation( parameters_.lazyScanSelection );
         if ( type != Scan::ScanType::astroCalibrator ) {
             // standard case
-            bestScans = subcon.selectBest( network_, sourceList_, currentObservingMode_, opt_endposition );
+            bestScans = subcon.selectBest( network_, sourceList_, currentObservingMode_, context_, opt_endposition );
         } else {
             // special calibrator case
             bestScans = subcon.selectBest( network_, sourceList_, currentObservingMode_, prevLowElevationScores,
-                                           prevHighElevationScores, opt_endposition );
+                                           prevHighElevationScores, context_, opt_endposition );
         }
+        nRigorousUpdates += subcon.getNumberRigorousUpdates();
+        nSkippedReupdates += subcon.getNumberSkippedReupdates();
 
-        if ( FocusCorners::startFocusCorner && depth == 0 && FocusCorners::iscan >= FocusCorners::nscans ) {
-            FocusCorners::reset( bestScans, sourceList_ );
+        if ( context_.focusCornerStart && depth == 0 && context_.focusCornerScan >= FocusCorners::nscans ) {
+            FocusCorners::reset( bestScans, sourceList_, context_ );
         }
 
         // check if you have possible next scan
@@ -263,8 +280,8 @@ void Scheduler::startScanSelection( unsigned int endTime, std::ofstream &of, Sca
                 maxScanEnd = any.getTimes().getScanTime( Timestamp::end );
             }
         }
-        if ( maxScanEnd > FocusCorners::nextStart ) {
-            FocusCorners::startFocusCorner = true;
+        if ( maxScanEnd > context_.focusCornerNextStart ) {
+            context_.focusCornerStart = true;
         }
 
         // check if end time triggers a new event
@@ -406,9 +423,9 @@ void Scheduler::startScanSelection( unsigned int endTime, std::ofstream &of, Sca
 
         // update number of scan selections if it is a standard scan
         if ( type == Scan::ScanType::standard ) {
-            ++Scan::nScanSelections;
+            ++context_.nScanSelections;
             if ( Scan::scanSequence_flag ) {
-                Scan::newScan();
+                Scan::newScan( context_ );
             }
         }
 
@@ -416,20 +433,20 @@ void Scheduler::startScanSelection( unsigned int endTime, std::ofstream &of, Sca
         if ( type == Scan::ScanType::standard && AstrometricCalibratorBlock::scheduleCalibrationBlocks && depth == 0 ) {
             switch ( AstrometricCalibratorBlock::cadenceUnit ) {
                 case AstrometricCalibratorBlock::CadenceUnit::scans: {
-                    if ( Scan::nScanSelections == AstrometricCalibratorBlock::nextBlock ) {
+                    if ( context_.nScanSelections == context_.nextAstrometricCalibratorBlock ) {
                         boost::optional<Subcon> empty_subcon = boost::none;
                         startScanSelection( endTime, of, Scan::ScanType::astroCalibrator, opt_endposition, empty_subcon,
                                             depth + 1 );
-                        AstrometricCalibratorBlock::nextBlock += AstrometricCalibratorBlock::cadence;
+                        context_.nextAstrometricCalibratorBlock += AstrometricCalibratorBlock::cadence;
                     }
                     break;
                 }
                 case AstrometricCalibratorBlock::CadenceUnit::seconds: {
-                    if ( maxScanEnd >= AstrometricCalibratorBlock::nextBlock ) {
+                    if ( maxScanEnd >= context_.nextAstrometricCalibratorBlock ) {
                         boost::optional<Subcon> empty_subcon = boost::none;
                         startScanSelection( endTime, of, Scan::ScanType::astroCalibrator, opt_endposition, empty_subcon,
                                             depth + 1 );
-                        AstrometricCalibratorBlock::nextBlock += AstrometricCalibratorBlock::cadence;
+                        context_.nextAstrometricCalibratorBlock += AstrometricCalibratorBlock::cadence;
                     }
                     break;
                 }
@@ -465,9 +482,10 @@ void Scheduler::start() noexcept {
         of.open( path_ + fileName );
     }
     if ( FocusCorners::flag ) {
-        FocusCorners::initialize( network_, of );
+        FocusCorners::initialize( network_, context_, of );
     }
-    CalibratorBlock::stationFlag = vector<char>( network_.getNSta(), false );
+    context_.calibratorStationFlag = vector<char>( network_.getNSta(), false );
+    candidatePool_.reset( network_.getNSta(), sourceList_.getNSrc() );
 
     if ( network_.getNSta() == 0 || sourceList_.empty() || network_.getNBls() == 0 ) {
         string e = ( boost::format( "number of stations: %d number of baselines: %d number of sources: %d;\n" ) %
@@ -529,7 +547,7 @@ void Scheduler::start() noexcept {
         parallacticAngleBlocks( of );
     }
     if ( DifferentialParallacticAngleBlock::nscans > 0 ) {
-        DifferentialParallacticAngleBlock::iScan = 0;
+        context_.iDifferentialParallacticAngleScan = 0;
         differentialParallacticAngleBlocks( of );
     }
 
@@ -537,7 +555,7 @@ void Scheduler::start() noexcept {
         highImpactScans( himp_.get(), of );
     }
 
-    Scan::scanSequence_modulo = 0;
+    context_.scanSequenceModulo = 0;
 
     // check if you have some fixed high impact scans
     if ( scans_.empty() ) {
@@ -631,6 +649,10 @@ void Scheduler::statistics( ofstream &of ) {
     of << boost::format( "| %-35s %d (single source scans %d, subnetting scans %d) %143t|\n" ) %
               "total scans considered" % ( nSingleScansConsidered + 2 * nSubnettingScansConsidered ) %
               nSingleScansConsidered % ( 2 * nSubnettingScansConsidered );
+    if ( parameters_.lazyScanSelection ) {
+        of << boost::format( "| %-35s %d (skipped re-updates %d) %143t|\n" ) % "rigorous updates" %
+                  nRigorousUpdates % nSkippedReupdates;
+    }
 
 #ifdef VIESCHEDPP_LOG
     BOOST_LOG_TRIVIAL( info ) << "created schedule with " << scans_.size() << " scans and " << nobs << " observations";
@@ -642,17 +664,24 @@ void Scheduler::statistics( ofstream &of ) {
 
 Subcon Scheduler::createSubcon( const shared_ptr<Subnetting> &subnetting, Scan::ScanType type,
                                 const boost::optional<StationEndposition> &endposition ) noexcept {
-    Subcon subcon = allVisibleScans( type, endposition, parameters_.doNotObserveSourcesWithinMinRepeat );
-    subcon.calcStartTimes( network_, sourceList_, endposition );
-    subcon.updateAzEl( network_, sourceList_ );
-    subcon.constructAllBaselines( network_, sourceList_ );
-    subcon.calcAllBaselineDurations( network_, sourceList_, currentObservingMode_ );
-    subcon.calcAllScanDurations( network_, sourceList_, endposition );
+    Subcon subcon;
+    bool useCandidatePool = useIncrementalScanSelection( type, endposition );
+    if ( parameters_.nThreadsScanSelection > 1 || useCandidatePool ) {
+        subcon = allCandidateScans( type, endposition, parameters_.doNotObserveSourcesWithinMinRepeat,
+                                    useCandidatePool );
+    } else {
+        subcon = allVisibleScans( type, endposition, parameters_.doNotObserveSourcesWithinMinRepeat );
+        subcon.calcStartTimes( network_, sourceList_, endposition );
+        subcon.updateAzEl( network_, sourceList_ );
+        subcon.constructAllBaselines( network_, sourceList_ );
+        subcon.calcAllBaselineDurations( network_, sourceList_, currentObservingMode_ );
+        subcon.calcAllScanDurations( network_, sourceList_, endposition );
+    }
     subcon.checkTotalObservingTime( network_, sourceList_ );
     subcon.checkIfEnoughTimeToReachEndposition( network_, sourceList_, endposition );
 
     if ( subnetting != nullptr ) {
-        subcon.createSubnettingScans( subnetting, network_, sourceList_ );
+        subcon.createSubnettingScans( subnetting, network_, sourceList_, parameters_.nThreadsScanSelection );
     }
     return subcon;
 }
@@ -660,8 +689,62 @@ Subcon Scheduler::createSubcon( const shared_ptr<Subnetting> &subnetting, Scan::
 
 Subcon Scheduler::allVisibleScans( Scan::ScanType type, const boost::optional<StationEndposition> &endposition,
                                    bool doNotObserveSourcesWithinMinRepeat ) noexcept {
+    unsigned int currentTime;
+    set<unsigned long> observedSources;
+    scanSelectionState( endposition, currentTime, observedSources );
+
+    // create subcon with all visible scans
+    Subcon subcon;
+#ifdef VIESCHEDPP_LOG
+    if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "creating new subcon " << subcon.printId();
+#endif
+
+    for ( const auto &thisSource : sourceList_.getSources() ) {
+        subcon.visibleScan( currentTime, type, network_, thisSource, observedSources,
+                            doNotObserveSourcesWithinMinRepeat );
+    }
+
+    return subcon;
+}
+
+
+Subcon Scheduler::allCandidateScans( Scan::ScanType type, const boost::optional<StationEndposition> &endposition,
+                                     bool doNotObserveSourcesWithinMinRepeat, bool useCandidatePool ) noexcept {
+    unsigned int currentTime;
+    set<unsigned long> observedSources;
+    scanSelectionState( endposition, currentTime, observedSources );
+
+    // create subcon with all candidate scans
+    Subcon subcon;
+#ifdef VIESCHEDPP_LOG
+    if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "creating new subcon " << subcon.printId();
+#endif
+
+    CandidatePool *pool = nullptr;
+    if ( useCandidatePool ) {
+        candidatePool_.checkForChanges( network_, sourceList_, currentObservingMode_ );
+        pool = &candidatePool_;
+    }
+
+    subcon.createCandidates( currentTime, type, network_, sourceList_, observedSources,
+                             doNotObserveSourcesWithinMinRepeat, currentObservingMode_, endposition,
+                             parameters_.nThreadsScanSelection, pool );
+
+    return subcon;
+}
+
+
+bool Scheduler::useIncrementalScanSelection( Scan::ScanType type,
+                                             const boost::optional<StationEndposition> &endposition ) const noexcept {
+    return parameters_.incrementalScanSelection && type == Scan::ScanType::standard &&
+           !endposition.is_initialized();
+}
+
+
+void Scheduler::scanSelectionState( const boost::optional<StationEndposition> &endposition,
+                                    unsigned int &currentTime, std::set<unsigned long> &observedSources ) const {
     // get latest start time of new scan
-    unsigned int currentTime = 0;
+    currentTime = 0;
     for ( auto &station : network_.getStations() ) {
         if ( station.getCurrentTime() > currentTime ) {
             currentTime = station.getCurrentTime();
@@ -669,8 +752,7 @@ Subcon Scheduler::allVisibleScans( Scan::ScanType type, const boost::optional<St
     }
 
     // save all ids of the next observed sources (if there is a required endposition)
-    set<unsigned long> observedSources;
-    if ( parameters_.ignoreSuccessiveScansSameSrc ){
+    if ( parameters_.ignoreSuccessiveScansSameSrc ) {
         if ( endposition.is_initialized() ) {
             observedSources = endposition->getObservedSources( currentTime, sourceList_ );
         }
@@ -678,19 +760,6 @@ Subcon Scheduler::allVisibleScans( Scan::ScanType type, const boost::optional<St
             observedSources.insert( sta.getCurrentPointingVector().getSrcid() );
         }
     }
-
-    // create subcon with all visible scans
-    Subcon subcon;
-#ifdef VIESCHEDPP_LOG
-    if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "creating new subcon " << subcon.printId();
-#endif
-
-    for ( const auto &thisSource : sourceList_.getSources() ) {
-        subcon.visibleScan( currentTime, type, network_, thisSource, observedSources,
-                            doNotObserveSourcesWithinMinRepeat );
-    }
-
-    return subcon;
 }
 
 
@@ -735,7 +804,7 @@ void Scheduler::update( Scan &scan, ofstream &of ) noexcept {
         }
     }
 
-    scan.output( scans_.size(), network_, thisSource, of );
+    scan.output( scans_.size(), network_, thisSource, of, &context_ );
     scans_.push_back( std::move( scan ) );
 }
 
@@ -1077,6 +1146,7 @@ bool Scheduler::checkForNewEvents( unsigned int time, bool output, ofstream &of,
         bool changed = any.checkForNewEvent( time, hard_break );
         if ( changed ) {
             stationChanged.push_back( any.getName() );
+            candidatePool_.invalidateStation( any.getId() );
 #ifdef VIESCHEDPP_LOG
             if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "changed parameters for station " << any.getName();
 #endif
@@ -1093,6 +1163,7 @@ bool Scheduler::checkForNewEvents( unsigned int time, bool output, ofstream &of,
         bool changed = any->checkForNewEvent( time, hard_break );
         if ( changed ) {
             sourcesChanged.push_back( any->getName() );
+            candidatePool_.invalidateSource( any->getId() );
 #ifdef VIESCHEDPP_LOG
             if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "changed parameters for source " << any->getName();
 #endif
@@ -1110,6 +1181,7 @@ bool Scheduler::checkForNewEvents( unsigned int time, bool output, ofstream &of,
         bool changed = any.checkForNewEvent( time, hard_break );
         if ( changed ) {
             baselineChanged.push_back( any.getName() );
+            candidatePool_.clear();
 #ifdef VIESCHEDPP_LOG
             if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "changed parameters for baseline " << any.getName();
 #endif
@@ -1344,9 +1416,7 @@ void Scheduler::startTagelongMode( Station &station, SkyCoverage &skyCoverage, s
                 Observation obs( bl.getId(), sta1.getId(), sta2.getId(), srcid, scanStartTime );
 
                 // calc baseline scan length
-                double date1 = 2400000.5;
-                double date2 = TimeSystem::mjdStart + static_cast<double>( scanStartTime ) / 86400.0;
-                double gmst = iauGmst82( date1, date2 );
+                double gmst = TimeSystem::internalTime2gmst82( scanStartTime );
 
                 if ( source->checkJetAngle() ) {
                     if ( !source->jet_angle_valid(scanStartTime, gmst, network_.getDxyz( sta1.getId(), sta2.getId() ) ) ){
@@ -1840,7 +1910,7 @@ bool Scheduler::checkOptimizationConditions( ofstream &of ) {
         if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "new schedule with reduced source list necessary";
 #endif
         message.append( "new schedule with reduced source list necessary" );
-        AstrometricCalibratorBlock::nextBlock = 0;
+        context_.nextAstrometricCalibratorBlock = 0;
         unsigned long sourcesLeft = consideredSources - excludedSources.size();
         of << boost::format( "|%|143t||\n" );
         if ( sourcesLeft < 10 ) {
@@ -2037,7 +2107,7 @@ void Scheduler::startScanSelectionBetweenScans( unsigned int duration, std::ofst
         }
         if ( output ) {
             lastScan.output( numeric_limits<unsigned long>::max(), network_,
-                             sourceList_.getSource( lastScan.getSourceId() ), of );
+                             sourceList_.getSource( lastScan.getSourceId() ), of, &context_ );
         }
 
 
@@ -2202,7 +2272,7 @@ void Scheduler::calibratorBlocks( std::ofstream &of ) {
     }
 
     for ( const auto &block : calib_ ) {
-        std::fill( CalibratorBlock::stationFlag.begin(), CalibratorBlock::stationFlag.end(), false );
+        std::fill( context_.calibratorStationFlag.begin(), context_.calibratorStationFlag.end(), false );
         of << boost::format( "|%|143t||\n" );
         of << boost::format( "|%=142s|\n" ) % "start calibration block";
         of << boost::format( "|%|143t||\n" );
@@ -2232,8 +2302,8 @@ void Scheduler::calibratorBlocks( std::ofstream &of ) {
             int i_scan = 0;
             while ( i_scan < block.getNScans() ) {
                 Subcon subcon = createSubcon( parameters_.subnetting, Scan::ScanType::fringeFinder );
-                subcon.generateCalibratorScore( network_, sourceList_, currentObservingMode_ );
-                vector<Scan> bestScans = subcon.selectBest( network_, sourceList_, currentObservingMode_ );
+                subcon.generateCalibratorScore( network_, sourceList_, currentObservingMode_, context_ );
+                vector<Scan> bestScans = subcon.selectBest( network_, sourceList_, currentObservingMode_, context_ );
 
                 // check end time of best possible next scan
                 unsigned int maxScanEnd = 0;
@@ -2267,7 +2337,7 @@ void Scheduler::calibratorBlocks( std::ofstream &of ) {
                         unsigned long staid = scan.getStationId( i );
                         unsigned int obsDur = scan.getTimes().getObservingDuration( i );
                         network_.refStation( staid ).addObservingTime( obsDur );
-                        CalibratorBlock::stationFlag[staid] = true;
+                        context_.calibratorStationFlag[staid] = true;
                     }
                 }
 
@@ -2280,7 +2350,7 @@ void Scheduler::calibratorBlocks( std::ofstream &of ) {
                 ++i_scan;
 
                 if ( CalibratorBlock::tryToIncludeAllStationFlag &&
-                     std::all_of( CalibratorBlock::stationFlag.begin(), CalibratorBlock::stationFlag.end(),
+                     std::all_of( context_.calibratorStationFlag.begin(), context_.calibratorStationFlag.end(),
                                   []( bool i ) { return i; } ) ) {
                     break;
                 }
@@ -2341,8 +2411,8 @@ void Scheduler::parallacticAngleBlocks( ofstream &of ) {
         }
 
         Subcon subcon = createSubcon( nullptr, Scan::ScanType::parallacticAngle );
-        subcon.generateCalibratorScore( network_, sourceList_, currentObservingMode_ );
-        vector<Scan> bestScans = subcon.selectBest( network_, sourceList_, currentObservingMode_ );
+        subcon.generateCalibratorScore( network_, sourceList_, currentObservingMode_, context_ );
+        vector<Scan> bestScans = subcon.selectBest( network_, sourceList_, currentObservingMode_, context_ );
         if ( bestScans.size() == 1 ) {
             allBestScans.push_back( bestScans[0] );
         }
@@ -2442,8 +2512,8 @@ void Scheduler::differentialParallacticAngleBlocks( ofstream &of ) {
             }
 
             Subcon subcon = createSubcon( nullptr, Scan::ScanType::diffParallacticAngle );
-            subcon.generateCalibratorScore( network_, sourceList_, currentObservingMode_ );
-            vector<Scan> bestScans = subcon.selectBest( network_, sourceList_, currentObservingMode_ );
+            subcon.generateCalibratorScore( network_, sourceList_, currentObservingMode_, context_ );
+            vector<Scan> bestScans = subcon.selectBest( network_, sourceList_, currentObservingMode_, context_ );
             if ( bestScans.size() == 1 ) {
                 allBestScans.push_back( bestScans[0] );
             }
@@ -2505,7 +2575,7 @@ void Scheduler::differentialParallacticAngleBlocks( ofstream &of ) {
 
                 update( thisScan, of );
                 sortSchedule();
-                ++DifferentialParallacticAngleBlock::iScan;
+                ++context_.iDifferentialParallacticAngleScan;
                 break;
             }
         }
@@ -2547,14 +2617,14 @@ void Scheduler::highImpactScans( HighImpactScanDescriptor &himp, ofstream &of )
     }
 
     // create the actual scans
-    himp.updateHighImpactScans( network_, sourceList_, currentObservingMode_, parameters_.subnetting );
+    himp.updateHighImpactScans( network_, sourceList_, currentObservingMode_, parameters_.subnetting, context_ );
 
     himp.updateLogfile( of );
 
     // select bestScans
     vector<Scan> bestScans;
     do {
-        bestScans = himp.highestImpactScans( network_, sourceList_, currentObservingMode_ );
+        bestScans = himp.highestImpactScans( network_, sourceList_, currentObservingMode_, context_ );
         for ( auto &scan : bestScans ) {
             const auto &source = sourceList_.getSource( scan.getSourceId() );
             if ( himp.isCorrectHighImpactScan( scan, scans_, source ) ) {
@@ -2593,6 +2663,7 @@ void Scheduler::resetAllEvents( std::ofstream &of, bool resetCurrentPointingVect
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "reset all events";
 #endif
+    candidatePool_.clear();
 
     // reset all events
     for ( auto &any : network_.refStations() ) {
@@ -3466,7 +3537,7 @@ void Scheduler::scheduleAPrioriScans( const boost::property_tree::ptree &ptree,
         if ( any.first == "scan" ) {
             Scan scan( any.second, network_, sourceList_ );
             const auto &src = sourceList_.getSource( scan.getSourceId() );
-            scan.output( numeric_limits<unsigned long>::max(), network_, src, of );
+            scan.output( numeric_limits<unsigned long>::max(), network_, src, of, &context_ );
             scans_.push_back( scan );
         }
     }
@@ -37,6 +37,7 @@
 #include "Algorithm/FocusCorners.h"
 #include "Initializer.h"
 #include "Misc/Constants.h"
+#include "Misc/SchedulingContext.h"
 #include "Misc/StationEndposition.h"
 #include "Misc/Subnetting.h"
 #include "Scan/Subcon.h"
@@ -88,6 +89,10 @@ class Scheduler : public VieVS_NamedObject {
             true;  ///< consider scans (with reduced weight) if they are within min repeat time
 
         bool writeSkyCoverageData = false;  ///< flag if sky coverage data should be printed to file
+
+        int nThreadsScanSelection = 1;          ///< number of threads used to create candidate scans
+        bool incrementalScanSelection = false;  ///< reuse unchanged candidate scans of previous scan selection
+        bool lazyScanSelection = false;         ///< rigorously update each candidate at most once (can change schedule)
     };
 
     /**
@@ -164,6 +169,49 @@ class Scheduler : public VieVS_NamedObject {
                             bool doNotObserveSourcesWithinMinRepeat = true ) noexcept;
 
 
+    /**
+     * @brief constructs all candidate scans in parallel
+     * @author Matthias Schartner
+     *
+     * Creates the same scans as allVisibleScans followed by the start time, azimuth/elevation, observation and scan
+     * duration calculations, but processes all sources independently using parameters_.nThreadsScanSelection threads.
+     *
+     * @param type scan type
+     * @param endposition required endposition
+     * @param doNotObserveSourcesWithinMinRepeat consider scans (with reduced weight) if they are within min repeat time
+     * @param useCandidatePool reuse unchanged candidates of previous scan selection
+     * @return subcon with all candidate single source scans
+     */
+    Subcon allCandidateScans( Scan::ScanType type, const boost::optional<StationEndposition> &endposition = boost::none,
+                              bool doNotObserveSourcesWithinMinRepeat = true, bool useCandidatePool = false ) noexcept;
+
+
+    /**
+     * @brief check if candidate scans of previous scan selection can be reused
+     * @author Matthias Schartner
+     *
+     * only used for standard scans without required endposition
+     *
+     * @param type scan type
+     * @param endposition required endposition
+     * @return true if candidate pool is used
+     */
+    bool useIncrementalScanSelection( Scan::ScanType type,
+                                      const boost::optional<StationEndposition> &endposition ) const noexcept;
+
+
+    /**
+     * @brief latest start time of next scan and list of sources which should not be observed next
+     * @author Matthias Schartner
+     *
+     * @param endposition required endposition
+     * @param currentTime latest start time of new scan
+     * @param observedSources ids of previously/next observed sources
+     */
+    void scanSelectionState( const boost::optional<StationEndposition> &endposition, unsigned int &currentTime,
+                             std::set<unsigned long> &observedSources ) const;
+
+
     /**
      * @brief updates the selected next scans to the schedule
      * @author Matthias Schartner
@@ -271,6 +319,14 @@ class Scheduler : public VieVS_NamedObject {
      */
      const std::shared_ptr<const ObservingMode> &getObservingMode() const noexcept { return obsModes_; }
 
+    /**
+     * @brief get weight factors
+     * @author Matthias Schartner
+     *
+     * @return weight factors of this schedule
+     */
+     const WeightFactors &getWeightFactors() const noexcept { return context_.weightFactors; }
+
 
     /**
      * @brief get number of observations scheduled in this observation
@@ -297,7 +353,7 @@ class Scheduler : public VieVS_NamedObject {
      virtual void checkSatelliteAvoidance();
 
    protected:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
     int version_;                 ///< version
     std::string path_;            ///< path to VieSchedpp.xml directory
 
@@ -315,6 +371,11 @@ class Scheduler : public VieVS_NamedObject {
     unsigned long nSingleScansConsidered = 0;      ///< considered single source scans
     unsigned long nSubnettingScansConsidered = 0;  ///< considered subnetting scans
     unsigned long nObservationsConsidered = 0;     ///< considered baselines
+    unsigned long nRigorousUpdates = 0;            ///< rigorous updates during scan selection
+    unsigned long nSkippedReupdates = 0;           ///< skipped re-updates of selected scans in lazy scan selection
+
+    CandidatePool candidatePool_;  ///< candidate scans of previous scan selection
+    SchedulingContext context_;    ///< mutable scheduling state of this schedule
 
     boost::optional<HighImpactScanDescriptor> himp_;                          ///< high impact scan descriptor
     std::vector<CalibratorBlock> calib_;                                      ///< fringeFinder impact scan descriptor
@@ -25,7 +25,7 @@
 
 #include "Simulator.h"
 
-unsigned long VieVS::Simulator::nextId = 0;
+std::atomic<unsigned long> VieVS::Simulator::nextId{ 0 };
 
 using namespace std;
 using namespace VieVS;
@@ -41,6 +41,7 @@ Simulator::Simulator(Output &output)
           path_{std::move(output.path_)},
           version_{output.version_},
           multiSchedulingParameters_{ std::move( output.multiSchedulingParameters_ ) },
+          weightFactors_{ output.weightFactors_ },
           simpara_{ vector<SimPara>( network_.getNSta() ) } {
     auto tmp = xml_.get_optional<int>( "VieSchedpp.simulator.seed" );
     if ( tmp.is_initialized() ) {
@@ -80,7 +80,7 @@ class Simulator : public VieVS_NamedObject {
     void start();
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
     std::ofstream of;             ///< output stream object
     unsigned long seed_;
 
@@ -93,6 +93,7 @@ class Simulator : public VieVS_NamedObject {
     const std::vector<Scan> scans_;                                           ///< all scans in schedule
     const std::shared_ptr<const ObservingMode> &obsModes_;                    ///< observing mode
     boost::optional<MultiScheduling::Parameters> multiSchedulingParameters_;  ///< multi scheduling parameters
+    const WeightFactors weightFactors_;                                       ///< weight factors of this schedule
 
     std::vector<Eigen::MatrixXd> clk_;
     std::vector<Eigen::MatrixXd> tropo_;
@@ -29,8 +29,8 @@ using namespace std;
 using namespace VieVS;
 using namespace Eigen;
 
-unsigned long VieVS::Solver::nextId = 0;
-unsigned long VieVS::Solver::PWL::nextId = 0;
+std::atomic<unsigned long> VieVS::Solver::nextId{ 0 };
+std::atomic<unsigned long> VieVS::Solver::PWL::nextId{ 0 };
 
 Solver::Solver(Simulator &simulator)
         : VieVS_NamedObject(simulator.getName(), nextId++),
@@ -40,6 +40,7 @@ Solver::Solver(Simulator &simulator)
       sourceList_{ std::move( simulator.sourceList_ ) },
       scans_{ std::move( simulator.scans_ ) },
       multiSchedulingParameters_{ std::move( simulator.multiSchedulingParameters_ ) },
+      weightFactors_{ simulator.weightFactors_ },
       version_{ simulator.version_ },
       obs_minus_com_{ std::move( simulator.obs_minus_com_ ) },
       P_AB_{ std::move( simulator.P_ ) },
@@ -1765,7 +1766,7 @@ void Solver::writeStatistics( std::ofstream &stat_of ) {
     oString.append( std::to_string( a25m60Mean ) ).append( "," );
     oString.append( std::to_string( a37m60Mean ) ).append( "," );
 
-    oString.append( WeightFactors::statisticsValues() );
+    oString.append( weightFactors_.statisticsValues() );
 
     for ( auto any : obsPer ) {
         oString.append( std::to_string( any ) ).append( "," );
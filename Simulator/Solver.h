@@ -101,7 +101,7 @@ class Solver : public VieVS_NamedObject {
         double getConstraint() const { return constraint; }
 
        private:
-        static unsigned long nextId;  ///< next id for this object type
+        static std::atomic<unsigned long> nextId;  ///< next id for this object type
         Unknown::Type type = Unknown::Type::undefined;
         bool flag = false;
         int interval = 0;
@@ -159,7 +159,7 @@ class Solver : public VieVS_NamedObject {
         Z,
     };
 
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
     std::ofstream of;             ///< output stream object
 
     const boost::property_tree::ptree xml_;  ///< content of VieSchedpp.xml file
@@ -171,6 +171,7 @@ class Solver : public VieVS_NamedObject {
     const int version_;                                                       ///< number of this schedule
     const std::string path_; ///< path
     boost::optional<MultiScheduling::Parameters> multiSchedulingParameters_;  ///< multi scheduling parameters
+    const WeightFactors weightFactors_;                                       ///< weight factors of this schedule
     int nsim_;
 
 
@@ -27,7 +27,7 @@
 using namespace std;
 using namespace VieVS;
 
-unsigned long VieVS::Unknown::nextId = 0;
+std::atomic<unsigned long> VieVS::Unknown::nextId{ 0 };
 
 std::string Unknown::typeString( Type t ) {
     switch ( t ) {
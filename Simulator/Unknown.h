@@ -94,7 +94,7 @@ class Unknown : public VieVS_Object {
     std::string toString( std::string datum = " " ) const;
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 };
 
 
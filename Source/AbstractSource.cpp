@@ -28,8 +28,8 @@
 
 using namespace std;
 using namespace VieVS;
-unsigned long VieVS::AbstractSource::nextId = 0;
-unsigned long VieVS::AbstractSource::Parameters::nextId = 0;
+std::atomic<unsigned long> VieVS::AbstractSource::nextId{ 0 };
+std::atomic<unsigned long> VieVS::AbstractSource::Parameters::nextId{ 0 };
 
 
 void AbstractSource::Parameters::setParameters( const AbstractSource::Parameters &other ) {
@@ -40,6 +40,7 @@ void AbstractSource::Parameters::setParameters( const AbstractSource::Parameters
     weight = other.weight;
 
     minSNR = other.minSNR;
+    minSNRPerBand = BandRegistry::perBand( minSNR );
 
     minNumberOfSites = other.minNumberOfSites;
     minFlux = other.minFlux;
@@ -75,6 +76,15 @@ AbstractSource::AbstractSource( const string &src_name, const string &src_name2,
                                 unordered_map<string, unique_ptr<AbstractFlux>> &src_flux )
     : VieVS_NamedObject( src_name, src_name2, nextId++ ), parameters_{ Parameters( "empty" ) } {
     flux_ = std::make_shared<std::unordered_map<std::string, std::unique_ptr<AbstractFlux>>>( std::move( src_flux ) );
+    for ( const auto &any : *flux_ ) {
+        auto bandId = BandRegistry::getId( any.first );
+        if ( bandId.is_initialized() ) {
+            if ( fluxPerBand_.size() <= *bandId ) {
+                fluxPerBand_.resize( *bandId + 1, nullptr );
+            }
+            fluxPerBand_[*bandId] = any.second.get();
+        }
+    }
 
     condition_ = make_shared<Optimization>( Optimization() );
 }
@@ -113,20 +123,10 @@ double AbstractSource::getMaxFlux() const noexcept {
 
 double AbstractSource::getSunDistance( unsigned int time,
                                        const std::shared_ptr<const Position> &sta_pos ) const noexcept {
-    unsigned int precalc_idx = 0;
-    while ( AstronomicalParameters::sun_time[precalc_idx + 1] < time ) {
-        ++precalc_idx;
-    }
-    unsigned int delta = AstronomicalParameters::sun_time[1] - AstronomicalParameters::sun_time[0];
-
-    unsigned int deltaTime = time - AstronomicalParameters::sun_time[precalc_idx];
-
-    double sunRa = AstronomicalParameters::sun_ra[precalc_idx] +
-                   ( AstronomicalParameters::sun_ra[precalc_idx + 1] - AstronomicalParameters::sun_ra[precalc_idx] ) /
-                       delta * deltaTime;
-    double sunDe = AstronomicalParameters::sun_dec[precalc_idx] +
-                   ( AstronomicalParameters::sun_dec[precalc_idx + 1] - AstronomicalParameters::sun_dec[precalc_idx] ) /
-                       delta * deltaTime;
+    const EphemerisTable &sun = AstronomicalParameters::sun;
+    unsigned int precalc_idx = sun.index( time );
+    double sunRa = sun.interpolate( time, precalc_idx, 0 );
+    double sunDe = sun.interpolate( time, precalc_idx, 1 );
 
     auto srcRaDe = getRaDe( time, sta_pos );
     double tmp =
@@ -153,6 +153,31 @@ double AbstractSource::observedFlux( const string &band, unsigned int time, doub
 }
 
 
+double AbstractSource::observedFlux( unsigned long bandId, unsigned int time, double gmst,
+                                     const std::vector<double> &dxyz ) const noexcept {
+    const AbstractFlux *thisFlux = fluxPerBand_[bandId];
+    double flux;
+    if ( thisFlux->needsUV() ) {
+        std::pair<double, double> uv = calcUV( time, gmst, dxyz );
+        flux = thisFlux->observedFlux( uv.first, uv.second );
+    } else {
+        flux = thisFlux->observedFlux( 0, 0 );
+    }
+    return flux;
+}
+
+
+void AbstractSource::observedFlux( unsigned long bandId, unsigned long n, const double *u, const double *v,
+                                   double *flux ) const noexcept {
+    const AbstractFlux *thisFlux = fluxPerBand_[bandId];
+    if ( thisFlux->needsUV() ) {
+        thisFlux->observedFlux( n, u, v, flux );
+    } else {
+        fill( flux, flux + n, thisFlux->observedFlux( 0, 0 ) );
+    }
+}
+
+
 std::pair<double, double> AbstractSource::calcUV( unsigned int time, double gmst,
                                                   const std::vector<double> &dxyz ) const noexcept {
     auto srcRaDe = getRaDe( time, nullptr );
@@ -270,6 +295,31 @@ double AbstractSource::observedFlux_model( double wavelength, unsigned int time,
     return observedFlux;
 }
 
+
+void AbstractSource::observedFlux_model( double wavelength, unsigned long n, const double *u, const double *v,
+                                         double *flux ) const {
+    static thread_local vector<double> flux2;
+    flux2.resize( n );
+
+    // first flux
+    auto it = flux_->begin();
+    double wl1 = it->second->getWavelength();
+    it->second->observedFlux( n, u, v, flux );
+    // second flux
+    ++it;
+    double wl2 = it->second->getWavelength();
+    it->second->observedFlux( n, u, v, flux2.data() );
+
+    for ( unsigned long i = 0; i < n; ++i ) {
+        // solve for alpha and K
+        double alpha = log( flux[i] / flux2[i] ) / log( wl1 / wl2 );
+        double K = flux[i] / pow( wl1, alpha );
+
+        // calculate observed flux density
+        flux[i] = K * pow( wavelength, alpha );
+    }
+}
+
 bool AbstractSource::jet_angle_valid( unsigned int time, double gmst, const vector<double> &dxyz ) const {
     if ( !checkJetAngle() ) {
         return true;
@@ -29,6 +29,7 @@
 
 
 #include <boost/format.hpp>
+#include <array>
 #include <boost/optional.hpp>
 #include <cmath>
 #include <fstream>
@@ -42,6 +43,7 @@
 #include "../Misc/Flags.h"
 #include "../Misc/TimeSystem.h"
 #include "../Misc/VieVS_NamedObject.h"
+#include "../ObservingMode/BandRegistry.h"
 #include "../Station/Position.h"
 #include "Flux/AbstractFlux.h"
 #ifdef VIESCHEDPP_LOG
@@ -50,6 +52,17 @@
 
 
 namespace VieVS {
+/**
+ * @brief source direction in celestial reference frame
+ * @author Matthias Schartner
+ */
+struct SourceDirection {
+    double ra = 0;                     ///< right ascension
+    double de = 0;                     ///< declination
+    std::array<double, 3> crs{ {} };  ///< unit vector in celestial reference frame
+};
+
+
 /**
  * @class AbstractSource
  * @brief representation of an abstract source which can be scheduled
@@ -84,7 +97,7 @@ class AbstractSource : public VieVS_NamedObject {
      */
     class Parameters : public VieVS_NamedObject {
        private:
-        static unsigned long nextId;  ///< next id for this object type
+        static std::atomic<unsigned long> nextId;  ///< next id for this object type
        public:
         /**
          * @brief constructor
@@ -92,7 +105,8 @@ class AbstractSource : public VieVS_NamedObject {
          *
          * @param name parameter name
          */
-        explicit Parameters( const std::string &name ) : VieVS_NamedObject( name, nextId++ ) {}
+        explicit Parameters( const std::string &name )
+            : VieVS_NamedObject( name, nextId++ ), minSNRPerBand{ BandRegistry::undefinedPerBand() } {}
 
 
         /**
@@ -104,6 +118,19 @@ class AbstractSource : public VieVS_NamedObject {
         void setParameters( const Parameters &other );
 
 
+        /**
+         * @brief minimum signal to noise ratio of a band
+         * @author Matthias Schartner
+         *
+         * @param bandId band id
+         * @return minimum signal to noise ratio
+         * @throws std::out_of_range if minimum SNR of this band is not defined
+         */
+        double getMinSNR( unsigned long bandId ) const {
+            return BandRegistry::at( minSNRPerBand, bandId, "minSNR", getName() );
+        }
+
+
         bool available = true;               ///< flag is source is available
         bool globalAvailable = true;         ///< flag if source is available
         bool availableForFillinmode = true;  ///< flag if source is available for fillin mode
@@ -111,6 +138,7 @@ class AbstractSource : public VieVS_NamedObject {
         double weight = 1;  ///< multiplicative factor of score for scans to this source
 
         std::unordered_map<std::string, double> minSNR;  ///< minimum required signal to noise ration for each band
+        std::vector<double> minSNRPerBand;               ///< minimum signal to noise ration per band id
 
         unsigned int minNumberOfSites = 3;        ///< minimum number of stations for a scan
         double minFlux = 0.001;                   ///< minimum flux density required for this source in jansky
@@ -264,7 +292,10 @@ class AbstractSource : public VieVS_NamedObject {
          * @param PARA parameter
          */
         Event( unsigned int time, bool smoothTransition, Parameters PARA )
-            : time{ time }, smoothTransition{ smoothTransition }, PARA{ std::move( PARA ) } {}
+            : time{ time }, smoothTransition{ smoothTransition }, PARA{ std::move( PARA ) } {
+            // minSNR might have been changed after the band ids were assigned
+            this->PARA.minSNRPerBand = BandRegistry::perBand( this->PARA.minSNR );
+        }
 
 
         unsigned int time;      ///< time when new parameters should be used in seconds since start
@@ -345,10 +376,12 @@ class AbstractSource : public VieVS_NamedObject {
      * @brief get source position in CRS
      * @author Matthias Schartner
      *
-     * @return source position vector
+     * @param time reference time
+     * @param sta_pos station position
+     * @param dir source direction (output)
      */
-    virtual std::pair<std::pair<double, double>, std::vector<double>> getSourceInCrs(
-        unsigned int time, const std::shared_ptr<const Position> &sta_pos ) const = 0;
+    virtual void getSourceInCrs( unsigned int time, const std::shared_ptr<const Position> &sta_pos,
+                                 SourceDirection &dir ) const noexcept = 0;
 
 
     virtual std::pair<double, double> getRaDe( unsigned int time,
@@ -509,6 +542,33 @@ class AbstractSource : public VieVS_NamedObject {
                          const std::vector<double> &dxyz ) const noexcept;
 
 
+    /**
+     * @brief observed flux density per band
+     * @author Matthias Schartner
+     *
+     * @param bandId observed band id (see BandRegistry)
+     * @param gmst greenwhich meridian sedirial time
+     * @param dxyz coordinate difference of participating stations
+     * @return observed flux density per band
+     */
+    double observedFlux( unsigned long bandId, unsigned int time, double gmst,
+                         const std::vector<double> &dxyz ) const noexcept;
+
+
+    /**
+     * @brief observed flux density of several baselines
+     * @author Matthias Schartner
+     *
+     * @param bandId observed band id (see BandRegistry)
+     * @param n number of baselines
+     * @param u projected baseline lengths u (see calcUV)
+     * @param v projected baseline lengths v (see calcUV)
+     * @param flux observed flux density per baseline (output)
+     */
+    void observedFlux( unsigned long bandId, unsigned long n, const double *u, const double *v,
+                       double *flux ) const noexcept;
+
+
     /**
      * @brief calc projection of baseline in uv plane
      * @author Matthias Schartner
@@ -601,6 +661,20 @@ class AbstractSource : public VieVS_NamedObject {
     double observedFlux_model( double wavelength, unsigned int time, double gmst,
                                const std::vector<double> &dxyz ) const;
 
+
+    /**
+     * @brief calculate flux density of any band for several baselines based on available flux densities
+     * @author Matthias Schartner
+     *
+     * @param wavelength target wavelength
+     * @param n number of baselines
+     * @param u projected baseline lengths u (see calcUV)
+     * @param v projected baseline lengths v (see calcUV)
+     * @param flux observed flux density per baseline for this wavelength (output)
+     */
+    void observedFlux_model( double wavelength, unsigned long n, const double *u, const double *v,
+                             double *flux ) const;
+
     /**
      * @brief checks if flux information is available
      * @author Matthias Schartner
@@ -610,6 +684,18 @@ class AbstractSource : public VieVS_NamedObject {
      */
     bool hasFluxInformation( const std::string &band ) const { return flux_->find( band ) != flux_->end(); }
 
+
+    /**
+     * @brief checks if flux information is available
+     * @author Matthias Schartner
+     *
+     * @param bandId band id (see BandRegistry)
+     * @return true if flux information is available, otherwise false
+     */
+    bool hasFluxInformation( unsigned long bandId ) const {
+        return bandId < fluxPerBand_.size() && fluxPerBand_[bandId] != nullptr;
+    }
+
     void removeObservation() { --nObs_; }
 
     void removeScan( bool influence ) {
@@ -620,13 +706,14 @@ class AbstractSource : public VieVS_NamedObject {
     }
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     std::shared_ptr<std::unordered_map<std::string, std::unique_ptr<AbstractFlux>>>
-        flux_;                                 ///< source flux information per band
-    std::vector<Event> events_;                ///< list of all events
-    std::shared_ptr<Optimization> condition_;  ///< optimization conditions
-    Statistics statistics_;                    ///< statistics
+        flux_;                                       ///< source flux information per band
+    std::vector<const AbstractFlux *> fluxPerBand_;  ///< source flux information per band id (nullptr if missing)
+    std::vector<Event> events_;                      ///< list of all events
+    std::shared_ptr<Optimization> condition_;        ///< optimization conditions
+    Statistics statistics_;                          ///< statistics
 
     Parameters parameters_;  ///< parameters
 
@@ -29,11 +29,18 @@
 using namespace std;
 using namespace VieVS;
 
-unsigned long AbstractFlux::nextId = 0;
+std::atomic<unsigned long> AbstractFlux::nextId{ 0 };
 
 
 AbstractFlux::AbstractFlux( double wavelength ) : VieVS_Object{ nextId++ } { wavelength_ = wavelength; }
 
+
+void AbstractFlux::observedFlux( unsigned long n, const double *u, const double *v, double *flux ) const noexcept {
+    for ( unsigned long i = 0; i < n; ++i ) {
+        flux[i] = observedFlux( u[i], v[i] );
+    }
+}
+
 // std::unique_ptr<Flux> Flux::clone() const {
 //    std::unique_ptr<Flux> other(this->do_clone());
 //    assert(typeid(*this) == typeid(*other));
@@ -84,6 +84,18 @@ class AbstractFlux : public VieVS_Object {
      */
     virtual double observedFlux( double u, double v ) const noexcept = 0;
 
+
+    /**
+     * @brief flux density of several baselines
+     * @author Matthias Schartner
+     *
+     * @param n number of baselines
+     * @param u projected baseline lengths u
+     * @param v projected baseline lengths v
+     * @param flux flux density per baseline (output)
+     */
+    virtual void observedFlux( unsigned long n, const double *u, const double *v, double *flux ) const noexcept;
+
     /**
      * @brief returns true if flux model needs UV information to calculate flux density
      * @author Matthias Schartner
@@ -104,7 +116,7 @@ class AbstractFlux : public VieVS_Object {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     double wavelength_;  ///< wavelength of the band whose flux information is stored
 };
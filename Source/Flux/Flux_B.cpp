@@ -20,7 +20,13 @@
 
 
 VieVS::Flux_B::Flux_B( double wavelength, const std::vector<double> &knots, const std::vector<double> &values )
-    : AbstractFlux{ wavelength }, knots_{ knots }, values_{ values } {}
+    : AbstractFlux{ wavelength }, values_{ values } {
+    knotsSquared_.reserve( knots.size() );
+    for ( double knot : knots ) {
+        // knots are given in kilometers
+        knotsSquared_.push_back( knot < 0 ? -1.0 : ( knot * 1000.0 ) * ( knot * 1000.0 ) );
+    }
+}
 
 
 double VieVS::Flux_B::getMaximumFlux() const noexcept {
@@ -38,10 +44,10 @@ double VieVS::Flux_B::getMaximumFlux() const noexcept {
 
 double VieVS::Flux_B::observedFlux( double u, double v ) const noexcept {
     double observedFlux = 0;
-    double pbase = sqrt( u * u + v * v ) / 1000.0;
+    double pbaseSquared = u * u + v * v;
 
-    for ( int i = 1; i < knots_.size(); ++i ) {
-        if ( knots_[i] > pbase ) {
+    for ( int i = 1; i < knotsSquared_.size(); ++i ) {
+        if ( knotsSquared_[i] > pbaseSquared ) {
             observedFlux = values_[i - 1];
             break;
         }
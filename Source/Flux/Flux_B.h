@@ -82,8 +82,8 @@ class Flux_B : public AbstractFlux {
 
 
    private:
-    std::vector<double> knots_;   ///< baseline length for flux density
-    std::vector<double> values_;  ///< corresponding flux density for baseline length
+    std::vector<double> knotsSquared_;  ///< squared baseline length for flux density in square meters
+    std::vector<double> values_;        ///< corresponding flux density for baseline length
 };
 }  // namespace VieVS
 
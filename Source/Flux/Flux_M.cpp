@@ -27,11 +27,23 @@ double Flux_M::flcon1_{ ( pi * pi ) / ( 4.0 * 0.6931471 ) };  ///< constant prec
 
 VieVS::Flux_M::Flux_M( double wavelength, std::vector<double> flux, std::vector<double> majorAxis,
                        std::vector<double> axialRatio, std::vector<double> positionAngle )
-    : AbstractFlux{ wavelength },
-      flux_{ std::move( flux ) },
-      majorAxis_{ std::move( majorAxis ) },
-      axialRatio_{ std::move( axialRatio ) },
-      positionAngle_{ std::move( positionAngle ) } {}
+    : AbstractFlux{ wavelength }, flux_{ std::move( flux ) } {
+    unsigned long n = flux_.size();
+    coefUU_.resize( n );
+    coefUV_.resize( n );
+    coefVV_.resize( n );
+    for ( unsigned long i = 0; i < n; ++i ) {
+        double c = cos( positionAngle[i] );
+        double s = sin( positionAngle[i] );
+        double q2 = axialRatio[i] * axialRatio[i];
+        double k = -flcon1_ * majorAxis[i] * majorAxis[i] / ( wavelength * wavelength );
+
+        // -flcon1 * a^2 * ( (v*c + u*s)^2 + q^2 * (u*c - v*s)^2 ) with u and v in wavelengths
+        coefUU_[i] = k * ( s * s + q2 * c * c );
+        coefUV_[i] = k * 2 * c * s * ( 1 - q2 );
+        coefVV_[i] = k * ( c * c + q2 * s * s );
+    }
+}
 
 
 double Flux_M::getMaximumFlux() const noexcept {
@@ -50,26 +62,30 @@ double Flux_M::getMaximumFlux() const noexcept {
 double Flux_M::observedFlux( double u, double v ) const noexcept {
     double observedFlux = 0;
 
-    double u_w = u / AbstractFlux::getWavelength();
-    double v_w = v / AbstractFlux::getWavelength();
-
-    for ( int i = 0; i < flux_.size(); ++i ) {
-        double pa = positionAngle_[i];
-        double ucospa = u_w * cos( pa );
-        double usinpa = u_w * sin( pa );
-        double vcospa = v_w * cos( pa );
-        double vsinpa = v_w * sin( pa );
-
-        double arg1 = ( vcospa + usinpa ) * ( vcospa + usinpa );
-        double arg2 = ( axialRatio_[i] * ( ucospa - vsinpa ) ) * ( axialRatio_[i] * ( ucospa - vsinpa ) );
-        double arg = -flcon1_ * ( arg1 + arg2 ) * majorAxis_[i] * majorAxis_[i];
-        double f1 = flux_[i] * exp( arg );
-        observedFlux += f1;
+    for ( unsigned long i = 0; i < flux_.size(); ++i ) {
+        double arg = ( coefUU_[i] * u + coefUV_[i] * v ) * u + coefVV_[i] * v * v;
+        observedFlux += flux_[i] * exp( arg );
     }
 
     return observedFlux;
 }
 
+
+void Flux_M::observedFlux( unsigned long n, const double *u, const double *v, double *flux ) const noexcept {
+    fill( flux, flux + n, 0.0 );
+
+    for ( unsigned long i = 0; i < flux_.size(); ++i ) {
+        double uu = coefUU_[i];
+        double uv = coefUV_[i];
+        double vv = coefVV_[i];
+        double f = flux_[i];
+        for ( unsigned long j = 0; j < n; ++j ) {
+            double arg = ( uu * u[j] + uv * v[j] ) * u[j] + vv * v[j] * v[j];
+            flux[j] += f * exp( arg );
+        }
+    }
+}
+
 // Flux_M *Flux_M::do_clone() const {
 //    return new Flux_M(*this);
 //}
@@ -77,6 +77,20 @@ class Flux_M : public AbstractFlux {
     double observedFlux( double u, double v ) const noexcept override;
 
 
+    /**
+     * @brief observed flux density of several baselines
+     * @author Matthias Schartner
+     *
+     * Components are evaluated one after another for all baselines so that the inner loop can be vectorized.
+     *
+     * @param n number of baselines
+     * @param u projected baseline lengths u
+     * @param v projected baseline lengths v
+     * @param flux observed flux density per baseline in jansky (output)
+     */
+    void observedFlux( unsigned long n, const double *u, const double *v, double *flux ) const noexcept override;
+
+
     /**
      * @brief returns true if flux model needs UV information to calculate flux density
      * @author Matthias Schartner
@@ -86,10 +100,12 @@ class Flux_M : public AbstractFlux {
     bool needsUV() const noexcept override { return true; };
 
    private:
-    std::vector<double> flux_;           ///< flux density
-    std::vector<double> majorAxis_;      ///< major axis angle
-    std::vector<double> axialRatio_;     ///< axial ratio
-    std::vector<double> positionAngle_;  ///< position angle
+    // The exponent of each Gaussian component is a quadratic form in u and v. Its coefficients (including wavelength,
+    // major axis, axial ratio and position angle) are precalculated in the constructor.
+    std::vector<double> flux_;    ///< flux density
+    std::vector<double> coefUU_;  ///< coefficient of u*u in exponent
+    std::vector<double> coefUV_;  ///< coefficient of u*v in exponent
+    std::vector<double> coefVV_;  ///< coefficient of v*v in exponent
 
     static double flcon1_;  ///< constant precalculated value
     //        static double flcon2_; ///< constant precalculated value
@@ -24,12 +24,13 @@ Quasar::Quasar( const string& src_name, const string& src_name2, double src_ra_d
                 unordered_map<std::string, std::unique_ptr<AbstractFlux>>& src_flux )
     : AbstractSource( src_name, src_name2, src_flux ), ra_{ src_ra_deg * deg2rad }, de_{ src_de_deg * deg2rad } {
     PreCalculated preCalculated = PreCalculated();
-    preCalculated.sourceInCrs.resize( 3 );
     double sinDe = sin( de_ );
     double cosDe = cos( de_ );
-    preCalculated.sourceInCrs[0] = cosDe * cos( ra_ );
-    preCalculated.sourceInCrs[1] = cosDe * sin( ra_ );
-    preCalculated.sourceInCrs[2] = sinDe;
+    preCalculated.direction.ra = ra_;
+    preCalculated.direction.de = de_;
+    preCalculated.direction.crs[0] = cosDe * cos( ra_ );
+    preCalculated.direction.crs[1] = cosDe * sin( ra_ );
+    preCalculated.direction.crs[2] = sinDe;
 
     preCalculated_ = make_shared<PreCalculated>( move( preCalculated ) );
 }
@@ -42,12 +43,13 @@ Quasar::Quasar( const string& src_name, const string& src_name2, double src_ra_d
       de_{ src_de_deg * deg2rad } {
 
     PreCalculated preCalculated = PreCalculated();
-    preCalculated.sourceInCrs.resize( 3 );
     double sinDe = sin( de_ );
     double cosDe = cos( de_ );
-    preCalculated.sourceInCrs[0] = cosDe * cos( ra_ );
-    preCalculated.sourceInCrs[1] = cosDe * sin( ra_ );
-    preCalculated.sourceInCrs[2] = sinDe;
+    preCalculated.direction.ra = ra_;
+    preCalculated.direction.de = de_;
+    preCalculated.direction.crs[0] = cosDe * cos( ra_ );
+    preCalculated.direction.crs[1] = cosDe * sin( ra_ );
+    preCalculated.direction.crs[2] = sinDe;
 
     preCalculated_ = make_shared<PreCalculated>( move( preCalculated ) );
 }
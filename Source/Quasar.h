@@ -38,7 +38,7 @@ class Quasar : public AbstractSource {
      * @author Matthias Schartner
      */
     struct PreCalculated {
-        std::vector<double> sourceInCrs;  ///< source vector in celestrial reference frame
+        SourceDirection direction;  ///< source direction in celestrial reference frame
     };
 
     /**
@@ -72,14 +72,16 @@ class Quasar : public AbstractSource {
      * @brief get source position in CRS
      * @author Matthias Schartner
      *
-     * @return source position vector
+     * @param time reference time
+     * @param sta_pos station position
+     * @param dir source direction (output)
      */
-    std::pair<std::pair<double, double>, std::vector<double>> getSourceInCrs(
-        unsigned int time, const std::shared_ptr<const Position> &sta_pos ) const override {
-        return { getRaDe( time, sta_pos ), preCalculated_->sourceInCrs };
+    void getSourceInCrs( unsigned int time, const std::shared_ptr<const Position> &sta_pos,
+                         SourceDirection &dir ) const noexcept override {
+        dir = preCalculated_->direction;
     }
 
-    std::vector<double> getSourceInCrs() const { return preCalculated_->sourceInCrs; }
+    const std::array<double, 3> &getSourceInCrs() const noexcept { return preCalculated_->direction.crs; }
 
     /**
      * @brief this function checks if it is time to change the parameters
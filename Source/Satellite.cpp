@@ -27,45 +27,45 @@ Satellite::Satellite( const std::string& hdr, const std::string& l1, const std::
       header_{ hdr },
       line1_{ l1 },
       line2_{ l2 } {
-    auto epoch = extractReferenceEpoch(l1);
-    pSGP4Data_.emplace_back( std::make_pair(epoch, SGP4(Tle(hdr, l1, l2))));
+    addpSGP4Data( hdr, l1, l2 );
     //    startDateTime_ = internalTime2sgpt4Time(0);
     //    string tmp = TimeSystem::time2string(epoch);
     //    std::cout << tmp;
 }
 
-std::pair<std::pair<double, double>, std::vector<double>> Satellite::getSourceInCrs(
-    unsigned int time, const std::shared_ptr<const Position>& sta_pos ) const {
+void Satellite::getSourceInCrs( unsigned int time, const std::shared_ptr<const Position>& sta_pos,
+                                SourceDirection& dir ) const noexcept {
     auto srcRaDe = getRaDe( time, sta_pos );
     double cosDe = cos( srcRaDe.second );
 
-    return { srcRaDe, { cosDe * cos( srcRaDe.first ), cosDe * sin( srcRaDe.first ), sin( srcRaDe.second ) } };
+    dir.ra = srcRaDe.first;
+    dir.de = srcRaDe.second;
+    dir.crs[0] = cosDe * cos( srcRaDe.first );
+    dir.crs[1] = cosDe * sin( srcRaDe.first );
+    dir.crs[2] = sin( srcRaDe.second );
 }
 
 std::tuple<double, double, double, double> Satellite::calcRaDeDistTime(
     unsigned int time, const std::shared_ptr<const Position>& sta_pos ) const noexcept {
+    double ra, de, r;
+    unsigned long idx;
+    calcTopocentric( time, sta_pos, ra, de, r, idx );
+    double dt = abs( ( pSGP4Data_[idx].first - TimeSystem::internalTime2PosixTime( time ) ).total_seconds() / 86400.0 );
+    return make_tuple( ra, de, r * 1e3, dt );
+}
+
+pair<double, double> Satellite::calcRaDe( unsigned int time, const std::shared_ptr<const Position>& sta_pos ) const {
+    double ra, de, r;
+    unsigned long idx;
+    calcTopocentric( time, sta_pos, ra, de, r, idx );
+    return make_pair( ra, de );
+}
+
+void Satellite::calcTopocentric( unsigned int time, const std::shared_ptr<const Position>& sta_pos, double& ra,
+                                 double& de, double& r, unsigned long& tleIdx ) const {
     DateTime currentTime = TimeSystem::startSgp4.AddSeconds( time );
-    unsigned long idx = 0;
-    if ( pSGP4Data_.size() > 1 ) {
-        boost::posix_time::ptime ref = TimeSystem::internalTime2PosixTime( time );
-        long dt = numeric_limits<long>::max();
-
-        for ( int i = 0; i < pSGP4Data_.size(); ++i ) {
-            const auto& any = pSGP4Data_[i];
-            //            string x = TimeSystem::time2string(any.first);
-            //            string y = TimeSystem::time2string(ref);
-
-            long n = ( any.first - ref ).total_seconds();
-            n = abs( n );
-            if ( n < dt ) {
-                idx = i;
-                dt = n;
-            }
-        }
-    }
+    Eci eci = findPosition( time, currentTime, tleIdx );
 
-    Eci eci = pSGP4Data_[idx].second.FindPosition( currentTime );
-    double dt = abs( ( pSGP4Data_[idx].first - TimeSystem::internalTime2PosixTime( time ) ).total_seconds() / 86400.0 );
     CoordGeodetic station;
     if ( sta_pos != nullptr ) {
         station = CoordGeodetic( sta_pos->getLat(), sta_pos->getLon(), sta_pos->getAltitude() / 1000., true );
@@ -80,66 +80,205 @@ std::tuple<double, double, double, double> Satellite::calcRaDeDistTime(
     Vector vd = eci.Velocity() - stat.Velocity();
 
     // calculation of right ascension and declination for satellite
-    double r = sqrt( xd.x * xd.x + xd.y * xd.y + xd.z * xd.z );
-    double de = asin( xd.z / r );
-    double ra;
+    r = sqrt( xd.x * xd.x + xd.y * xd.y + xd.z * xd.z );
+    de = asin( xd.z / r );
 
     if ( sqrt( xd.x * xd.x + xd.y * xd.y ) < 0.00000001 ) {
         ra = atan2( vd.y, vd.x );
     } else {
         ra = atan2( xd.y, xd.x );
     }
-    return make_tuple( ra, de, r * 1e3, dt );
 }
 
-pair<double, double> Satellite::calcRaDe( unsigned int time, const std::shared_ptr<const Position>& sta_pos ) const {
-    DateTime currentTime = TimeSystem::startSgp4.AddSeconds( time );
+void Satellite::addpSGP4Data( const std::string& hdr, const std::string& l1, const std::string& l2 ) {
+    auto epoch = extractReferenceEpoch( l1 );
+    pSGP4Data_.emplace_back( std::make_pair( epoch, SGP4( Tle( hdr, l1, l2 ) ) ) );
+    tleData_.append( hdr ).append( "\n" ).append( l1 ).append( "\n" ).append( l2 ).append( "\n" );
+
+    // keep index sorted by epoch (entries with equal epoch in insertion order)
+    auto element = make_pair( epoch, pSGP4Data_.size() - 1 );
+    tleIndex_.insert( upper_bound( tleIndex_.begin(), tleIndex_.end(), element,
+                                   []( const pair<boost::posix_time::ptime, unsigned long>& a,
+                                       const pair<boost::posix_time::ptime, unsigned long>& b ) {
+                                       return a.first < b.first;
+                                   } ),
+                      element );
+
+    // orbit data changed, tabulated positions are no longer valid
+    ephemeris_.reset();
+}
+
+unsigned long Satellite::nearestTle( unsigned int time ) const noexcept {
+    if ( pSGP4Data_.size() <= 1 ) {
+        return 0;
+    }
+    boost::posix_time::ptime ref = TimeSystem::internalTime2PosixTime( time );
+
+    auto cmp = []( const pair<boost::posix_time::ptime, unsigned long>& a, const boost::posix_time::ptime& b ) {
+        return a.first < b;
+    };
+    auto after = lower_bound( tleIndex_.begin(), tleIndex_.end(), ref, cmp );
+
+    // closest epoch before and after reference time; in case of equal distance the first entry in insertion order
+    // is used (as with a linear search)
     unsigned long idx = 0;
-    if ( pSGP4Data_.size() > 1 ) {
-        boost::posix_time::ptime ref = TimeSystem::internalTime2PosixTime( time );
-        long dt = numeric_limits<long>::max();
-
-        for ( int i = 0; i < pSGP4Data_.size(); ++i ) {
-            const auto& any = pSGP4Data_[i];
-            //            string x = TimeSystem::time2string(any.first);
-//            string y = TimeSystem::time2string(ref);
-
-            long n = (any.first - ref).total_seconds();
-            n = abs(n);
-            if (n < dt){
-                idx = i;
-                dt = n;
+    long dt = numeric_limits<long>::max();
+    auto check = [&]( vector<pair<boost::posix_time::ptime, unsigned long>>::const_iterator it ) {
+        // first entry with this epoch
+        it = lower_bound( tleIndex_.begin(), it, it->first, cmp );
+        long n = abs( ( it->first - ref ).total_seconds() );
+        if ( n < dt || ( n == dt && it->second < idx ) ) {
+            idx = it->second;
+            dt = n;
+        }
+    };
+    if ( after != tleIndex_.begin() ) {
+        check( after - 1 );
+    }
+    if ( after != tleIndex_.end() ) {
+        check( after );
+    }
+    return idx;
+}
+
+Eci Satellite::findPosition( unsigned int time, const DateTime& currentTime, unsigned long& tleIdx ) const {
+    if ( ephemeris_ != nullptr ) {
+        const Ephemeris& eph = *ephemeris_;
+        unsigned long i = time / eph.step;
+        if ( i + 1 < eph.tle.size() && eph.tle[i] == eph.tle[i + 1] ) {
+            tleIdx = eph.tle[i];
+
+            // cubic Hermite interpolation of position and velocity
+            double h = eph.step;
+            double t = static_cast<double>( time - i * eph.step ) / h;
+            double t2 = t * t;
+            double t3 = t2 * t;
+            double h00 = 2 * t3 - 3 * t2 + 1;
+            double h10 = t3 - 2 * t2 + t;
+            double h01 = -2 * t3 + 3 * t2;
+            double h11 = t3 - t2;
+            double d00 = 6 * t2 - 6 * t;
+            double d10 = 3 * t2 - 4 * t + 1;
+            double d01 = -6 * t2 + 6 * t;
+            double d11 = 3 * t2 - 2 * t;
+
+            const double* p0 = &eph.position[3 * i];
+            const double* p1 = &eph.position[3 * ( i + 1 )];
+            const double* v0 = &eph.velocity[3 * i];
+            const double* v1 = &eph.velocity[3 * ( i + 1 )];
+            double p[3];
+            double v[3];
+            for ( int j = 0; j < 3; ++j ) {
+                p[j] = h00 * p0[j] + h10 * h * v0[j] + h01 * p1[j] + h11 * h * v1[j];
+                v[j] = ( d00 * p0[j] + d10 * h * v0[j] + d01 * p1[j] + d11 * h * v1[j] ) / h;
             }
+            return Eci( currentTime, Vector( p[0], p[1], p[2] ), Vector( v[0], v[1], v[2] ) );
         }
     }
 
-    Eci eci = pSGP4Data_[idx].second.FindPosition( currentTime );
-    CoordGeodetic station;
-    if ( sta_pos != nullptr ) {
-        station = CoordGeodetic( sta_pos->getLat(), sta_pos->getLon(), sta_pos->getAltitude()/1000., true );
+    tleIdx = nearestTle( time );
+    return pSGP4Data_[tleIdx].second.FindPosition( currentTime );
+}
+
+void Satellite::precalcEphemeris( unsigned int end, unsigned int step, double maxError, unsigned int minStep ) {
+    ephemeris_.reset();
+    if ( step == 0 ) {
+        return;
     }
 
-    Eci stat( currentTime, station );
+    // direct propagation with nearest TLE data
+    auto propagate = [this]( unsigned int time, unsigned long& tle, double* position, double* velocity ) {
+        tle = nearestTle( time );
+        Eci eci = pSGP4Data_[tle].second.FindPosition( TimeSystem::startSgp4.AddSeconds( time ) );
+        Vector p = eci.Position();
+        Vector v = eci.Velocity();
+        position[0] = p.x;
+        position[1] = p.y;
+        position[2] = p.z;
+        velocity[0] = v.x;
+        velocity[1] = v.y;
+        velocity[2] = v.z;
+    };
 
-    // difference vector between station and satellite
-    Vector x_sat = eci.Position();
-    Vector x_stat = stat.Position();
-    Vector xd = x_sat - x_stat;
-    Vector vd = eci.Velocity() - stat.Velocity();
+    try {
+        auto eph = make_shared<Ephemeris>();
+        eph->step = step;
+        unsigned long n = end / step + 2;
+        eph->tle.resize( n );
+        eph->position.resize( 3 * n );
+        eph->velocity.resize( 3 * n );
+        for ( unsigned long i = 0; i < n; ++i ) {
+            propagate( static_cast<unsigned int>( i * step ), eph->tle[i], &eph->position[3 * i],
+                       &eph->velocity[3 * i] );
+        }
+        ephemeris_ = eph;
 
-    // calculation of right ascension and declination for satellite
-    double r = sqrt( xd.x * xd.x + xd.y * xd.y + xd.z * xd.z );
-    double de = asin( xd.z / r );
-    double ra;
+        while ( true ) {
+            // accuracy check against direct propagation in the middle of each interval, these epochs are reused if
+            // the grid spacing is halved
+            unsigned int half = eph->step / 2;
+            vector<unsigned long> midTle( n - 1 );
+            vector<double> midPosition( 3 * ( n - 1 ) );
+            vector<double> midVelocity( 3 * ( n - 1 ) );
+            double error = 0;
+            for ( unsigned long i = 0; i + 1 < n; ++i ) {
+                auto time = static_cast<unsigned int>( i * eph->step + half );
+                propagate( time, midTle[i], &midPosition[3 * i], &midVelocity[3 * i] );
+                if ( eph->tle[i] == eph->tle[i + 1] ) {
+                    unsigned long idx;
+                    Vector interpolated =
+                        findPosition( time, TimeSystem::startSgp4.AddSeconds( time ), idx ).Position();
+                    Vector direct( midPosition[3 * i], midPosition[3 * i + 1], midPosition[3 * i + 2] );
+                    error = max( error, ( interpolated - direct ).Magnitude() );
+                }
+            }
+            eph->maxError = error;
+            if ( error <= maxError || eph->step % 2 != 0 || half < minStep ) {
+                break;
+            }
 
-    if(sqrt(xd.x*xd.x + xd.y*xd.y) < 0.00000001) {
-        ra = atan2(vd.y,vd.x);
-    }
-    else {
-        ra = atan2(xd.y,xd.x);
+            // halve grid spacing: previous epochs and middle epochs alternate
+            auto fine = make_shared<Ephemeris>();
+            fine->step = half;
+            unsigned long m = 2 * n - 1;
+            fine->tle.resize( m );
+            fine->position.resize( 3 * m );
+            fine->velocity.resize( 3 * m );
+            for ( unsigned long i = 0; i < n; ++i ) {
+                fine->tle[2 * i] = eph->tle[i];
+                copy_n( &eph->position[3 * i], 3, &fine->position[6 * i] );
+                copy_n( &eph->velocity[3 * i], 3, &fine->velocity[6 * i] );
+                if ( i + 1 < n ) {
+                    fine->tle[2 * i + 1] = midTle[i];
+                    copy_n( &midPosition[3 * i], 3, &fine->position[6 * i + 3] );
+                    copy_n( &midVelocity[3 * i], 3, &fine->velocity[6 * i + 3] );
+                }
+            }
+            eph = fine;
+            n = m;
+            ephemeris_ = eph;
+        }
+
+        if ( eph->maxError > maxError ) {
+            auto msg = boost::format( "satellite %s tabulated with %d s spacing, interpolation error %.3f m" ) %
+                       getName() % eph->step % ( eph->maxError * 1e3 );
+#ifdef VIESCHEDPP_LOG
+            BOOST_LOG_TRIVIAL( warning ) << msg;
+#else
+            cout << "[warning] " << msg << "\n";
+#endif
+        }
+    } catch ( ... ) {
+        // propagation failed (e.g. decayed satellite), positions are calculated on request
+        ephemeris_.reset();
+#ifdef VIESCHEDPP_LOG
+        BOOST_LOG_TRIVIAL( warning ) << "satellite " << getName() << " cannot be tabulated, using direct propagation";
+#else
+        cout << "[warning] satellite " << getName() << " cannot be tabulated, using direct propagation\n";
+#endif
     }
-    return make_pair( ra, de );
 }
+
 boost::posix_time::ptime Satellite::extractReferenceEpoch( const std::string& l1 ) {
     string datestr = l1.substr(18,14);
     int year = boost::lexical_cast<int>(datestr.substr(0,2));
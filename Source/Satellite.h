@@ -61,10 +61,11 @@ class Satellite : public AbstractSource {
      * @author Matthias Schartner
      *
      * @param time reference time
-     * @return source position in celestial reference frame
+     * @param sta_pos station position
+     * @param dir source position in celestial reference frame (output)
      */
-    std::pair<std::pair<double, double>, std::vector<double>> getSourceInCrs(
-        unsigned int time, const std::shared_ptr<const Position> &sta_pos ) const override;
+    void getSourceInCrs( unsigned int time, const std::shared_ptr<const Position> &sta_pos,
+                         SourceDirection &dir ) const noexcept override;
 
     std::pair<double, double> getRaDe( unsigned int time,
                                        const std::shared_ptr<const Position> &sta_pos ) const noexcept override {
@@ -84,12 +85,75 @@ class Satellite : public AbstractSource {
         unsigned int time, const std::shared_ptr<const Position> &sta_pos ) const noexcept override;
 
 
-    void addpSGP4Data( const std::string &hdr, const std::string &l1, const std::string &l2 ) {
-        auto epoch = extractReferenceEpoch( l1 );
-        pSGP4Data_.emplace_back( std::make_pair( epoch, SGP4( Tle( hdr, l1, l2 ) ) ) );
-        //        std::string tmp = TimeSystem::time2string(epoch);
-        //        std::cout << tmp;
-    }
+    /**
+     * @brief add additional TLE data
+     * @author Matthias Schartner
+     *
+     * Tabulated positions (see precalcEphemeris) are discarded.
+     *
+     * @param hdr header line of TLE data
+     * @param l1 first line of TLE data
+     * @param l2 second line of TLE data
+     */
+    void addpSGP4Data( const std::string &hdr, const std::string &l1, const std::string &l2 );
+
+
+    /**
+     * @brief tabulate satellite position and velocity over the session
+     * @author Matthias Schartner
+     *
+     * The orbit is propagated once on a uniform time grid. Afterwards, positions are calculated via cubic Hermite
+     * interpolation of tabulated positions and velocities. The interpolation error is checked against direct SGP4
+     * propagation in the middle of each interval. While the error is above maxError, the grid spacing is halved (the
+     * middle epochs become the new epochs), but never below minStep. The memory footprint is therefore bounded by
+     * end / minStep + 2 epochs of 56 bytes. Intervals with a change of the nearest TLE are always propagated directly.
+     *
+     * Must be called after all TLE data is added. Different satellites can be tabulated in parallel.
+     *
+     * @param end end of table in seconds since session start
+     * @param step initial grid spacing in seconds
+     * @param maxError maximum interpolation error in km
+     * @param minStep minimum grid spacing in seconds
+     */
+    void precalcEphemeris( unsigned int end, unsigned int step = 60, double maxError = 1e-3,
+                           unsigned int minStep = 15 );
+
+
+    /**
+     * @brief maximum interpolation error of tabulated positions
+     * @author Matthias Schartner
+     *
+     * @return maximum interpolation error in km at the final grid spacing (0 if not tabulated)
+     */
+    double getEphemerisError() const noexcept { return ephemeris_ != nullptr ? ephemeris_->maxError : 0; }
+
+
+    /**
+     * @brief grid spacing of tabulated positions
+     * @author Matthias Schartner
+     *
+     * @return grid spacing in seconds (0 if not tabulated)
+     */
+    unsigned int getEphemerisStep() const noexcept { return ephemeris_ != nullptr ? ephemeris_->step : 0; }
+
+    /**
+     * @brief index of TLE data with closest reference epoch
+     * @author Matthias Schartner
+     *
+     * @param time time in seconds since session start
+     * @return index in pSGP4Data_
+     */
+    unsigned long nearestTle( unsigned int time ) const noexcept;
+
+
+    /**
+     * @brief getter for all TLE data
+     * @author Matthias Schartner
+     *
+     * @return header, first and second line of all added TLE data (newline separated)
+     */
+    const std::string &getTleData() const noexcept { return tleData_; }
+
 
     std::string getNameTime( unsigned int t ) const {
         return ( boost::format( "%s<=>%s" ) % getName() % TimeSystem::time2string_doy_minus( t ) ).str();
@@ -98,11 +162,54 @@ class Satellite : public AbstractSource {
     static boost::posix_time::ptime extractReferenceEpoch( const std::string &l1 );
 
    private:
-    static unsigned long nextId;                                        ///< next id for this object type
+    /**
+     * @brief tabulated satellite positions
+     * @author Matthias Schartner
+     */
+    struct Ephemeris {
+        unsigned int step = 0;           ///< grid spacing in seconds
+        std::vector<unsigned long> tle;  ///< index of used TLE data per epoch
+        std::vector<double> position;    ///< ECI position per epoch (x, y, z) in km
+        std::vector<double> velocity;    ///< ECI velocity per epoch (x, y, z) in km/s
+        double maxError = 0;             ///< maximum interpolation error in km (middle of intervals)
+    };
+
+    static std::atomic<unsigned long> nextId;                           ///< next id for this object type
     std::string header_;                                                ///< header line of TLE Data
     std::string line1_;                                                 ///< first line of TLE Data
     std::string line2_;                                                 ///< second line of TLE Data
+    std::string tleData_;                                               ///< all added TLE data
     std::vector<std::pair<boost::posix_time::ptime, SGP4>> pSGP4Data_;  ///< pointer to SGP4 Data + epoch
+    std::vector<std::pair<boost::posix_time::ptime, unsigned long>>
+        tleIndex_;  ///< epoch and index of SGP4 Data sorted by epoch
+    std::shared_ptr<const Ephemeris> ephemeris_;  ///< tabulated positions (shared between copies)
+
+
+    /**
+     * @brief satellite position and velocity in ECI
+     * @author Matthias Schartner
+     *
+     * @param time time in seconds since session start
+     * @param currentTime time in SGP4 format
+     * @param tleIdx index of used TLE data (output)
+     * @return satellite position and velocity
+     */
+    Eci findPosition( unsigned int time, const DateTime &currentTime, unsigned long &tleIdx ) const;
+
+
+    /**
+     * @brief right ascension, declination and distance of satellite seen from station
+     * @author Matthias Schartner
+     *
+     * @param time time in seconds since session start
+     * @param sta_pos station position
+     * @param ra right ascension (output)
+     * @param de declination (output)
+     * @param r distance in km (output)
+     * @param tleIdx index of used TLE data (output)
+     */
+    void calcTopocentric( unsigned int time, const std::shared_ptr<const Position> &sta_pos, double &ra, double &de,
+                          double &r, unsigned long &tleIdx ) const;
 
 };
 }  // namespace VieVS
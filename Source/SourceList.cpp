@@ -21,7 +21,7 @@
 using namespace std;
 using namespace VieVS;
 
-unsigned long VieVS::SourceList::nextId = 0;
+std::atomic<unsigned long> VieVS::SourceList::nextId{ 0 };
 
 SourceList::SourceList( const SourceList& rhs ) : VieVS_Object( nextId++ ) {
     for ( const auto& any : rhs.getQuasars() ) {
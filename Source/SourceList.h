@@ -137,7 +137,7 @@ class SourceList : public VieVS_Object {
     bool isSatellite( unsigned long id ) const { return id >= nquasars_ && id < nquasars_ + nsatellites_; }
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     std::vector<std::shared_ptr<AbstractSource>> sources_;
     std::vector<std::shared_ptr<Quasar>> quasars_;
@@ -21,7 +21,7 @@
 
 using namespace std;
 using namespace VieVS;
-unsigned long AbstractAntenna::nextId = 0;
+std::atomic<unsigned long> AbstractAntenna::nextId{ 0 };
 
 
 AbstractAntenna::AbstractAntenna( double offset_m, double diam_m, double rate1_deg_per_min,
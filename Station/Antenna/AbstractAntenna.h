@@ -181,7 +181,7 @@ class AbstractAntenna : public VieVS_Object {
     virtual std::string toVex( Axis axis ) const = 0;
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     double offset_;      ///< offset of the antenna axis intersection in meters
     double diam_;        ///< diameter of the antenna dish in meters
@@ -0,0 +1,268 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AzElPrecalc.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+AzElPrecalc::AzElPrecalc( const AzElPrecalc &other )
+    : step_{ other.step_ },
+      shared_{ other.shared_ },
+      grid_{ other.shared_ ? other.grid_ : make_shared<vector<Sample>>( *other.grid_ ) },
+      extras_{ other.extras_ } {}
+
+
+AzElPrecalc::AzElPrecalc( AzElPrecalc &&other ) noexcept
+    : step_{ other.step_ },
+      shared_{ other.shared_ },
+      grid_{ std::move( other.grid_ ) },
+      extras_{ std::move( other.extras_ ) } {
+    other.clear();
+}
+
+
+AzElPrecalc &AzElPrecalc::operator=( const AzElPrecalc &other ) {
+    if ( this != &other ) {
+        step_ = other.step_;
+        shared_ = other.shared_;
+        grid_ = other.shared_ ? other.grid_ : make_shared<vector<Sample>>( *other.grid_ );
+        extras_ = other.extras_;
+    }
+    return *this;
+}
+
+
+AzElPrecalc &AzElPrecalc::operator=( AzElPrecalc &&other ) noexcept {
+    if ( this != &other ) {
+        step_ = other.step_;
+        shared_ = other.shared_;
+        grid_ = std::move( other.grid_ );
+        extras_ = std::move( other.extras_ );
+        other.clear();
+    }
+    return *this;
+}
+
+
+const std::shared_ptr<std::vector<AzElPrecalc::Sample>> &AzElPrecalc::emptyGrid() noexcept {
+    // shared (read only), so it is never modified
+    static const shared_ptr<vector<Sample>> grid = make_shared<vector<Sample>>();
+    return grid;
+}
+
+
+void AzElPrecalc::setGrid( unsigned int step, unsigned int end ) {
+    step_ = step;
+    shared_ = false;
+    grid_ = make_shared<vector<Sample>>();
+    if ( step_ == 0 ) {
+        return;
+    }
+    vector<Sample> &grid = *grid_;
+    grid.resize( ( end + step_ - 1 ) / step_ );
+    for ( unsigned long i = 0; i < grid.size(); ++i ) {
+        grid[i].time = static_cast<unsigned int>( i * step_ );
+    }
+
+    // move all values which are located on the grid
+    vector<Sample> extras;
+    for ( const auto &any : extras_ ) {
+        long idx = gridIndex( any.time );
+        if ( idx >= 0 ) {
+            grid[idx] = any;
+        } else {
+            extras.push_back( any );
+        }
+    }
+    extras_ = std::move( extras );
+}
+
+
+void AzElPrecalc::save( PrecalcCache::Writer &writer ) const {
+    writer.write( step_ );
+    writer.write( *grid_ );
+}
+
+
+bool AzElPrecalc::load( PrecalcCache::Reader &reader ) {
+    unsigned int step;
+    auto grid = make_shared<vector<Sample>>();
+    if ( !reader.read( step ) || !reader.read( *grid ) ) {
+        return false;
+    }
+    for ( unsigned long i = 0; i < grid->size(); ++i ) {
+        if ( ( *grid )[i].time != i * step ) {
+            return false;
+        }
+    }
+
+    step_ = step;
+    shared_ = false;
+    grid_ = grid;
+    extras_.erase( remove_if( extras_.begin(), extras_.end(),
+                              [this]( const Sample &any ) { return gridIndex( any.time ) >= 0; } ),
+                   extras_.end() );
+    return true;
+}
+
+
+void AzElPrecalc::insert( const PointingVector &p ) {
+    Sample s;
+    s.time = p.getTime();
+    s.valid = true;
+    s.az = p.getAz();
+    s.el = p.getEl();
+    s.ha = p.getHa();
+    s.dc = p.getDc();
+
+    long idx = gridIndex( s.time );
+    if ( idx >= 0 ) {
+        if ( !shared_ ) {
+            ( *grid_ )[idx] = s;
+            return;
+        }
+        // shared grid is read only, missing values are stored as additional epochs
+        if ( ( *grid_ )[idx].valid ) {
+            return;
+        }
+    }
+
+    auto it = lower_bound( extras_.begin(), extras_.end(), s.time,
+                           []( const Sample &a, unsigned int time ) { return a.time < time; } );
+    if ( it != extras_.end() && it->time == s.time ) {
+        *it = s;
+    } else {
+        extras_.insert( it, s );
+    }
+}
+
+
+bool AzElPrecalc::lookup( PointingVector &p ) const noexcept {
+    unsigned int time = p.getTime();
+
+    long idx = gridIndex( time );
+    if ( idx >= 0 && ( *grid_ )[idx].valid ) {
+        set( ( *grid_ )[idx], p );
+        return true;
+    }
+
+    auto it = lower_bound( extras_.begin(), extras_.end(), time,
+                           []( const Sample &a, unsigned int time ) { return a.time < time; } );
+    if ( it != extras_.end() && it->time == time ) {
+        set( *it, p );
+        return true;
+    }
+    return false;
+}
+
+
+void AzElPrecalc::interpolate( PointingVector &p ) const noexcept {
+    unsigned int time = p.getTime();
+    const vector<Sample> &grid = *grid_;
+
+    // inside the grid: direct index computation
+    if ( step_ > 0 && !grid.empty() ) {
+        unsigned long idx = time / step_;
+        if ( idx < grid.size() && grid[idx].valid ) {
+            if ( time % step_ == 0 ) {
+                set( grid[idx], p );
+                return;
+            }
+            if ( idx + 1 < grid.size() && grid[idx + 1].valid ) {
+                interpolate( grid[idx], grid[idx + 1], p );
+                return;
+            }
+        }
+    }
+
+    // outside the grid: closest stored values before and after the requested time
+    const Sample *s1 = nullptr;
+    const Sample *s2 = nullptr;
+    if ( !grid.empty() && grid.back().valid && grid.back().time <= time ) {
+        s1 = &grid.back();
+    }
+    auto it = lower_bound( extras_.begin(), extras_.end(), time,
+                           []( const Sample &a, unsigned int time ) { return a.time < time; } );
+    if ( it != extras_.end() ) {
+        if ( it->time == time ) {
+            set( *it, p );
+            return;
+        }
+        s2 = &*it;
+    }
+    if ( it != extras_.begin() && ( s1 == nullptr || prev( it )->time > s1->time ) ) {
+        s1 = &*prev( it );
+    }
+
+    if ( s1 != nullptr && s2 != nullptr ) {
+        interpolate( *s1, *s2, p );
+    } else if ( s1 != nullptr ) {
+        set( *s1, p );
+    } else if ( s2 != nullptr ) {
+        set( *s2, p );
+    }
+}
+
+
+unsigned long AzElPrecalc::size() const noexcept {
+    unsigned long n = extras_.size();
+    for ( const auto &any : *grid_ ) {
+        if ( any.valid ) {
+            ++n;
+        }
+    }
+    return n;
+}
+
+
+void AzElPrecalc::interpolate( const Sample &s1, const Sample &s2, PointingVector &p ) noexcept {
+    unsigned int time = p.getTime();
+
+    int dt = s2.time - s1.time;
+    double factor = static_cast<double>( time - s1.time ) / static_cast<double>( dt );
+
+    double az;
+    if ( abs( s1.az - s2.az ) > halfpi ) {
+        az = s1.az + factor * ( s2.az - s1.az );
+        while ( az > twopi ) {
+            az -= twopi;
+        }
+    } else {
+        az = s1.az + factor * ( s2.az - s1.az );
+    }
+
+    double el = s1.el + factor * ( s2.el - s1.el );
+
+    double ha;
+    if ( abs( s1.ha - s2.ha ) > halfpi ) {
+        ha = s1.ha + factor * ( s2.ha - s1.ha );
+        while ( ha > twopi ) {
+            ha -= twopi;
+        }
+    } else {
+        ha = s1.ha + factor * ( s2.ha - s1.ha );
+    }
+
+    p.setAz( az );
+    p.setEl( el );
+    p.setHa( ha );
+    p.setDc( s2.dc );
+}
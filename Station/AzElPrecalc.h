@@ -0,0 +1,285 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file AzElPrecalc.h
+ * @brief class AzElPrecalc
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+
+#ifndef AZELPRECALC_H
+#define AZELPRECALC_H
+
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "../Misc/Constants.h"
+#include "../Misc/PrecalcCache.h"
+#include "../Scan/PointingVector.h"
+
+
+namespace VieVS {
+
+/**
+ * @class AzElPrecalc
+ * @brief pre calculated azimuth, elevation, hour angle and declination of one source seen from one station
+ *
+ * Values on a uniform time grid (starting at time 0) are accessed by direct index computation. Values at all other
+ * epochs (e.g. from rigorous calculations during scan selection) are stored in a separate list sorted by time.
+ *
+ * Once the grid is shared (see share()) it is read only and all copies of this object reference the same grid. Only
+ * the list of additional epochs is copied. This avoids deep copies of the precalculated values in multi scheduling.
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+class AzElPrecalc {
+   public:
+    /**
+     * @brief empty default constructor
+     * @author Matthias Schartner
+     */
+    AzElPrecalc() = default;
+
+
+    /**
+     * @brief copy constructor
+     * @author Matthias Schartner
+     *
+     * A shared grid is referenced, otherwise it is copied.
+     *
+     * @param other other object
+     */
+    AzElPrecalc( const AzElPrecalc &other );
+
+
+    /**
+     * @brief move constructor
+     * @author Matthias Schartner
+     *
+     * The moved-from object is left with an empty grid.
+     *
+     * @param other other object
+     */
+    AzElPrecalc( AzElPrecalc &&other ) noexcept;
+
+
+    /**
+     * @brief copy assignment operator
+     * @author Matthias Schartner
+     *
+     * @param other other object
+     * @return copy of other object
+     */
+    AzElPrecalc &operator=( const AzElPrecalc &other );
+
+
+    /**
+     * @brief move assignment operator
+     * @author Matthias Schartner
+     *
+     * The moved-from object is left with an empty grid.
+     *
+     * @param other other object
+     * @return moved object
+     */
+    AzElPrecalc &operator=( AzElPrecalc &&other ) noexcept;
+
+
+    /**
+     * @brief define uniform time grid
+     * @author Matthias Schartner
+     *
+     * Already stored values which are located on the new grid are moved to the grid.
+     *
+     * @param step grid spacing in seconds
+     * @param end end of grid in seconds since session start (exclusive)
+     */
+    void setGrid( unsigned int step, unsigned int end );
+
+
+    /**
+     * @brief mark grid as read only and share it with all copies of this object
+     * @author Matthias Schartner
+     *
+     * Rigorously calculated values at grid epochs which are not yet stored are afterwards saved in the list of
+     * additional epochs.
+     */
+    void share() noexcept { shared_ = true; }
+
+
+    /**
+     * @brief store a rigorously calculated value
+     * @author Matthias Schartner
+     *
+     * @param p pointing vector with time, azimuth, elevation, hour angle and declination
+     */
+    void insert( const PointingVector &p );
+
+
+    /**
+     * @brief look for a stored value at this epoch
+     * @author Matthias Schartner
+     *
+     * @param p pointing vector (time is used as input, azimuth, elevation, hour angle and declination are set)
+     * @return true if a value for this epoch is stored
+     */
+    bool lookup( PointingVector &p ) const noexcept;
+
+
+    /**
+     * @brief interpolate azimuth, elevation, hour angle and declination
+     * @author Matthias Schartner
+     *
+     * Linear interpolation between the two neighbouring grid epochs. Outside the grid the closest stored epochs
+     * before and after the requested time are used.
+     *
+     * @param p pointing vector (time is used as input, azimuth, elevation, hour angle and declination are set)
+     */
+    void interpolate( PointingVector &p ) const noexcept;
+
+
+    /**
+     * @brief write grid to cache
+     * @author Matthias Schartner
+     *
+     * @param writer cache writer
+     */
+    void save( PrecalcCache::Writer &writer ) const;
+
+
+    /**
+     * @brief read grid from cache
+     * @author Matthias Schartner
+     *
+     * Values at other epochs which are located on the read grid are discarded.
+     *
+     * @param reader cache reader
+     * @return true if successful
+     */
+    bool load( PrecalcCache::Reader &reader );
+
+
+    /**
+     * @brief getter for grid spacing
+     * @author Matthias Schartner
+     *
+     * @return grid spacing in seconds (0 if no grid is defined)
+     */
+    unsigned int getStep() const noexcept { return step_; }
+
+
+    /**
+     * @brief number of stored values
+     * @author Matthias Schartner
+     *
+     * @return number of stored values
+     */
+    unsigned long size() const noexcept;
+
+   private:
+    /**
+     * @brief stored value
+     * @author Matthias Schartner
+     */
+    struct Sample {
+        unsigned int time = 0;  ///< time in seconds since session start
+        bool valid = false;     ///< flag if value is calculated
+        double az = 0;          ///< azimuth
+        double el = 0;          ///< elevation
+        double ha = 0;          ///< hour angle
+        double dc = 0;          ///< declination
+    };
+
+    unsigned int step_ = 0;                                                   ///< grid spacing
+    bool shared_ = false;                                                     ///< flag if grid is read only
+    std::shared_ptr<std::vector<Sample>> grid_{ new std::vector<Sample>() };  ///< values on uniform time grid
+    std::vector<Sample> extras_;                                              ///< values at other epochs sorted by time
+
+
+    /**
+     * @brief empty read only grid
+     * @author Matthias Schartner
+     *
+     * Referenced by moved-from objects.
+     *
+     * @return empty grid
+     */
+    static const std::shared_ptr<std::vector<Sample>> &emptyGrid() noexcept;
+
+
+    /**
+     * @brief reset to empty grid without additional epochs
+     * @author Matthias Schartner
+     */
+    void clear() noexcept {
+        step_ = 0;
+        shared_ = true;
+        grid_ = emptyGrid();
+        extras_.clear();
+    }
+
+
+    /**
+     * @brief find index on grid
+     * @author Matthias Schartner
+     *
+     * @param time time in seconds since session start
+     * @return grid index or -1 if time is not on grid
+     */
+    long gridIndex( unsigned int time ) const noexcept {
+        if ( step_ == 0 || time % step_ != 0 || time / step_ >= grid_->size() ) {
+            return -1;
+        }
+        return static_cast<long>( time / step_ );
+    }
+
+
+    /**
+     * @brief linear interpolation between two stored values
+     * @author Matthias Schartner
+     *
+     * @param s1 stored value before requested time
+     * @param s2 stored value after requested time
+     * @param p pointing vector
+     */
+    static void interpolate( const Sample &s1, const Sample &s2, PointingVector &p ) noexcept;
+
+
+    /**
+     * @brief copy stored value to pointing vector
+     * @author Matthias Schartner
+     *
+     * @param s stored value
+     * @param p pointing vector
+     */
+    static void set( const Sample &s, PointingVector &p ) noexcept {
+        p.setAz( s.az );
+        p.setEl( s.el );
+        p.setHa( s.ha );
+        p.setDc( s.dc );
+    }
+};
+}  // namespace VieVS
+
+#endif  // AZELPRECALC_H
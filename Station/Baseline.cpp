@@ -29,14 +29,15 @@
 using namespace std;
 using namespace VieVS;
 
-unsigned long Baseline::nextId = 0;
-unsigned long VieVS::Baseline::Parameters::nextId = 0;
+std::atomic<unsigned long> Baseline::nextId{ 0 };
+std::atomic<unsigned long> VieVS::Baseline::Parameters::nextId{ 0 };
 
 
 void Baseline::Parameters::setParameters( const Baseline::Parameters &other ) {
     ignore = other.ignore;
     weight = other.weight;
     minSNR = other.minSNR;
+    minSNRPerBand = BandRegistry::perBand( minSNR );
 }
 
 
@@ -34,6 +34,7 @@
 #include <vector>
 
 #include "../Misc/VieVS_NamedObject.h"
+#include "../ObservingMode/BandRegistry.h"
 
 
 namespace VieVS {
@@ -93,7 +94,7 @@ class Baseline : public VieVS_NamedObject {
      */
     class Parameters : public VieVS_NamedObject {
        private:
-        static unsigned long nextId;  ///< next id for this object type
+        static std::atomic<unsigned long> nextId;  ///< next id for this object type
        public:
         /**
          * @brief constructor
@@ -101,7 +102,8 @@ class Baseline : public VieVS_NamedObject {
          *
          * @param name parameter name
          */
-        explicit Parameters( const std::string &name ) : VieVS_NamedObject( name, nextId++ ) {}
+        explicit Parameters( const std::string &name )
+            : VieVS_NamedObject( name, nextId++ ), minSNRPerBand{ BandRegistry::undefinedPerBand() } {}
 
 
         /**
@@ -113,11 +115,25 @@ class Baseline : public VieVS_NamedObject {
         void setParameters( const Parameters &other );
 
 
+        /**
+         * @brief minimum signal to noise ratio of a band
+         * @author Matthias Schartner
+         *
+         * @param bandId band id
+         * @return minimum signal to noise ratio
+         * @throws std::out_of_range if minimum SNR of this band is not defined
+         */
+        double getMinSNR( unsigned long bandId ) const {
+            return BandRegistry::at( minSNRPerBand, bandId, "minSNR", getName() );
+        }
+
+
         bool ignore = false;                             ///< ignore this baseline in scheduling process
         double weight = 1;                               ///< weight of this baseline
         unsigned int minScan = 0;                        ///< minimum scan time in seconds
         unsigned int maxScan = 9999;                     ///< maximum scan time in seconds
         std::unordered_map<std::string, double> minSNR;  ///< minimum signal to noise ration for each band
+        std::vector<double> minSNRPerBand;               ///< minimum signal to noise ration per band id
     };
 
 
@@ -135,7 +151,10 @@ class Baseline : public VieVS_NamedObject {
          * @param PARA new parameters
          */
         Event( unsigned int time, bool smoothTransition, Parameters PARA )
-            : time{ time }, smoothTransition{ smoothTransition }, PARA{ std::move( PARA ) } {}
+            : time{ time }, smoothTransition{ smoothTransition }, PARA{ std::move( PARA ) } {
+            // minSNR might have been changed after the band ids were assigned
+            this->PARA.minSNRPerBand = BandRegistry::perBand( this->PARA.minSNR );
+        }
 
 
         unsigned int time;      ///< time when new parameters should be used in seconds since start
@@ -295,7 +314,7 @@ class Baseline : public VieVS_NamedObject {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     unsigned long staid1_;  ///< id of first antenna
     unsigned long staid2_;  ///< id of second antenna
@@ -29,7 +29,7 @@
 using namespace std;
 using namespace VieVS;
 
-unsigned long AbstractCableWrap::nextId = 0;
+std::atomic<unsigned long> AbstractCableWrap::nextId{ 0 };
 
 
 AbstractCableWrap::AbstractCableWrap( double axis1_low_deg, double axis1_up_deg, double axis2_low_deg,
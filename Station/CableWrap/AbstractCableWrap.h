@@ -350,7 +350,7 @@ class AbstractCableWrap : public VieVS_Object {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     double axis1Low_;  ///< lower limit of first axis in radians
     double axis1Up_;   ///< upper limit of first axis in radians
@@ -7,5 +7,5 @@
 using namespace std;
 using namespace VieVS;
 
-unsigned long AbstractEquipment::nextId_ = 0;
+std::atomic<unsigned long> AbstractEquipment::nextId_{ 0 };
 AbstractEquipment::AbstractEquipment() : VieVS_Object( nextId_++ ) {}
@@ -35,6 +35,23 @@ class AbstractEquipment : VieVS_Object {
      */
     virtual double getSEFD( const std::string &band, double el ) const noexcept = 0;
 
+    /**
+     * @brief checks if SEFD information is available for a band
+     * @author Matthias Schartner
+     *
+     * @param band name of band
+     * @return true if SEFD information is available, otherwise false
+     */
+    virtual bool hasSEFD( const std::string &band ) const noexcept = 0;
+
+    /**
+     * @brief checks if SEFD depends on elevation
+     * @author Matthias Schartner
+     *
+     * @return true if SEFD depends on elevation, otherwise false
+     */
+    virtual bool isElevationDependent() const noexcept = 0;
+
     //    /**
     //     * @brief returns vector of bands for which SEFD information is available
     //     * @author Matthias Schartner
@@ -78,7 +95,7 @@ class AbstractEquipment : VieVS_Object {
 
 
    private:
-    static unsigned long nextId_;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId_;  ///< next id for this object type
 };
 }  // namespace VieVS
 #endif  // VIESCHEDPP_ABSTRACTEQUIPMENT_H
@@ -74,6 +74,23 @@ class Equipment_constant : public AbstractEquipment {
         }
     };
 
+    /**
+     * @brief checks if SEFD information is available for a band
+     * @author Matthias Schartner
+     *
+     * @param band name of band
+     * @return true if SEFD information is available, otherwise false
+     */
+    bool hasSEFD( const std::string &band ) const noexcept override { return SEFD_.find( band ) != SEFD_.end(); }
+
+    /**
+     * @brief checks if SEFD depends on elevation
+     * @author Matthias Schartner
+     *
+     * @return false
+     */
+    bool isElevationDependent() const noexcept override { return false; }
+
     //    /**
     //     *
     //     */
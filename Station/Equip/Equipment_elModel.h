@@ -66,6 +66,58 @@ class Equipment_elModel : public AbstractEquipment {
      */
     double getSEFD( const std::string &band, double el ) const noexcept override;
 
+    /**
+     * @brief checks if SEFD information is available for a band
+     * @author Matthias Schartner
+     *
+     * @param band name of band
+     * @return true if SEFD information is available, otherwise false
+     */
+    bool hasSEFD( const std::string &band ) const noexcept override {
+        return SEFDs_.find( band ) != SEFDs_.end() && y_.find( band ) != y_.end() && c0_.find( band ) != c0_.end() &&
+               c1_.find( band ) != c1_.end();
+    }
+
+    /**
+     * @brief checks if SEFD depends on elevation
+     * @author Matthias Schartner
+     *
+     * @return true
+     */
+    bool isElevationDependent() const noexcept override { return true; }
+
+    /**
+     * @brief getter for SEFD parameters
+     * @author Matthias Schartner
+     *
+     * @return SEFD per band - key is band name
+     */
+    const std::unordered_map<std::string, double> &getSEFDs() const noexcept { return SEFDs_; }
+
+    /**
+     * @brief getter for elevation dependent SEFD parameter "y"
+     * @author Matthias Schartner
+     *
+     * @return parameter "y" per band - key is band name
+     */
+    const std::unordered_map<std::string, double> &getY() const noexcept { return y_; }
+
+    /**
+     * @brief getter for elevation dependent SEFD parameter "c0"
+     * @author Matthias Schartner
+     *
+     * @return parameter "c0" per band - key is band name
+     */
+    const std::unordered_map<std::string, double> &getC0() const noexcept { return c0_; }
+
+    /**
+     * @brief getter for elevation dependent SEFD parameter "c1"
+     * @author Matthias Schartner
+     *
+     * @return parameter "c1" per band - key is band name
+     */
+    const std::unordered_map<std::string, double> &getC1() const noexcept { return c1_; }
+
     /**
      * @brief returns maximum SEFD of this antenna
      * @author Matthias Schartner
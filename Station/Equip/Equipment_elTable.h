@@ -65,6 +65,39 @@ class Equipment_elTable : public AbstractEquipment {
      */
     double getSEFD( const std::string &band, double el ) const noexcept override;
 
+    /**
+     * @brief checks if SEFD information is available for a band
+     * @author Matthias Schartner
+     *
+     * @param band name of band
+     * @return true if SEFD information is available, otherwise false
+     */
+    bool hasSEFD( const std::string &band ) const noexcept override { return SEFD_.find( band ) != SEFD_.end(); }
+
+    /**
+     * @brief checks if SEFD depends on elevation
+     * @author Matthias Schartner
+     *
+     * @return true
+     */
+    bool isElevationDependent() const noexcept override { return true; }
+
+    /**
+     * @brief getter for elevation angle knots
+     * @author Matthias Schartner
+     *
+     * @return elevation angle knots per band - key is band name
+     */
+    const std::unordered_map<std::string, std::vector<double>> &getElevations() const noexcept { return el_; }
+
+    /**
+     * @brief getter for SEFD values at elevation angle knots
+     * @author Matthias Schartner
+     *
+     * @return SEFD per band - key is band name
+     */
+    const std::unordered_map<std::string, std::vector<double>> &getSEFDs() const noexcept { return SEFD_; }
+
     /**
      * @brief returns maximum SEFD of this antenna
      * @author Matthias Schartner
@@ -28,7 +28,7 @@
 
 using namespace std;
 using namespace VieVS;
-unsigned long AbstractHorizonMask::nextId = 0;
+std::atomic<unsigned long> AbstractHorizonMask::nextId{ 0 };
 
 
 AbstractHorizonMask::AbstractHorizonMask() : VieVS_Object( nextId++ ) {}
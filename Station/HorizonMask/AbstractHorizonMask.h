@@ -66,6 +66,17 @@ class AbstractHorizonMask : public VieVS_Object {
     virtual bool visible( const PointingVector &pv ) const noexcept = 0;
 
 
+    /**
+     * @brief range of minimum elevation within an azimuth interval
+     * @author Matthias Schartner
+     *
+     * @param az1 start of azimuth interval in radians (between 0 and two pi)
+     * @param az2 end of azimuth interval in radians (between 0 and two pi)
+     * @return lowest and highest minimum elevation within interval in radians
+     */
+    virtual std::pair<double, double> elevationRange( double az1, double az2 ) const noexcept = 0;
+
+
     /**
      * @brief horizon mask string in .vex format
      * @author Matthias Schartner
@@ -85,7 +96,7 @@ class AbstractHorizonMask : public VieVS_Object {
 
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 };
 }  // namespace VieVS
 #endif /* HORIOZONMASK_H */
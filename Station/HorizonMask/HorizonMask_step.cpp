@@ -41,6 +41,25 @@ bool HorizonMask_step::visible( const PointingVector &pv ) const noexcept {
 }
 
 
+std::pair<double, double> HorizonMask_step::elevationRange( double az1, double az2 ) const noexcept {
+    az2 = min( az2, azimuth_.back() );
+    az1 = min( az1, az2 );
+
+    // constant between knots: all values are taken at interval boundaries or next to knots
+    double el1 = az2el( az1 );
+    double el2 = az2el( az2 );
+    double lowest = min( el1, el2 );
+    double highest = max( el1, el2 );
+    for ( unsigned long i = 1; i < azimuth_.size(); ++i ) {
+        if ( azimuth_[i] > az1 && azimuth_[i] < az2 ) {
+            lowest = min( { lowest, elevation_[i - 1], elevation_[i] } );
+            highest = max( { highest, elevation_[i - 1], elevation_[i] } );
+        }
+    }
+    return { lowest, highest };
+}
+
+
 std::string HorizonMask_step::vexOutput() const noexcept {
     ostringstream out;
 
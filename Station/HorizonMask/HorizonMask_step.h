@@ -63,6 +63,17 @@ class HorizonMask_step : public AbstractHorizonMask {
     bool visible( const PointingVector &pv ) const noexcept override;
 
 
+    /**
+     * @brief range of minimum elevation within an azimuth interval
+     * @author Matthias Schartner
+     *
+     * @param az1 start of azimuth interval in radians (between 0 and two pi)
+     * @param az2 end of azimuth interval in radians (between 0 and two pi)
+     * @return lowest and highest minimum elevation within interval in radians
+     */
+    std::pair<double, double> elevationRange( double az1, double az2 ) const noexcept override;
+
+
     /**
      * @brief horizon mask string in .vex format
      * @author Matthias Schartner
@@ -476,7 +476,7 @@ class Network : public VieVS_Object {
 
     std::map<std::pair<unsigned long, unsigned long>, unsigned long> staids2blid_;  ///< lookup table for baseline id
 
-    static unsigned long nextId;                       ///< next id for this object type
+    static std::atomic<unsigned long> nextId;          ///< next id for this object type
     static std::map<unsigned long, int> station2site;  ///< station to site converter
 
     std::map<std::pair<unsigned long, unsigned long>, std::vector<double>>
@@ -30,7 +30,7 @@
 
 using namespace std;
 using namespace VieVS;
-unsigned long Position::nextId = 0;
+std::atomic<unsigned long> Position::nextId{ 0 };
 
 
 Position::Position( double x_m, double y_m, double z_m, string origin )
@@ -137,12 +137,12 @@ class Position : public VieVS_Object {
      *
      * @return geodetic to local transformation matrix
      */
-    const std::vector<std::vector<double>> getGeodetic2Local() const { return g2l_2; }
+    const std::vector<std::vector<double>> &getGeodetic2Local() const noexcept { return g2l_2; }
 
     const std::string &getOrigin() const { return origin_; }
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
 
     std::string origin_;
     double x_;    ///< x coordinate in meters
@@ -29,7 +29,7 @@
 using namespace std;
 using namespace VieVS;
 
-unsigned long VieVS::SkyCoverage::nextId = 0;
+std::atomic<unsigned long> VieVS::SkyCoverage::nextId{ 0 };
 
 SkyCoverage::SkyCoverage( string name, double maxInfluenceTime, double maxInfluenceDistance,
                           Interpolation interpolationTime, Interpolation interpolationDistance )
@@ -37,16 +37,69 @@ SkyCoverage::SkyCoverage( string name, double maxInfluenceTime, double maxInflue
       maxInfluenceTime{ maxInfluenceTime },
       maxInfluenceDistance{ maxInfluenceDistance * deg2rad },
       interpolationTime{ interpolationTime },
-      interpolationDistance{ interpolationDistance } {}
+      interpolationDistance{ interpolationDistance } {
+    buildIndex();
+}
 
 
 double SkyCoverage::calcScore( const PointingVector &pv ) const {
     double score = 1;
-    for ( const auto &pv_old : pointingVectors_ ) {
-        if ( pv_old.getTime() > pv.getTime() ) {
-            continue;
+
+    // fallback without index
+    if ( elevationBands_.empty() ) {
+        for ( const auto &pv_old : pointingVectors_ ) {
+            if ( pv_old.getTime() > pv.getTime() ) {
+                continue;
+            }
+            double thisScore = scorePerPointingVector( pv, pv_old );
+            if ( thisScore < score ) {
+                score = thisScore;
+            }
         }
-        double thisScore = scorePerPointingVector( pv, pv_old );
+        return score;
+    }
+
+    // only pointing vectors of neighbouring elevation bands within the last maxInfluenceTime seconds can have an
+    // influence. The exact checks are still done in scorePerPointingVector.
+    unsigned int time = pv.getTime();
+    auto window = static_cast<unsigned int>( std::ceil( std::max( 0.0, maxInfluenceTime ) ) ) + 1;
+    unsigned int windowStart = time > window ? time - window : 0;
+
+    // candidates passing the time and elevation checks are collected first and their angular distances are
+    // calculated in one batch
+    static thread_local vector<double> candidateAz;
+    static thread_local vector<double> candidateEl;
+    static thread_local vector<long> candidateDeltaTime;
+    static thread_local vector<float> candidateDistance;
+    candidateAz.clear();
+    candidateEl.clear();
+    candidateDeltaTime.clear();
+
+    long band = elevationBand( pv.getEl() );
+    long firstBand = max( 0l, band - 1 );
+    long lastBand = min( static_cast<long>( elevationBands_.size() ) - 1, band + 1 );
+    for ( long iband = firstBand; iband <= lastBand; ++iband ) {
+        const auto &thisBand = elevationBands_[iband];
+        auto it = lower_bound( thisBand.begin(), thisBand.end(), windowStart,
+                               []( const pair<unsigned int, unsigned long> &a, unsigned int t ) { return a.first < t; } );
+        for ( ; it != thisBand.end() && it->first <= time; ++it ) {
+            const PointingVector &pv_old = pointingVectors_[it->second];
+            long deltaTime = (long)pv.getTime() - (long)pv_old.getTime();
+            if ( deltaTime > maxInfluenceTime || abs( pv.getEl() - pv_old.getEl() ) > maxInfluenceDistance ) {
+                continue;
+            }
+            candidateAz.push_back( pv_old.getAz() );
+            candidateEl.push_back( pv_old.getEl() );
+            candidateDeltaTime.push_back( deltaTime );
+        }
+    }
+
+    unsigned long n = candidateAz.size();
+    candidateDistance.resize( n );
+    LookupTable::angularDistance( pv.getAz(), pv.getEl(), n, candidateAz.data(), candidateEl.data(),
+                                  candidateDistance.data() );
+    for ( unsigned long i = 0; i < n; ++i ) {
+        double thisScore = scorePerDistance( candidateDeltaTime[i], candidateDistance[i] );
         if ( thisScore < score ) {
             score = thisScore;
         }
@@ -56,7 +109,45 @@ double SkyCoverage::calcScore( const PointingVector &pv ) const {
 }
 
 
-void SkyCoverage::update( const PointingVector &pv ) noexcept { pointingVectors_.push_back( pv ); }
+void SkyCoverage::update( const PointingVector &pv ) noexcept {
+    pointingVectors_.push_back( pv );
+    addToIndex( pointingVectors_.size() - 1 );
+}
+
+
+void SkyCoverage::buildIndex() {
+    elevationBands_.clear();
+    bandWidth_ = maxInfluenceDistance;
+    if ( !( bandWidth_ > 0 ) ) {
+        return;
+    }
+
+    auto nBands = static_cast<unsigned long>( ceil( pi / bandWidth_ ) ) + 1;
+    elevationBands_.resize( nBands );
+    for ( unsigned long i = 0; i < pointingVectors_.size(); ++i ) {
+        addToIndex( i );
+    }
+}
+
+
+void SkyCoverage::addToIndex( unsigned long idx ) {
+    if ( elevationBands_.empty() ) {
+        return;
+    }
+
+    // pointing vectors are usually added in chronological order, insert at the correct position otherwise
+    const PointingVector &pv = pointingVectors_[idx];
+    auto &thisBand = elevationBands_[elevationBand( pv.getEl() )];
+    auto element = make_pair( pv.getTime(), idx );
+    if ( thisBand.empty() || thisBand.back().first <= element.first ) {
+        thisBand.push_back( element );
+    } else {
+        thisBand.insert( upper_bound( thisBand.begin(), thisBand.end(), element,
+                                      []( const pair<unsigned int, unsigned long> &a,
+                                          const pair<unsigned int, unsigned long> &b ) { return a.first < b.first; } ),
+                         element );
+    }
+}
 
 
 double SkyCoverage::scorePerPointingVector( const PointingVector &pv_new,
@@ -72,6 +163,11 @@ double SkyCoverage::scorePerPointingVector( const PointingVector &pv_new,
 
     float distance = LookupTable::angularDistance( pv_new, pv_old );
 
+    return scorePerDistance( deltaTime, distance );
+}
+
+
+double SkyCoverage::scorePerDistance( long deltaTime, float distance ) const noexcept {
     if ( distance > maxInfluenceDistance ) {
         return 1;
     }
@@ -116,13 +212,19 @@ double SkyCoverage::scorePerPointingVector( const PointingVector &pv_new,
 }
 
 
-void SkyCoverage::clearObservations() { pointingVectors_.clear(); }
+void SkyCoverage::clearObservations() {
+    pointingVectors_.clear();
+    for ( auto &any : elevationBands_ ) {
+        any.clear();
+    }
+}
 
 
 void SkyCoverage::calculateSkyCoverageScores() {
     std::sort(
         pointingVectors_.begin(), pointingVectors_.end(),
         []( const PointingVector &left, const PointingVector &right ) { return left.getTime() < right.getTime(); } );
+    buildIndex();
 
     a13m8_ = skyCoverageScore_13( 480 );
     a25m8_ = skyCoverageScore_25( 480 );
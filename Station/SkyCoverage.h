@@ -28,6 +28,7 @@
 #define SKYCOVERAGE_H
 
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <limits>
@@ -122,6 +123,19 @@ class SkyCoverage : public VieVS_NamedObject {
     double scorePerPointingVector( const PointingVector &pv_new, const PointingVector &pv_old ) const noexcept;
 
 
+    /**
+     * @brief calculates the influence of the score of an already observed pointing vector
+     * @author Matthias Schartner
+     *
+     * Time and elevation difference checks of scorePerPointingVector must already be done.
+     *
+     * @param deltaTime time difference in seconds
+     * @param distance angular distance in radians
+     * @return score
+     */
+    double scorePerDistance( long deltaTime, float distance ) const noexcept;
+
+
     /**
      * @brief clear all observations
      * @author Matthias Schartner
@@ -261,7 +275,10 @@ class SkyCoverage : public VieVS_NamedObject {
      */
     double getSkyCoverageScore_a37m60() const { return a37m60_; }
 
-    void setInfluenceDistance( double dist ) { maxInfluenceDistance = dist * deg2rad; }
+    void setInfluenceDistance( double dist ) {
+        maxInfluenceDistance = dist * deg2rad;
+        buildIndex();
+    }
 
     void setInfluenceTime( double time ) { maxInfluenceTime = time; }
 
@@ -280,7 +297,39 @@ class SkyCoverage : public VieVS_NamedObject {
     void generateDebuggingFiles( unsigned int i, const std::string &filename, const std::string &stations ) const;
 
    private:
-    static unsigned long nextId;          ///< next id for this object type
+    /**
+     * @brief build elevation band index of all pointing vectors
+     * @author Matthias Schartner
+     *
+     * Pointing vectors are grouped in elevation bands with a width of maxInfluenceDistance and sorted by time within
+     * each band. Only the band of a new pointing vector and its two neighbours can contain pointing vectors within
+     * maxInfluenceDistance, and only the last maxInfluenceTime seconds of each band have to be checked.
+     */
+    void buildIndex();
+
+
+    /**
+     * @brief add pointing vector to elevation band index
+     * @author Matthias Schartner
+     *
+     * @param idx index of pointing vector
+     */
+    void addToIndex( unsigned long idx );
+
+
+    /**
+     * @brief get elevation band
+     * @author Matthias Schartner
+     *
+     * @param el elevation
+     * @return elevation band index
+     */
+    long elevationBand( double el ) const noexcept {
+        auto band = static_cast<long>( std::floor( ( el + halfpi ) / bandWidth_ ) );
+        return std::max( 0l, std::min( band, static_cast<long>( elevationBands_.size() ) - 1 ) );
+    }
+
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
     double maxInfluenceTime;              ///< maximum angular distance of influence on the sky coverage
     double maxInfluenceDistance;          ///< maximum time influence on the sky coverage
     Interpolation interpolationDistance;  ///< function for distance
@@ -288,6 +337,11 @@ class SkyCoverage : public VieVS_NamedObject {
 
 
     std::vector<PointingVector> pointingVectors_;  ///< all pointing vectors
+
+    double bandWidth_{ 0 };  ///< width of elevation bands of index (equals maxInfluenceDistance)
+    std::vector<std::vector<std::pair<unsigned int, unsigned long>>>
+        elevationBands_;  ///< time and index of pointing vectors per elevation band, sorted by time
+
     double a13m8_{ 0 };                            ///< sky coverage score with 13 areas over 15 minutes
     double a25m8_{ 0 };                            ///< sky coverage score with 25 areas over 15 minutes
     double a37m8_{ 0 };                            ///< sky coverage score with 37 areas over 15 minutes
@@ -26,12 +26,13 @@
 #include "Station.h"
 
 #include "../Misc/LookupTable.h"
+#include "../ObservingMode/BandRegistry.h"
 
 
 using namespace std;
 using namespace VieVS;
-unsigned long VieVS::Station::nextId = 0;
-unsigned long VieVS::Station::Parameters::nextId = 0;
+std::atomic<unsigned long> VieVS::Station::nextId{ 0 };
+std::atomic<unsigned long> VieVS::Station::Parameters::nextId{ 0 };
 
 void Station::Parameters::setParameters( const Station::Parameters &other ) {
     firstScan = other.firstScan;
@@ -43,6 +44,7 @@ void Station::Parameters::setParameters( const Station::Parameters &other ) {
     minElevation = other.minElevation;
 
     minSNR = other.minSNR;
+    minSNRPerBand = BandRegistry::perBand( minSNR );
 
     minSlewtime = other.minSlewtime;
     maxSlewtime = other.maxSlewtime;
@@ -77,7 +79,7 @@ Station::Station( std::string sta_name, std::string tlc, std::shared_ptr<Abstrac
       mask_{ move( sta_mask ) },
       currentPositionVector_{ PointingVector( nextId - 1, numeric_limits<unsigned long>::max() ) },
       parameters_{ Parameters( "empty" ) },
-      azelPrecalc_{ vector<vector<PointingVector>>( nSources ) } {
+      azelPrecalc_{ vector<AzElPrecalc>( nSources ) } {
     parameters_.firstScan = true;
 }
 
@@ -100,232 +102,246 @@ bool Station::isVisible( const PointingVector &p, double minElevationSource ) co
     if ( p.getEl() < minElevationSource ) {
         return false;
     }
-    if ( mask_ != nullptr && !mask_->visible( p ) ) {
-        return false;
+    if ( mask_ != nullptr ) {
+        auto result = StationLookupTables::MaskResult::undecided;
+        if ( lookupTables_ != nullptr && lookupTables_->hasMask() ) {
+            result = lookupTables_->maskVisible( p.getAz(), p.getEl() );
+        }
+        if ( result == StationLookupTables::MaskResult::hidden ||
+             ( result == StationLookupTables::MaskResult::undecided && !mask_->visible( p ) ) ) {
+            return false;
+        }
     }
     return cableWrap_->anglesInside( p );
 }
 
 
+double Station::getSEFD( unsigned long bandId, double el ) const noexcept {
+    if ( lookupTables_ != nullptr && lookupTables_->hasSEFD( bandId ) ) {
+        return lookupTables_->getSEFD( bandId, el );
+    }
+    return equip_->getSEFD( BandRegistry::getName( bandId ), el );
+}
+
+
+void Station::compileLookupTables() {
+    lookupTables_ = make_shared<const StationLookupTables>( *equip_, mask_.get() );
+}
+
+
 void Station::calcAzEl_simple( std::shared_ptr<const AbstractSource> source, PointingVector &p ) const noexcept {
-    auto &precalc = azelPrecalc_[source->getId()];
+    azelPrecalc_[source->getId()].interpolate( p );
+}
 
-    unsigned int time = p.getTime();
 
-    auto it_n = precalc.begin();
-    // iterate over each precalculated value
-    for ( it_n; it_n < precalc.end(); ++it_n ) {
-        if ( it_n->getTime() >= time ) {
-            break;
-        }
+void Station::setAzElPrecalcGrid( unsigned long srcid, unsigned int step, unsigned int end ) {
+    if ( srcid < azelPrecalc_.size() ) {
+        azelPrecalc_[srcid].setGrid( step, end );
+    }
+}
+
+
+void Station::saveAzElPrecalc( unsigned long srcid, PrecalcCache::Writer &writer ) const {
+    azelPrecalc_.at( srcid ).save( writer );
+}
+
+
+bool Station::loadAzElPrecalc( unsigned long srcid, PrecalcCache::Reader &reader ) {
+    return srcid < azelPrecalc_.size() && azelPrecalc_[srcid].load( reader );
+}
+
+
+void Station::shareAzElPrecalc() noexcept {
+    for ( auto &any : azelPrecalc_ ) {
+        any.share();
     }
+}
+
+
+void Station::calcAzEl_rigorous( const shared_ptr<const AbstractSource> &source, PointingVector &p ) noexcept {
+    unsigned int time = p.getTime();
+
     // check if a precalculated value matches time exactly
-    if ( it_n->getTime() == time ) {
-        p.setAz( it_n->getAz() );
-        p.setEl( it_n->getEl() );
-        p.setHa( it_n->getHa() );
-        p.setDc( it_n->getDc() );
+    if ( p.getSrcid() < azelPrecalc_.size() && azelPrecalc_[source->getId()].lookup( p ) ) {
         return;
     }
 
-    auto it_p = std::prev( it_n );
+#ifdef VIESCHEDPP_LOG
+    if ( Flags::logTrace )
+        BOOST_LOG_TRIVIAL( trace ) << "station " << this->getName() << " calculate azimuth and elevation to source "
+                                   << p.getSrcid();
+#endif
 
-    int dt = it_n->getTime() - it_p->getTime();
-    double factor = static_cast<double>( time - it_p->getTime() ) / static_cast<double>( dt );
+    calcAzEl_rigorousUncached( source, p );
 
-    double az1 = it_p->getAz();
-    double az2 = it_n->getAz();
-    double az;
-    if ( abs( az1 - az2 ) > halfpi ) {
-        if ( az1 < az2 ) {
-            az1 += twopi;
-        } else {
-            az2 += twopi;
-        }
-        az = it_p->getAz() + factor * ( it_n->getAz() - it_p->getAz() );
-        while ( az > twopi ) {
-            az -= twopi;
-        }
-    } else {
-        az = it_p->getAz() + factor * ( it_n->getAz() - it_p->getAz() );
+    if ( p.getSrcid() < azelPrecalc_.size() ) {
+        azelPrecalc_[source->getId()].insert( p );
     }
+}
+
 
-    double el = it_p->getEl() + factor * ( it_n->getEl() - it_p->getEl() );
+void Station::calcAzEl_rigorousUncached( const shared_ptr<const AbstractSource> &source,
+                                         PointingVector &p ) const noexcept {
+    unsigned int time = p.getTime();
+
+    EarthOrientation eo = calcEarthOrientation( time );
+
+    // Source vector in CRF
+    SourceDirection dir;
+    source->getSourceInCrs( time, position_, dir );
 
-    double ha1 = it_p->getHa();
-    double ha2 = it_n->getHa();
+    double az;
+    double el;
     double ha;
-    if ( abs( ha1 - ha2 ) > halfpi ) {
-        if ( ha1 < ha2 ) {
-            ha1 += twopi;
-        } else {
-            ha2 += twopi;
-        }
-        ha = it_p->getHa() + factor * ( it_n->getHa() - it_p->getHa() );
-        while ( ha > twopi ) {
-            ha -= twopi;
-        }
-    } else {
-        ha = it_p->getHa() + factor * ( it_n->getHa() - it_p->getHa() );
-    }
+    transformToLocal( eo, 1, &dir.crs[0], &dir.crs[1], &dir.crs[2], &dir.ra, &az, &el, &ha );
 
     p.setAz( az );
     p.setEl( el );
     p.setHa( ha );
-    p.setDc( it_n->getDc() );
+    p.setDc( dir.de );
+    p.setTime( time );
 }
 
 
-void Station::calcAzEl_rigorous( const shared_ptr<const AbstractSource> &source, PointingVector &p ) noexcept {
-    unsigned int time = p.getTime();
-
-    if ( p.getSrcid() < azelPrecalc_.size() ) {
-        auto &precalc = azelPrecalc_[source->getId()];
-
-        auto it = precalc.begin();
-        // iterate over each precalculated value
-        for ( ; it < precalc.end(); ++it ) {
-            if ( it->getTime() >= time ) {
-                break;
-            }
-        }
-
-        // check if a precalculated value matches time exactly
-        if ( it != precalc.end() && it->getTime() == time ) {
-            p.setAz( it->getAz() );
-            p.setEl( it->getEl() );
-            p.setHa( it->getHa() );
-            p.setDc( it->getDc() );
-            return;
+void Station::calcAzEl_rigorous( const std::vector<std::shared_ptr<const AbstractSource>> &sources,
+                                 std::vector<PointingVector> &p ) noexcept {
+    if ( p.empty() ) {
+        return;
+    }
+    unsigned int time = p.front().getTime();
+
+    // sources without precalculated value at this epoch
+    vector<unsigned long> todo;
+    todo.reserve( sources.size() );
+    for ( unsigned long i = 0; i < sources.size(); ++i ) {
+        if ( p[i].getSrcid() < azelPrecalc_.size() && azelPrecalc_[sources[i]->getId()].lookup( p[i] ) ) {
+            continue;
         }
+        todo.push_back( i );
+    }
+    if ( todo.empty() ) {
+        return;
     }
 
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logTrace )
-        BOOST_LOG_TRIVIAL( trace ) << "station " << this->getName() << " calculate azimuth and elevation to source "
-                                   << p.getSrcid();
+        BOOST_LOG_TRIVIAL( trace ) << "station " << this->getName() << " calculate azimuth and elevation to "
+                                   << todo.size() << " sources";
 #endif
 
-    double omega = 7.2921151467069805e-05;  // 1.00273781191135448*D2PI/86400;
+    EarthOrientation eo = calcEarthOrientation( time );
+
+    // Source vectors in CRF
+    unsigned long n = todo.size();
+    vector<double> x( n );
+    vector<double> y( n );
+    vector<double> z( n );
+    vector<double> ra( n );
+    vector<double> dc( n );
+    SourceDirection dir;
+    for ( unsigned long j = 0; j < n; ++j ) {
+        sources[todo[j]]->getSourceInCrs( time, position_, dir );
+        x[j] = dir.crs[0];
+        y[j] = dir.crs[1];
+        z[j] = dir.crs[2];
+        ra[j] = dir.ra;
+        dc[j] = dir.de;
+    }
 
-    //  TIME
-    double date1 = 2400000.5;
-    double mjd = TimeSystem::mjdStart + static_cast<double>( time ) / 86400.0;
+    vector<double> az( n );
+    vector<double> el( n );
+    vector<double> ha( n );
+    transformToLocal( eo, n, x.data(), y.data(), z.data(), ra.data(), az.data(), el.data(), ha.data() );
+
+    for ( unsigned long j = 0; j < n; ++j ) {
+        PointingVector &thisP = p[todo[j]];
+        thisP.setAz( az[j] );
+        thisP.setEl( el[j] );
+        thisP.setHa( ha[j] );
+        thisP.setDc( dc[j] );
+        thisP.setTime( time );
+
+        if ( thisP.getSrcid() < azelPrecalc_.size() ) {
+            azelPrecalc_[sources[todo[j]]->getId()].insert( thisP );
+        }
+    }
+}
 
-    // Earth Rotation
-    double ERA = iauEra00( date1, mjd );
 
-    // precession nutation
-    double C[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+Station::EarthOrientation Station::calcEarthOrientation( unsigned int time ) const noexcept {
+    EarthOrientation eo{};
 
-    // TODO: change to helper functions
-    unsigned int nut_precalc_idx = 0;
-    while ( AstronomicalParameters::earth_nutTime[nut_precalc_idx + 1] < time ) {
-        ++nut_precalc_idx;
-    }
-    unsigned int delta = AstronomicalParameters::earth_nutTime[1] - AstronomicalParameters::earth_nutTime[0];
-
-    unsigned int deltaTime = time - AstronomicalParameters::earth_nutTime[nut_precalc_idx];
-
-    double x = AstronomicalParameters::earth_nutX[nut_precalc_idx] +
-               ( AstronomicalParameters::earth_nutX[nut_precalc_idx + 1] -
-                 AstronomicalParameters::earth_nutX[nut_precalc_idx] ) /
-                   delta * deltaTime;
-    double y = AstronomicalParameters::earth_nutY[nut_precalc_idx] +
-               ( AstronomicalParameters::earth_nutY[nut_precalc_idx + 1] -
-                 AstronomicalParameters::earth_nutY[nut_precalc_idx] ) /
-                   delta * deltaTime;
-    double s = AstronomicalParameters::earth_nutS[nut_precalc_idx] +
-               ( AstronomicalParameters::earth_nutS[nut_precalc_idx + 1] -
-                 AstronomicalParameters::earth_nutS[nut_precalc_idx] ) /
-                   delta * deltaTime;
-
-    iauC2ixys( x, y, s, C );
-
-    //  Polar Motion
-    double W[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
-    //  GCRS to ITRS
-    double c2t[3][3];
-    iauC2tcio( C, ERA, W, c2t );
-    double t2c[3][3] = {};
-    iauTr( c2t, t2c );
+    double omega = 7.2921151467069805e-05;  // 1.00273781191135448*D2PI/86400;
+
+    // earth rotation, precession nutation and polar motion (shared by all stations at this epoch)
+    AstronomicalParameters::celestial2terrestrial( time, eo.c2t );
 
     //  Transformation
     double v1[3] = { -omega * position_->getX(), omega * position_->getY(), 0 };
 
-    double v1R[3] = {};
-    iauRxp( t2c, v1, v1R );
-
-    double k1a[3] = {};
-    double k1a_t1[3];
+    eo.vel[0] = ( AstronomicalParameters::earth_velocity[0] + v1[0] ) / CMPS;
+    eo.vel[1] = ( AstronomicalParameters::earth_velocity[1] + v1[1] ) / CMPS;
+    eo.vel[2] = ( AstronomicalParameters::earth_velocity[2] + v1[2] ) / CMPS;
 
-    k1a_t1[0] = ( AstronomicalParameters::earth_velocity[0] + v1[0] ) / CMPS;
-    k1a_t1[1] = ( AstronomicalParameters::earth_velocity[1] + v1[1] ) / CMPS;
-    k1a_t1[2] = ( AstronomicalParameters::earth_velocity[2] + v1[2] ) / CMPS;
-
-    // Source vector in CRF
-    auto tmp = source->getSourceInCrs( time, position_ );
-    const pair<double, double> &srcRaDe = tmp.first;
-    const vector<double> &scrs_ = tmp.second;
-    double rqu[3] = { scrs_[0], scrs_[1], scrs_[2] };
+    // only for hadc antennas
+    eo.gmst = TimeSystem::internalTime2gmst( time );
 
-    double k1a_t2[3] = {};
-    iauSxp( iauPdp( rqu, k1a_t1 ), rqu, k1a_t2 );
-    k1a_t2[0] = -k1a_t2[0];
-    k1a_t2[1] = -k1a_t2[1];
-    k1a_t2[2] = -k1a_t2[2];
+    return eo;
+}
 
-    double k1a_temp[3] = {};
-    iauPpp( rqu, k1a_t1, k1a_temp );
-    iauPpp( k1a_temp, k1a_t2, k1a );
 
-    //  source in TRS
-    double rq[3] = {};
-    iauRxp( c2t, k1a, rq );
+void Station::transformToLocal( const EarthOrientation &eo, unsigned long n, const double *x, const double *y,
+                                const double *z, const double *ra, double *az, double *el, double *ha ) const
+    noexcept {
+    const auto &c2t = eo.c2t;
+    const auto &vel = eo.vel;
 
     //  station in local system
     const auto &g2l2 = position_->getGeodetic2Local();
-
     double g2l[3][3] = { { g2l2[0][0], g2l2[0][1], g2l2[0][2] },
                          { g2l2[1][0], g2l2[1][1], g2l2[1][2] },
                          { g2l2[2][0], g2l2[2][1], g2l2[2][2] } };
-    //    position_->geodetic2Local(g2l);
-
-    double lq[3] = {};
-    iauRxp( g2l, rq, lq );
+    double lon = position_->getLon();
 
-    double zd = acos( lq[2] );
-    double el = DPI / 2 - zd;
+    // same operations (and order) as iauPdp, iauSxp, iauPpp and iauRxp
+    for ( unsigned long i = 0; i < n; ++i ) {
+        double rqu[3] = { x[i], y[i], z[i] };
 
-    double saz = atan2( lq[1], lq[0] );
-    if ( lq[1] < 0 ) {
-        saz = DPI * 2 + saz;
-    }
-    double az = fmod( saz + DPI, DPI * 2 );
+        // aberration
+        double proj = rqu[0] * vel[0] + rqu[1] * vel[1] + rqu[2] * vel[2];
+        double k1a[3];
+        for ( int j = 0; j < 3; ++j ) {
+            k1a[j] = ( rqu[j] + vel[j] ) + -( proj * rqu[j] );
+        }
 
-    p.setAz( az );
-    p.setEl( el );
+        //  source in TRS
+        double rq[3];
+        for ( int j = 0; j < 3; ++j ) {
+            rq[j] = c2t[j][0] * k1a[0] + c2t[j][1] * k1a[1] + c2t[j][2] * k1a[2];
+        }
 
-    // only for hadc antennas
-    double gmst = TimeSystem::mjd2gmst( mjd );
-    //    auto srcRaDe = source->getRaDe( time, position_ );
+        double lq[3];
+        for ( int j = 0; j < 3; ++j ) {
+            lq[j] = g2l[j][0] * rq[0] + g2l[j][1] * rq[1] + g2l[j][2] * rq[2];
+        }
 
-    double ha = gmst + position_->getLon() - srcRaDe.first;
-    while ( ha > pi ) {
-        ha = ha - twopi;
-    }
-    while ( ha < -pi ) {
-        ha = ha + twopi;
-    }
-    p.setHa( ha );
-    p.setDc( srcRaDe.second );
-    // end of hadc part
+        double zd = acos( lq[2] );
+        el[i] = DPI / 2 - zd;
 
-    p.setTime( time );
+        double saz = atan2( lq[1], lq[0] );
+        if ( lq[1] < 0 ) {
+            saz = DPI * 2 + saz;
+        }
+        az[i] = fmod( saz + DPI, DPI * 2 );
 
-    if ( p.getSrcid() < azelPrecalc_.size() ) {
-        auto &precalc = azelPrecalc_[source->getId()];
-        precalc.push_back( p );
+        double thisHa = eo.gmst + lon - ra[i];
+        while ( thisHa > pi ) {
+            thisHa = thisHa - twopi;
+        }
+        while ( thisHa < -pi ) {
+            thisHa = thisHa + twopi;
+        }
+        ha[i] = thisHa;
     }
 }
 
@@ -44,9 +44,11 @@
 #include "../Scan/PointingVector.h"
 #include "../Source/AbstractSource.h"
 #include "Antenna/AbstractAntenna.h"
+#include "AzElPrecalc.h"
 #include "CableWrap/AbstractCableWrap.h"
 #include "Equip/AbstractEquipment.h"
 #include "HorizonMask/AbstractHorizonMask.h"
+#include "StationLookupTables.h"
 #include "Position.h"
 
 
@@ -79,7 +81,7 @@ class Station : public VieVS_NamedObject {
      */
     class Parameters : public VieVS_NamedObject {
        private:
-        static unsigned long nextId;  ///< next id for this object type
+        static std::atomic<unsigned long> nextId;  ///< next id for this object type
        public:
         /**
          * @brief constructor
@@ -87,7 +89,8 @@ class Station : public VieVS_NamedObject {
          *
          * @param name parameter name
          */
-        explicit Parameters( const std::string &name ) : VieVS_NamedObject( name, nextId++ ) {}
+        explicit Parameters( const std::string &name )
+            : VieVS_NamedObject( name, nextId++ ), minSNRPerBand{ BandRegistry::undefinedPerBand() } {}
 
 
         /**
@@ -99,6 +102,19 @@ class Station : public VieVS_NamedObject {
         void setParameters( const Parameters &other );
 
 
+        /**
+         * @brief minimum signal to noise ratio of a band
+         * @author Matthias Schartner
+         *
+         * @param bandId band id
+         * @return minimum signal to noise ratio
+         * @throws std::out_of_range if minimum SNR of this band is not defined
+         */
+        double getMinSNR( unsigned long bandId ) const {
+            return BandRegistry::at( minSNRPerBand, bandId, "minSNR", getName() );
+        }
+
+
         bool firstScan = false;  ///< if set to true: no time is spend for setup, source, tape, calibration, and slewing
         bool available = true;   ///< if set to true: this station is available for a scan
         bool tagalong = false;   ///< if set to true: station is in tagalong mode
@@ -108,6 +124,7 @@ class Station : public VieVS_NamedObject {
         double minElevation = 5 * deg2rad;  /// minimum elevation in radians
 
         std::unordered_map<std::string, double> minSNR;  ///< minimum required signal to noise ration for each band
+        std::vector<double> minSNRPerBand;               ///< minimum signal to noise ration per band id
 
         unsigned int minSlewtime = 0;              ///< minimum required slew time
         unsigned int maxSlewtime = 900;            ///< maximum allowed slewtime in seconds
@@ -214,7 +231,10 @@ class Station : public VieVS_NamedObject {
          * @param PARA parameter
          */
         Event( unsigned int time, bool smoothTransition, Parameters PARA )
-            : time{ time }, smoothTransition{ smoothTransition }, PARA{ std::move( PARA ) } {}
+            : time{ time }, smoothTransition{ smoothTransition }, PARA{ std::move( PARA ) } {
+            // minSNR might have been changed after the band ids were assigned
+            this->PARA.minSNRPerBand = BandRegistry::perBand( this->PARA.minSNR );
+        }
 
 
         unsigned int time;      ///< time when new parameters should be used in seconds since start
@@ -309,6 +329,28 @@ class Station : public VieVS_NamedObject {
     const AbstractEquipment &getEquip() const noexcept { return *equip_; }
 
 
+    /**
+     * @brief SEFD for given band and elevation
+     * @author Matthias Schartner
+     *
+     * Uses the compiled SEFD if available (see compileLookupTables()), otherwise the equipment object.
+     *
+     * @param bandId band id (see BandRegistry)
+     * @param el elevation in radians
+     * @return SEFD of this band
+     */
+    double getSEFD( unsigned long bandId, double el ) const noexcept;
+
+
+    /**
+     * @brief compile SEFD and horizon mask into lookup tables
+     * @author Matthias Schartner
+     *
+     * Must be called after all bands are registered (see BandRegistry).
+     */
+    void compileLookupTables();
+
+
     /**
      * @brief check if station has horizon mask
      * @author Matthias Schartner
@@ -449,6 +491,36 @@ class Station : public VieVS_NamedObject {
     void calcAzEl_rigorous( const std::shared_ptr<const AbstractSource> &source, PointingVector &p ) noexcept;
 
 
+    /**
+     * @brief calculation of azimuth, elevation, hour angle and declination with rigorouse model without precalculated
+     * values
+     * @author Matthias Schartner
+     *
+     * Same model as calcAzEl_rigorous but precalculated values are neither used nor extended. The station is not
+     * modified, therefore it can be called concurrently from several threads.
+     *
+     * @param source observed source
+     * @param p pointing vector
+     */
+    void calcAzEl_rigorousUncached( const std::shared_ptr<const AbstractSource> &source,
+                                    PointingVector &p ) const noexcept;
+
+
+    /**
+     * @brief calculation of azimuth, elevation, hour angle and declination of many sources with rigorouse model
+     * @author Matthias Schartner
+     *
+     * All pointing vectors must refer to the same epoch. Earth rotation, precession-nutation and aberration are
+     * calculated once for this epoch and afterwards applied to all source vectors.
+     * The result is identical to calling calcAzEl_rigorous for each source.
+     *
+     * @param sources observed sources
+     * @param p pointing vectors (one per source, all with the same time)
+     */
+    void calcAzEl_rigorous( const std::vector<std::shared_ptr<const AbstractSource>> &sources,
+                            std::vector<PointingVector> &p ) noexcept;
+
+
     /**
      * @brief calculation of azimuth, elevation, hour angle and declination with lookup tables
      * @author Matthias Schartner
@@ -459,6 +531,47 @@ class Station : public VieVS_NamedObject {
     void calcAzEl_simple( std::shared_ptr<const AbstractSource> source, PointingVector &p ) const noexcept;
 
 
+    /**
+     * @brief define uniform time grid of azimuth elevation lookup table
+     * @author Matthias Schartner
+     *
+     * @param srcid source id
+     * @param step grid spacing in seconds
+     * @param end end of grid in seconds since session start (exclusive)
+     */
+    void setAzElPrecalcGrid( unsigned long srcid, unsigned int step, unsigned int end );
+
+
+    /**
+     * @brief write azimuth elevation lookup table to cache
+     * @author Matthias Schartner
+     *
+     * @param srcid source id
+     * @param writer cache writer
+     */
+    void saveAzElPrecalc( unsigned long srcid, PrecalcCache::Writer &writer ) const;
+
+
+    /**
+     * @brief read azimuth elevation lookup table from cache
+     * @author Matthias Schartner
+     *
+     * @param srcid source id
+     * @param reader cache reader
+     * @return true if successful
+     */
+    bool loadAzElPrecalc( unsigned long srcid, PrecalcCache::Reader &reader );
+
+
+    /**
+     * @brief share azimuth elevation lookup tables with all copies of this station
+     * @author Matthias Schartner
+     *
+     * Precalculated grids become read only and are referenced instead of copied (e.g. in multi scheduling).
+     */
+    void shareAzElPrecalc() noexcept;
+
+
     /**
      * @brief change current pointing vector
      * @author Matthias Schartner
@@ -708,13 +821,24 @@ class Station : public VieVS_NamedObject {
     }
 
    private:
-    static unsigned long nextId;  ///< next id for this object type
+    static std::atomic<unsigned long> nextId;  ///< next id for this object type
+
+    /**
+     * @brief epoch dependent quantities of rigorous azimuth elevation calculation
+     * @author Matthias Schartner
+     */
+    struct EarthOrientation {
+        double c2t[3][3];  ///< celestial to terrestrial rotation matrix
+        double vel[3];     ///< velocity of station divided by speed of light (aberration)
+        double gmst;       ///< Greenwich mean sidereal time
+    };
 
     std::shared_ptr<AbstractAntenna> antenna_;      ///< station antenna
     std::shared_ptr<AbstractCableWrap> cableWrap_;  ///< station cable wrap
     std::shared_ptr<Position> position_;            ///< station position
     std::shared_ptr<AbstractEquipment> equip_;      ///< station equipment
     std::shared_ptr<AbstractHorizonMask> mask_;     ///< station horizon mask
+    std::shared_ptr<const StationLookupTables> lookupTables_;  ///< compiled SEFD and horizon mask
     std::vector<Event> events_;                     ///< list of all events
 
     std::string oneLetterCode_ = "_";                ///< one letter code for skd file
@@ -723,8 +847,8 @@ class Station : public VieVS_NamedObject {
     std::string recording_system_id_ = "unknown";    ///< recoring system id (e.g.: "Ke")
     std::string occupation_code_ = "unknown";        ///< occupation code (e.g.: "72425901")
 
-    Statistics statistics_;                                 ///< station statistics
-    std::vector<std::vector<PointingVector>> azelPrecalc_;  ///< pre calculated azimuth elevation lookup table
+    Statistics statistics_;                 ///< station statistics
+    std::vector<AzElPrecalc> azelPrecalc_;  ///< pre calculated azimuth elevation lookup table per source
 
     Parameters parameters_;                 ///< station parameters
     PointingVector currentPositionVector_;  ///< current pointing vector
@@ -733,6 +857,34 @@ class Station : public VieVS_NamedObject {
     int nTotalScans_{ 0 };                  ///< number of total scans
     int nObs_{ 0 };                         ///< number of observed baselines
     unsigned int totalObsTime_{ 0 };        ///< total observing time in seconds
+
+
+    /**
+     * @brief calculate epoch dependent quantities of rigorous azimuth elevation calculation
+     * @author Matthias Schartner
+     *
+     * @param time time in seconds since session start
+     * @return earth rotation, precession-nutation, aberration and sidereal time
+     */
+    EarthOrientation calcEarthOrientation( unsigned int time ) const noexcept;
+
+
+    /**
+     * @brief transform source vectors in CRF to azimuth, elevation and hour angle
+     * @author Matthias Schartner
+     *
+     * @param eo epoch dependent quantities
+     * @param n number of sources
+     * @param x x component of source vectors in CRF
+     * @param y y component of source vectors in CRF
+     * @param z z component of source vectors in CRF
+     * @param ra right ascension of sources
+     * @param az resulting azimuth
+     * @param el resulting elevation
+     * @param ha resulting hour angle
+     */
+    void transformToLocal( const EarthOrientation &eo, unsigned long n, const double *x, const double *y,
+                           const double *z, const double *ra, double *az, double *el, double *ha ) const noexcept;
 };
 }  // namespace VieVS
 #endif /* STATION_H */
@@ -0,0 +1,104 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StationLookupTables.h"
+
+#include "../ObservingMode/BandRegistry.h"
+#include "Equip/Equipment_elModel.h"
+#include "Equip/Equipment_elTable.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+StationLookupTables::StationLookupTables( const AbstractEquipment &equip, const AbstractHorizonMask *mask )
+    : sefdScale_{ 1 / sefdStep_ }, maskScale_{ 1 / maskStep_ } {
+    // SEFD per band
+    unsigned long nBands = BandRegistry::size();
+    sefdType_.assign( nBands, SEFDType::none );
+    sefd_.assign( nBands, 0 );
+    sefdY_.assign( nBands, 0 );
+    sefdC0_.assign( nBands, 0 );
+    sefdC1_.assign( nBands, 0 );
+    sefdTable_.resize( nBands );
+
+    const auto *elModel = dynamic_cast<const Equipment_elModel *>( &equip );
+    const auto *elTable = dynamic_cast<const Equipment_elTable *>( &equip );
+    for ( unsigned long bandId = 0; bandId < nBands; ++bandId ) {
+        const string &band = BandRegistry::getName( bandId );
+        if ( !equip.hasSEFD( band ) ) {
+            continue;
+        }
+        if ( !equip.isElevationDependent() ) {
+            sefdType_[bandId] = SEFDType::constant;
+            sefd_[bandId] = equip.getSEFD( band, halfpi );
+
+        } else if ( elModel != nullptr ) {
+            sefdType_[bandId] = SEFDType::model;
+            sefd_[bandId] = elModel->getSEFDs().at( band );
+            sefdY_[bandId] = elModel->getY().at( band );
+            sefdC0_[bandId] = elModel->getC0().at( band );
+            sefdC1_[bandId] = elModel->getC1().at( band );
+
+        } else if ( elTable != nullptr ) {
+            auto itEl = elTable->getElevations().find( band );
+            if ( itEl == elTable->getElevations().end() ) {
+                continue;
+            }
+            const vector<double> &tel = itEl->second;
+            const vector<double> &tSEFD = elTable->getSEFDs().at( band );
+            // unsorted or incomplete tables are calculated with the equipment object
+            if ( tel.empty() || tSEFD.size() != tel.size() || !is_sorted( tel.begin(), tel.end() ) ) {
+                continue;
+            }
+
+            // first knot above the lower boundary of each elevation cell (cells are slightly enlarged to be robust
+            // against rounding of the cell index)
+            constexpr double margin = 1e-9;
+            SEFDTable &t = sefdTable_[bandId];
+            t.el = tel;
+            t.SEFD = tSEFD;
+            auto nCells = max( static_cast<unsigned long>( ceil( ( tel.back() - tel.front() ) * sefdScale_ ) ), 1ul );
+            t.cell.resize( nCells );
+            unsigned int idx = 1;
+            for ( unsigned long i = 0; i < nCells; ++i ) {
+                double lower = tel.front() + static_cast<double>( i ) * sefdStep_ - margin;
+                while ( idx + 1 < tel.size() && tel[idx] <= lower ) {
+                    ++idx;
+                }
+                t.cell[i] = idx;
+            }
+            sefdType_[bandId] = SEFDType::table;
+        }
+    }
+
+    // lowest and highest minimum elevation per azimuth cell (cells are slightly enlarged to be robust against
+    // rounding of the cell index)
+    if ( mask != nullptr ) {
+        constexpr double margin = 1e-9;
+        auto nAz = static_cast<unsigned long>( ceil( twopi * maskScale_ ) );
+        maskLow_.resize( nAz );
+        maskHigh_.resize( nAz );
+        for ( unsigned long i = 0; i < nAz; ++i ) {
+            double az1 = max( static_cast<double>( i ) * maskStep_ - margin, 0.0 );
+            double az2 = min( static_cast<double>( i + 1 ) * maskStep_ + margin, twopi );
+            tie( maskLow_[i], maskHigh_[i] ) = mask->elevationRange( az1, az2 );
+        }
+    }
+}
@@ -0,0 +1,217 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file StationLookupTables.h
+ * @brief class StationLookupTables
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+
+#ifndef STATIONLOOKUPTABLES_H
+#define STATIONLOOKUPTABLES_H
+
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "../Misc/Constants.h"
+#include "Equip/AbstractEquipment.h"
+#include "HorizonMask/AbstractHorizonMask.h"
+
+
+namespace VieVS {
+
+/**
+ * @class StationLookupTables
+ * @brief SEFD and horizon mask of one station compiled for fast access
+ *
+ * The tables are compiled once from the equipment and horizon mask objects (which are still used for catalog in- and
+ * output). Afterwards, values are accessed by direct index computation instead of virtual calls, string lookups and
+ * searches in knot vectors.
+ *
+ * SEFDs are stored per band id. Constant SEFDs are stored as one value, elevation models as their parameters and
+ * elevation tables as knot and SEFD vectors plus a 0.1 degree elevation cell table pointing to the first candidate
+ * knot. The formulas are the same as in the equipment objects, therefore the results are bit-identical.
+ *
+ * The horizon mask is stored as lowest and highest minimum elevation per 0.1 degree azimuth cell. Only pointing
+ * vectors between these two values need to be checked with the horizon mask object, therefore the result is exact.
+ *
+ * @author Matthias Schartner
+ * @date 16.10.2026
+ */
+class StationLookupTables {
+   public:
+    /**
+     * @brief result of horizon mask lookup
+     * @author Matthias Schartner
+     */
+    enum class MaskResult {
+        visible,     ///< above horizon mask
+        hidden,      ///< below horizon mask
+        undecided,   ///< close to horizon mask, needs to be checked with horizon mask object
+    };
+
+
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     *
+     * @param equip station equipment
+     * @param mask station horizon mask (might be nullptr)
+     */
+    StationLookupTables( const AbstractEquipment &equip, const AbstractHorizonMask *mask );
+
+
+    /**
+     * @brief checks if SEFD of band is compiled
+     * @author Matthias Schartner
+     *
+     * @param bandId band id (see BandRegistry)
+     * @return true if SEFD is compiled, otherwise false
+     */
+    bool hasSEFD( unsigned long bandId ) const noexcept {
+        return bandId < sefdType_.size() && sefdType_[bandId] != SEFDType::none;
+    }
+
+
+    /**
+     * @brief compiled SEFD
+     * @author Matthias Schartner
+     *
+     * SEFD must be compiled for this band (see hasSEFD()).
+     *
+     * @param bandId band id (see BandRegistry)
+     * @param el elevation
+     * @return SEFD of this band
+     */
+    double getSEFD( unsigned long bandId, double el ) const noexcept {
+        switch ( sefdType_[bandId] ) {
+            case SEFDType::model: {
+                // same formula as Equipment_elModel::getSEFD
+                double SEFD = sefd_[bandId];
+                if ( SEFD == 0 ) {
+                    return 0;
+                }
+                double tmp = pow( sin( el ), sefdY_[bandId] );
+                double tmp2 = sefdC0_[bandId] + sefdC1_[bandId] / tmp;
+                if ( tmp2 < 1 ) {
+                    return SEFD;
+                } else {
+                    return SEFD * tmp2;
+                }
+            }
+            case SEFDType::table: {
+                // same formula as Equipment_elTable::getSEFD, bracketing knot starts at elevation cell
+                const SEFDTable &t = sefdTable_[bandId];
+                if ( el <= t.el.front() ) {
+                    return t.SEFD.front();
+                }
+                if ( el >= t.el.back() ) {
+                    return t.SEFD.back();
+                }
+                double cell = ( el - t.el.front() ) * sefdScale_;
+                unsigned int idx = cell < t.cell.size() ? t.cell[static_cast<unsigned long>( cell )] : t.cell.back();
+                while ( el >= t.el[idx] ) {
+                    ++idx;
+                }
+                double dy = t.SEFD[idx] - t.SEFD[idx - 1];
+                double dx = ( el - t.el[idx - 1] ) / ( t.el[idx] - t.el[idx - 1] );
+                return t.SEFD[idx - 1] + dy * dx;
+            }
+            default:
+                return sefd_[bandId];
+        }
+    }
+
+
+    /**
+     * @brief checks if station has tabulated horizon mask
+     * @author Matthias Schartner
+     *
+     * @return true if horizon mask is tabulated, otherwise false
+     */
+    bool hasMask() const noexcept { return !maskLow_.empty(); }
+
+
+    /**
+     * @brief check pointing direction against tabulated horizon mask
+     * @author Matthias Schartner
+     *
+     * @param az azimuth in radians
+     * @param el elevation in radians
+     * @return visible or hidden if the horizon mask cell is decisive, otherwise undecided
+     */
+    MaskResult maskVisible( double az, double el ) const noexcept {
+        az = fmod( az, twopi );
+        if ( az < 0 ) {
+            az += twopi;
+        }
+        auto idx = std::min( static_cast<unsigned long>( az * maskScale_ ), maskLow_.size() - 1 );
+        if ( el >= maskHigh_[idx] ) {
+            return MaskResult::visible;
+        }
+        if ( el < maskLow_[idx] ) {
+            return MaskResult::hidden;
+        }
+        return MaskResult::undecided;
+    }
+
+
+   private:
+    /**
+     * @brief type of compiled SEFD
+     * @author Matthias Schartner
+     */
+    enum class SEFDType : char {
+        none,      ///< not compiled
+        constant,  ///< constant SEFD
+        model,     ///< elevation dependent SEFD model
+        table,     ///< elevation dependent SEFD table
+    };
+
+    /**
+     * @brief compiled elevation dependent SEFD table
+     * @author Matthias Schartner
+     */
+    struct SEFDTable {
+        std::vector<double> el;          ///< elevation knots
+        std::vector<double> SEFD;        ///< SEFD per knot
+        std::vector<unsigned int> cell;  ///< first candidate upper knot per elevation cell
+    };
+
+    static constexpr double sefdStep_ = 0.1 * deg2rad;  ///< elevation spacing of SEFD table cells
+    static constexpr double maskStep_ = 0.1 * deg2rad;  ///< azimuth spacing of horizon mask table
+
+    std::vector<SEFDType> sefdType_;    ///< type of compiled SEFD per band id
+    std::vector<double> sefd_;          ///< constant SEFD or SEFD of elevation model per band id
+    std::vector<double> sefdY_;         ///< elevation model parameter "y" per band id
+    std::vector<double> sefdC0_;        ///< elevation model parameter "c0" per band id
+    std::vector<double> sefdC1_;        ///< elevation model parameter "c1" per band id
+    std::vector<SEFDTable> sefdTable_;  ///< elevation table per band id
+    double sefdScale_;                  ///< inverse elevation spacing of SEFD table cells
+
+    double maskScale_;               ///< inverse azimuth spacing of horizon mask table
+    std::vector<double> maskLow_;    ///< lowest minimum elevation per azimuth cell
+    std::vector<double> maskHigh_;   ///< highest minimum elevation per azimuth cell
+};
+}  // namespace VieVS
+
+#endif  // STATIONLOOKUPTABLES_H
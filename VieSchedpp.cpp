@@ -81,6 +81,15 @@ void VieSchedpp::run(void) {
 
     ofstream statisticsOf( path_ + "statistics.csv" );
 
+    // duration of each startup phase
+    vector<pair<string, double>> startupTimes;
+    auto phaseStart = chrono::steady_clock::now();
+    auto endPhase = [&]( const string &phase ) {
+        auto now = chrono::steady_clock::now();
+        startupTimes.emplace_back( phase, chrono::duration<double>( now - phaseStart ).count() );
+        phaseStart = now;
+    };
+
     LookupTable::initialize();
     // initialize skd catalogs and lookup table
     try {
@@ -93,11 +102,14 @@ void VieSchedpp::run(void) {
 #endif
         throw;
     }
+    endPhase( "read catalogs" );
 
     // initialize all Parameters
     init.initializeGeneral( of );
-    Initializer::initializeAstronomicalParameteres();
+    Initializer::initializeAstronomicalParameteres(
+        xml_.get<unsigned int>( "VieSchedpp.general.ephemerisStep", 3600 ) );
     init.initializeFocusCornersAlgorithm();
+    endPhase( "general parameters" );
     try {
         init.initializeObservingMode( skdCatalogs_, of );
     } catch ( ... ) {
@@ -108,6 +120,7 @@ void VieSchedpp::run(void) {
 #endif
         throw;
     }
+    endPhase( "observing mode" );
 
     try {
         init.createSources( skdCatalogs_, of );
@@ -124,19 +137,25 @@ void VieSchedpp::run(void) {
 #endif
         throw;
     }
+    endPhase( "create objects" );
 
     try {
         init.initializeStations();
         nsta_ = init.getNetwork().getNSta();
+        endPhase( "stations" );
         init.precalcAzElStations();
+        endPhase( "azimuth/elevation" );
         init.initializeBaselines();
         init.initializeSites();
 
         init.precalcSubnettingSrcIds();
+        endPhase( "baselines and subnetting" );
         init.initializeSources( Initializer::MemberType::source );
         init.initializeSources( Initializer::MemberType::satellite );
         init.initializeSources( Initializer::MemberType::spacecraft );
+        endPhase( "sources" );
         init.initializeSatellitesToAvoid();
+        endPhase( "satellites to avoid" );
         init.initializeSourceSequence();
         init.initializeAstrometricCalibrationBlocks( of );
         init.initializeOptimization( of );
@@ -153,6 +172,22 @@ void VieSchedpp::run(void) {
 #endif
         throw;
     }
+    endPhase( "other parameters" );
+
+    double totalStartupTime = 0;
+    for ( const auto &any : startupTimes ) {
+#ifdef VIESCHEDPP_LOG
+        BOOST_LOG_TRIVIAL( info ) << boost::format( "startup phase %-25s %9.3f [s]" ) % any.first % any.second;
+#else
+        cout << boost::format( "[info] startup phase %-25s %9.3f [s]\n" ) % any.first % any.second;
+#endif
+        totalStartupTime += any.second;
+    }
+#ifdef VIESCHEDPP_LOG
+    BOOST_LOG_TRIVIAL( info ) << boost::format( "startup total %-25s %9.3f [s]" ) % "" % totalStartupTime;
+#else
+    cout << boost::format( "[info] startup total %-25s %9.3f [s]\n" ) % "" % totalStartupTime;
+#endif
 
     // check if multi scheduling is selected
     bool flag_multiSched = false;
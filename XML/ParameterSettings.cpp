@@ -1190,7 +1190,7 @@ void ParameterSettings::mulitsched_genetic( int maxIterations, int populationSiz
 
 
 void ParameterSettings::multiCore( const string &threads, int nThreadsManual, const string &jobScheduler,
-                                   int chunkSize ) {
+                                   int chunkSize, const string &scanSelectionThreads, int nThreadsScanSelection ) {
     boost::property_tree::ptree mc;
     mc.add( "multiCore.threads", threads );
     if ( threads == "manual" ) {
@@ -1200,6 +1200,12 @@ void ParameterSettings::multiCore( const string &threads, int nThreadsManual, co
     if ( jobScheduler != "auto" ) {
         mc.add( "multiCore.chunkSize", chunkSize );
     }
+    if ( scanSelectionThreads != "single" ) {
+        mc.add( "multiCore.scanSelection.threads", scanSelectionThreads );
+        if ( scanSelectionThreads == "manual" ) {
+            mc.add( "multiCore.scanSelection.nThreads", nThreadsScanSelection );
+        }
+    }
 
     master_.add_child( "VieSchedpp.multiCore", mc.get_child( "multiCore" ) );
 }
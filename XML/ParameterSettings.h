@@ -653,8 +653,11 @@ class ParameterSettings {
      * @param nThreadsManual number of manually selected threads
      * @param jobScheduler job scheduling algorithmus
      * @param chunkSize job scheduling chunk size
+     * @param scanSelectionThreads thread creation schema for candidate scan generation within one schedule
+     * @param nThreadsScanSelection number of manually selected threads for candidate scan generation
      */
-    void multiCore( const std::string &threads, int nThreadsManual, const std::string &jobScheduler, int chunkSize );
+    void multiCore( const std::string &threads, int nThreadsManual, const std::string &jobScheduler, int chunkSize,
+                    const std::string &scanSelectionThreads = "single", int nThreadsScanSelection = 1 );
 
 
     /**
@@ -87,6 +87,10 @@ int main( int argc, char *argv[] ) {
         if ( arg == "--help" || arg == "-h" ) {
             std::cout << "pass path to a VieSchedpp.xml file as first input argument" << std::endl;
             std::cout << "e.g. \"./VieSchedpp path/to/VieSchedpp.xml\"" << std::endl;
+            std::cout << "add \"--no-cache\" to ignore cached precalculations" << std::endl;
+            std::cout << "e.g. \"./VieSchedpp path/to/VieSchedpp.xml --no-cache\"" << std::endl;
+            std::cout << "add \"--bundle path/to/catalogs.bin\" to create a binary bundle of all sked catalogs"
+                      << std::endl;
             return 0;
         }
 
@@ -117,6 +121,14 @@ int main( int argc, char *argv[] ) {
         std::string flag = argv[1];
         std::string file = argv[2];
 
+        if ( file == "--no-cache" ) {
+            // main scheduling program without reading cached precalculations
+            VieVS::PrecalcCache::bypass = true;
+            std::cout << "Processing file: " << flag << "\n";
+            VieVS::VieSchedpp mainScheduler( flag );
+            mainScheduler.run();
+        }
+
         if ( flag == "--snr" ) {
             VieVS::SkdParser mySkdParser( file );
             mySkdParser.read();
@@ -174,6 +186,18 @@ int main( int argc, char *argv[] ) {
 
             solver.simSummary();
         }
+        if ( flag == "--bundle" ) {
+            // binary bundle of all sked catalogs defined in VieSchedpp.xml file
+            boost::property_tree::ptree tree;
+            std::ifstream is( xml );
+            boost::property_tree::read_xml( is, tree, boost::property_tree::xml_parser::trim_whitespace );
+
+            VieVS::SkdCatalogReader reader;
+            reader.setCatalogFilePathes( tree.get_child( "VieSchedpp.catalogs" ) );
+            if ( !reader.writeBundle( file ) ) {
+                return 1;
+            }
+        }
         if ( flag == "--sat" ) {
             VieVS::SkdParser mySkdParser( file );
             mySkdParser.read();